@@ -93,6 +93,12 @@ namespace PCGExBlending
 		for (int i = 0; i < Blenders.Num(); i++) { Blenders[i]->Blend(SourceAIndex, SourceBIndex, TargetIndex, Weight); }
 	}
 
+	void FMetadataBlender::BlendRange(const TConstArrayView<int32> SourceIndicesA, const TConstArrayView<int32> SourceIndicesB, const PCGExMT::FScope& TargetScope, const TConstArrayView<double> Weights) const
+	{
+		// Attribute-major : each blender processes the whole range with a single kernel dispatch
+		for (int i = 0; i < Blenders.Num(); i++) { Blenders[i]->BlendRange(SourceIndicesA, SourceIndicesB, TargetScope, Weights); }
+	}
+
 	void FMetadataBlender::InitTrackers(TArray<PCGEx::FOpStats>& Trackers) const
 	{
 		Trackers.SetNumUninitialized(Blenders.Num());
@@ -14,9 +14,15 @@
 #include "Core/PCGExOpStats.h"
 #include "Data/PCGExData.h"
 #include "Math/PCGExMathDistances.h"
+#include "Helpers/PCGExMetaHelpers.h"
 
 namespace PCGExBlending
 {
+	void IBlender::BlendRange(const TConstArrayView<int32> SourceIndicesA, const TConstArrayView<int32> SourceIndicesB, const PCGExMT::FScope& TargetScope, const TConstArrayView<double> Weights) const
+	{
+		for (int32 i = 0; i < TargetScope.Count; i++) { Blend(SourceIndicesA[i], SourceIndicesB[i], TargetScope.Start + i, Weights[i]); }
+	}
+
 	// FDummyUnionBlender implementation
 
 	void FDummyUnionBlender::Init(const TSharedPtr<PCGExData::FFacade>& TargetData, const TArray<TSharedRef<PCGExData::FFacade>>& InSources)
@@ -57,83 +63,92 @@ namespace PCGExBlending
 
 	void FProxyDataBlender::BlendScope(const PCGExMT::FScope& Scope, const double Weight) const
 	{
-		if (!Operation || !A || !C) { return; }
-
-		// Use FScopedTypedValue for safe working buffers
-		PCGExTypes::FScopedTypedValue ValA(UnderlyingType);
-		PCGExTypes::FScopedTypedValue ValB(UnderlyingType);
-		PCGExTypes::FScopedTypedValue ValC(UnderlyingType);
-
-		PCGEX_SCOPE_LOOP(Index)
-		{
-			A->GetVoid(Index, ValA.GetRaw());
-			B->GetVoid(Index, ValB.GetRaw());
-
-			Operation->Blend(ValA.GetRaw(), ValB.GetRaw(), Weight, ValC.GetRaw());
-			C->SetVoid(Index, ValC.GetRaw());
-		}
+		BlendScopeInternal(Scope, nullptr, nullptr, Weight);
 	}
 
 	void FProxyDataBlender::BlendScope(const PCGExMT::FScope& Scope, TArrayView<const double> Weights) const
 	{
-		if (!Operation || !A || !C) { return; }
-
-		// Use FScopedTypedValue for safe working buffers
-		PCGExTypes::FScopedTypedValue ValA(UnderlyingType);
-		PCGExTypes::FScopedTypedValue ValB(UnderlyingType);
-		PCGExTypes::FScopedTypedValue ValC(UnderlyingType);
-
-		PCGEX_SCOPE_LOOP(Index)
-		{
-			A->GetVoid(Index, ValA.GetRaw());
-			B->GetVoid(Index, ValB.GetRaw());
-
-			Operation->Blend(ValA.GetRaw(), ValB.GetRaw(), Weights[Index - Scope.Start], ValC.GetRaw());
-			C->SetVoid(Index, ValC.GetRaw());
-		}
+		BlendScopeInternal(Scope, nullptr, Weights.GetData(), 0);
 	}
 
 	void FProxyDataBlender::BlendScope(const PCGExMT::FScope& Scope, TArrayView<const int8> Mask, const double Weight) const
 	{
-		if (!Operation || !A || !C) { return; }
-
-		// Use FScopedTypedValue for safe working buffers
-		PCGExTypes::FScopedTypedValue ValA(UnderlyingType);
-		PCGExTypes::FScopedTypedValue ValB(UnderlyingType);
-		PCGExTypes::FScopedTypedValue ValC(UnderlyingType);
-
-		PCGEX_SCOPE_LOOP(Index)
-		{
-			if (!Mask[Index - Scope.Start]) { continue; }
-
-			A->GetVoid(Index, ValA.GetRaw());
-			B->GetVoid(Index, ValB.GetRaw());
-
-			Operation->Blend(ValA.GetRaw(), ValB.GetRaw(), Weight, ValC.GetRaw());
-			C->SetVoid(Index, ValC.GetRaw());
-		}
+		BlendScopeInternal(Scope, Mask.GetData(), nullptr, Weight);
 	}
 
 	void FProxyDataBlender::BlendScope(const PCGExMT::FScope& Scope, TArrayView<const int8> Mask, TArrayView<const double> Weights) const
 	{
-		if (!Operation || !A || !C) { return; }
+		BlendScopeInternal(Scope, Mask.GetData(), Weights.GetData(), 0);
+	}
 
-		// Use FScopedTypedValue for safe working buffers
-		PCGExTypes::FScopedTypedValue ValA(UnderlyingType);
-		PCGExTypes::FScopedTypedValue ValB(UnderlyingType);
-		PCGExTypes::FScopedTypedValue ValC(UnderlyingType);
+	void FProxyDataBlender::BlendScopeInternal(const PCGExMT::FScope& Scope, const int8* Mask, const double* Weights, const double Weight) const
+	{
+		if (!Operation || !A || !B || !C || !Scope.IsValid()) { return; }
 
-		PCGEX_SCOPE_LOOP(Index)
+		PCGExMetaHelpers::ExecuteWithRightType(UnderlyingType, [&](auto DummyValue)
 		{
-			const int32 i = Index - Scope.Start;
-			if (!Mask[i]) { continue; }
+			using T = decltype(DummyValue);
+
+			TArray<T> ValuesA;
+			TArray<T> ValuesB;
+			ValuesA.SetNum(Scope.Count);
+			ValuesB.SetNum(Scope.Count);
+
+			A->GetVoidRange(Scope.Start, Scope.Count, ValuesA.GetData());
+			B->GetVoidRange(Scope.Start, Scope.Count, ValuesB.GetData());
+
+			// Blend in-place into B
+			if (Weights) { Operation->BlendRange(ValuesA.GetData(), ValuesB.GetData(), TConstArrayView<double>(Weights, Scope.Count), ValuesB.GetData()); }
+			else { Operation->BlendRange(ValuesA.GetData(), ValuesB.GetData(), Weight, ValuesB.GetData(), Scope.Count); }
+
+			if (!Mask)
+			{
+				C->SetVoidRange(Scope.Start, Scope.Count, ValuesB.GetData());
+				return;
+			}
+
+			// Only write back contiguous runs of masked values
+			int32 RunStart = -1;
+			for (int32 i = 0; i <= Scope.Count; i++)
+			{
+				if (i < Scope.Count && Mask[i])
+				{
+					if (RunStart == -1) { RunStart = i; }
+					continue;
+				}
+
+				if (RunStart == -1) { continue; }
+
+				C->SetVoidRange(Scope.Start + RunStart, i - RunStart, ValuesB.GetData() + RunStart);
+				RunStart = -1;
+			}
+		});
+	}
 
-			A->GetVoid(Index, ValA.GetRaw());
-			B->GetVoid(Index, ValB.GetRaw());
+	void FProxyDataBlender::BlendRange(const TConstArrayView<int32> SourceIndicesA, const TConstArrayView<int32> SourceIndicesB, const PCGExMT::FScope& TargetScope, const TConstArrayView<double> Weights) const
+	{
+		if (!Operation || !A || !B || !C || !TargetScope.IsValid()) { return; }
 
-			Operation->Blend(ValA.GetRaw(), ValB.GetRaw(), Weights[i], ValC.GetRaw());
-			C->SetVoid(Index, ValC.GetRaw());
-		}
+		check(SourceIndicesA.Num() == TargetScope.Count && SourceIndicesB.Num() == TargetScope.Count && Weights.Num() == TargetScope.Count)
+
+		PCGExMetaHelpers::ExecuteWithRightType(UnderlyingType, [&](auto DummyValue)
+		{
+			using T = decltype(DummyValue);
+
+			TArray<T> ValuesA;
+			TArray<T> ValuesB;
+			ValuesA.SetNum(TargetScope.Count);
+			ValuesB.SetNum(TargetScope.Count);
+
+			for (int32 i = 0; i < TargetScope.Count; i++)
+			{
+				A->GetVoid(SourceIndicesA[i], &ValuesA[i]);
+				B->GetVoid(SourceIndicesB[i], &ValuesB[i]);
+			}
+
+			Operation->BlendRange(ValuesA.GetData(), ValuesB.GetData(), Weights, ValuesB.GetData());
+			C->SetVoidRange(TargetScope.Start, TargetScope.Count, ValuesB.GetData());
+		});
 	}
 
 	PCGEx::FOpStats FProxyDataBlender::BeginMultiBlend(const int32 TargetIndex)
@@ -61,6 +61,11 @@ bool FPCGExFuseDetailsBase::IsWithinToleranceComponentWise(const FVector& Source
 	return FMath::IsWithin<double, double>(abs(Source.X - Target.X), 0, CWTolerance.X) && FMath::IsWithin<double, double>(abs(Source.Y - Target.Y), 0, CWTolerance.Y) && FMath::IsWithin<double, double>(abs(Source.Z - Target.Z), 0, CWTolerance.Z);
 }
 
+FVector FPCGExFuseDetailsBase::GetLocalTolerance(const int32 PointIndex) const
+{
+	return ToleranceGetter->Read(PointIndex);
+}
+
 FPCGExSourceFuseDetails::FPCGExSourceFuseDetails()
 	: FPCGExFuseDetailsBase(false)
 {
@@ -129,7 +134,7 @@ uint64 FPCGExFuseDetails::GetGridKey(const FVector& Location, const int32 PointI
 
 FBox FPCGExFuseDetails::GetOctreeBox(const FVector& Location, const int32 PointIndex) const
 {
-	const FVector Extent = ToleranceGetter->Read(PointIndex);
+	const FVector Extent = GetLocalTolerance(PointIndex);
 	return FBox(Location - Extent, Location + Extent);
 }
 
@@ -16,6 +16,12 @@ void FPCGExSubPointsBlendInterpolate::BlendSubPoints(const PCGExData::FConstPoin
 	EPCGExBlendOver SafeBlendOver = TypedFactory->BlendOver;
 	if (TypedFactory->BlendOver == EPCGExBlendOver::Distance && !Metrics.IsValid()) { SafeBlendOver = EPCGExBlendOver::Index; }
 
+	if (!Scope.IsValid()) { return; }
+
+	// Gather per-point weights first, then blend the whole scope in one go
+	TArray<double> Weights;
+	Weights.SetNumUninitialized(Scope.Count);
+
 	if (SafeBlendOver == EPCGExBlendOver::Distance)
 	{
 		PCGExPaths::FPathMetrics PathMetrics = PCGExPaths::FPathMetrics(From.GetLocation());
@@ -24,33 +30,26 @@ void FPCGExSubPointsBlendInterpolate::BlendSubPoints(const PCGExData::FConstPoin
 		PCGEX_SCOPE_LOOP(Index)
 		{
 			FVector Location = OutTransform[Index].GetLocation();
-			MetadataBlender->Blend(From.Index, To.Index, Index, Metrics.GetTime(PathMetrics.Add(Location)));
+			Weights[Index - Scope.Start] = Metrics.GetTime(PathMetrics.Add(Location));
 			//OutTransform[Index].SetLocation(Location);
 		}
 	}
 	else if (SafeBlendOver == EPCGExBlendOver::Index)
 	{
 		const double Divider = Scope.Count;
-		TPCGValueRange<FTransform> OutTransform = Scope.Data->GetTransformValueRange(false);
-
-		PCGEX_SCOPE_LOOP(Index)
-		{
-			//FVector Location = OutTransform[Index].GetLocation();
-			MetadataBlender->Blend(From.Index, To.Index, Index, Index / Divider);
-			//OutTransform[Index].SetLocation(Location);
-		}
+		PCGEX_SCOPE_LOOP(Index) { Weights[Index - Scope.Start] = Index / Divider; }
 	}
-	else if (SafeBlendOver == EPCGExBlendOver::Fixed)
+	else
 	{
-		TPCGValueRange<FTransform> OutTransform = Scope.Data->GetTransformValueRange(false);
-
-		PCGEX_SCOPE_LOOP(Index)
-		{
-			//FVector Location = OutTransform[Index].GetLocation();
-			MetadataBlender->Blend(From.Index, To.Index, Index, Lerp);
-			//OutTransform[Index].SetLocation(Location);
-		}
+		for (double& W : Weights) { W = Lerp; }
 	}
+
+	TArray<int32> FromIndices;
+	TArray<int32> ToIndices;
+	FromIndices.Init(From.Index, Scope.Count);
+	ToIndices.Init(To.Index, Scope.Count);
+
+	MetadataBlender->BlendRange(FromIndices, ToIndices, Scope, Weights);
 }
 
 void UPCGExSubPointsBlendInterpolate::CopySettingsFrom(const UPCGExInstancedFactory* Other)
@@ -39,6 +39,7 @@ namespace PCGExBlending
 
 		virtual void Blend(const int32 SourceIndex, const int32 TargetIndex, const double Weight) const override;
 		virtual void Blend(const int32 SourceAIndex, const int32 SourceBIndex, const int32 TargetIndex, const double Weight) const override;
+		virtual void BlendRange(const TConstArrayView<int32> SourceIndicesA, const TConstArrayView<int32> SourceIndicesB, const PCGExMT::FScope& TargetScope, const TConstArrayView<double> Weights) const override;
 
 		virtual void InitTrackers(TArray<PCGEx::FOpStats>& Trackers) const override;
 
@@ -26,6 +26,9 @@ namespace PCGExBlending
 	// Finalize: Acc = Finalize(Acc, TotalWeight, Count)
 	using FFinalizeFn = void (*)(void* Accumulator, double TotalWeight, int32 Count);
 
+	// Range blend: Out[i] = Blend(A[i], B[i], Weights ? Weights[i] : Weight), over contiguous arrays of the working type
+	using FBlendRangeFn = void (*)(const void* A, const void* B, const double* Weights, double Weight, void* Out, int32 Count);
+
 	//
 	// IBlendOperation - Type-erased interface for blend operations
 	//
@@ -41,6 +44,7 @@ namespace PCGExBlending
 		const bool bConsiderOriginalValue;
 
 		FBlendFn BlendFunc = nullptr;
+		FBlendRangeFn BlendRangeFunc = nullptr;
 		FBlendFn AccumulateFunc = nullptr;
 		FFinalizeFn FinalizeFunc = nullptr;
 
@@ -51,6 +55,10 @@ namespace PCGExBlending
 		// Core blend: Out = Blend(A, B, Weight)
 		FORCEINLINE void Blend(const void* A, const void* B, double Weight, void* Out) const { BlendFunc(A, B, Weight, Out); }
 
+		// Range blend: one dispatch for Count contiguous values. Out may alias A or B.
+		FORCEINLINE void BlendRange(const void* A, const void* B, const double Weight, void* Out, const int32 Count) const { BlendRangeFunc(A, B, nullptr, Weight, Out, Count); }
+		FORCEINLINE void BlendRange(const void* A, const void* B, const TConstArrayView<double> Weights, void* Out) const { BlendRangeFunc(A, B, Weights.GetData(), 0, Out, Weights.Num()); }
+
 		// Multi-blend operations for accumulation patterns
 		FORCEINLINE void BeginMulti(void* Accumulator, const void* InitialValue, PCGEx::FOpStats& OutTracker) const
 		{
@@ -283,6 +291,57 @@ namespace PCGExBlending
 			}
 		}
 
+		// Range kernel for a given per-value blend function.
+		// The per-value function is a compile-time constant here, so it's inlined into a tight typed loop
+		// the compiler can unroll & vectorize, instead of an indirect call per value.
+		template <typename T, FBlendFn Fn>
+		void BlendRange(const void* A, const void* B, const double* Weights, const double Weight, void* Out, const int32 Count)
+		{
+			const T* InA = static_cast<const T*>(A);
+			const T* InB = static_cast<const T*>(B);
+			T* OutValues = static_cast<T*>(Out);
+
+			if (Weights) { for (int32 i = 0; i < Count; i++) { Fn(InA + i, InB + i, Weights[i], OutValues + i); } }
+			else { for (int32 i = 0; i < Count; i++) { Fn(InA + i, InB + i, Weight, OutValues + i); } }
+		}
+
+		// Get range blend function pointer by mode
+		template <typename T>
+		FBlendRangeFn GetBlendRangeFunction(const EPCGExABBlendingType Mode)
+		{
+			switch (Mode)
+			{
+			case EPCGExABBlendingType::Add: return &BlendRange<T, &Add<T>>;
+			case EPCGExABBlendingType::Subtract: return &BlendRange<T, &Sub<T>>;
+			case EPCGExABBlendingType::Multiply: return &BlendRange<T, &Mult<T>>;
+			case EPCGExABBlendingType::Divide: return &BlendRange<T, &Divide<T>>;
+			case EPCGExABBlendingType::Lerp: return &BlendRange<T, &Lerp<T>>;
+			case EPCGExABBlendingType::Min: return &BlendRange<T, &Min<T>>;
+			case EPCGExABBlendingType::Max: return &BlendRange<T, &Max<T>>;
+			case EPCGExABBlendingType::Average: return &BlendRange<T, &Average<T>>;
+			case EPCGExABBlendingType::Weight: return &BlendRange<T, &Weight<T>>;
+			case EPCGExABBlendingType::WeightedAdd: return &BlendRange<T, &WeightedAdd<T>>;
+			case EPCGExABBlendingType::WeightedSubtract: return &BlendRange<T, &WeightedSub<T>>;
+			case EPCGExABBlendingType::CopyTarget: return &BlendRange<T, &CopyA<T>>;
+			case EPCGExABBlendingType::CopySource: return &BlendRange<T, &CopyB<T>>;
+			case EPCGExABBlendingType::UnsignedMin: return &BlendRange<T, &UnsignedMin<T>>;
+			case EPCGExABBlendingType::UnsignedMax: return &BlendRange<T, &UnsignedMax<T>>;
+			case EPCGExABBlendingType::AbsoluteMin: return &BlendRange<T, &AbsoluteMin<T>>;
+			case EPCGExABBlendingType::AbsoluteMax: return &BlendRange<T, &AbsoluteMax<T>>;
+			case EPCGExABBlendingType::Hash: return &BlendRange<T, &NaiveHash<T>>;
+			case EPCGExABBlendingType::UnsignedHash: return &BlendRange<T, &UnsignedHash<T>>;
+			case EPCGExABBlendingType::Mod: return &BlendRange<T, &ModSimple<T>>;
+			case EPCGExABBlendingType::ModCW: return &BlendRange<T, &ModComplex<T>>;
+			case EPCGExABBlendingType::WeightNormalize:
+			case EPCGExABBlendingType::GeometricMean:
+			case EPCGExABBlendingType::HarmonicMean:
+			case EPCGExABBlendingType::RMS:
+			case EPCGExABBlendingType::Step: return &BlendRange<T, &Weight<T>>; // TBD, mirrors GetBlendFunction
+			case EPCGExABBlendingType::None:
+			default: return &BlendRange<T, &None<T>>;
+			}
+		}
+
 		// Get accumulate blend function pointer by mode
 		template <typename T>
 		FBlendFn GetAccumulateFunction(const EPCGExABBlendingType Mode)
@@ -369,6 +428,7 @@ namespace PCGExBlending
 			: IBlendOperation(InMode, bInResetForMulti)
 		{
 			BlendFunc = BlendFunctions::GetBlendFunction<T>(InMode);
+			BlendRangeFunc = BlendFunctions::GetBlendRangeFunction<T>(InMode);
 			AccumulateFunc = BlendFunctions::GetAccumulateFunction<T>(InMode);
 			FinalizeFunc = BlendFunctions::GetFinalizeFunction<T>(InMode);
 		}
@@ -83,6 +83,10 @@ namespace PCGExBlending
 		// Target = SourceA|SourceB
 		virtual void Blend(const int32 SourceIndexA, const int32 SourceIndexB, const int32 TargetIndex, const double Weight) const = 0;
 
+		// Target[TargetScope.Start + i] = SourceA[i]|SourceB[i], for a whole contiguous target scope
+		// Default routes through per-index Blend; implementations may dispatch once per scope instead.
+		virtual void BlendRange(const TConstArrayView<int32> SourceIndicesA, const TConstArrayView<int32> SourceIndicesB, const PCGExMT::FScope& TargetScope, const TConstArrayView<double> Weights) const;
+
 		virtual void BeginMultiBlend(const int32 TargetIndex, TArray<PCGEx::FOpStats>& Trackers) const = 0;
 		virtual void MultiBlend(const int32 SourceIndex, const int32 TargetIndex, const double Weight, TArray<PCGEx::FOpStats>& Tracker) const = 0;
 		virtual void EndMultiBlend(const int32 TargetIndex, TArray<PCGEx::FOpStats>& Tracker) const = 0;
@@ -112,6 +116,10 @@ namespace PCGExBlending
 		{
 		}
 
+		virtual void BlendRange(const TConstArrayView<int32> SourceIndicesA, const TConstArrayView<int32> SourceIndicesB, const PCGExMT::FScope& TargetScope, const TConstArrayView<double> Weights) const override
+		{
+		}
+
 		virtual void BeginMultiBlend(const int32 TargetIndex, TArray<PCGEx::FOpStats>& Trackers) const override
 		{
 		}
@@ -214,11 +222,15 @@ namespace PCGExBlending
 		void Blend(const int32 SourceIndexA, const int32 SourceIndexB, const int32 TargetIndex, const double Weight) const;
 
 		// 1:1 Range blending
+		// Each operand is read in bulk and blended with a single kernel dispatch per scope
 		void BlendScope(const PCGExMT::FScope& Scope, const double Weight) const;
 		void BlendScope(const PCGExMT::FScope& Scope, TArrayView<const double> Weights) const;
 		void BlendScope(const PCGExMT::FScope& Scope, TArrayView<const int8> Mask, const double Weight) const;
 		void BlendScope(const PCGExMT::FScope& Scope, TArrayView<const int8> Mask, TArrayView<const double> Weights) const;
 
+		// Gathered range blending : Target[TargetScope.Start + i] = SourceA[i]|SourceB[i]
+		void BlendRange(const TConstArrayView<int32> SourceIndicesA, const TConstArrayView<int32> SourceIndicesB, const PCGExMT::FScope& TargetScope, const TConstArrayView<double> Weights) const;
+
 		// Multi-blend operations
 		PCGEx::FOpStats BeginMultiBlend(const int32 TargetIndex);
 		void MultiBlend(const int32 SourceIndex, const int32 TargetIndex, const double Weight, PCGEx::FOpStats& Tracker);
@@ -246,6 +258,9 @@ namespace PCGExBlending
 	protected:
 		// Cached type info
 		bool bNeedsLifecycleManagement = false;
+
+		// Typed scope blend shared by all BlendScope variants. Mask & Weights are relative to the scope, and optional.
+		void BlendScopeInternal(const PCGExMT::FScope& Scope, const int8* Mask, const double* Weights, const double Weight) const;
 	};
 
 	//
@@ -69,6 +69,9 @@ struct PCGEXBLENDING_API FPCGExFuseDetailsBase
 	bool IsWithinTolerance(const FVector& Source, const FVector& Target, const int32 PointIndex) const;
 	bool IsWithinToleranceComponentWise(const FVector& Source, const FVector& Target, const int32 PointIndex) const;
 
+	/** Per-axis tolerance for a given point */
+	FVector GetLocalTolerance(const int32 PointIndex) const;
+
 protected:
 	TSharedPtr<PCGExDetails::TSettingValue<FVector>> ToleranceGetter;
 };
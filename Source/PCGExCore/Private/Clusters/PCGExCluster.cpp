@@ -3,12 +3,15 @@
 
 #include "Clusters/PCGExCluster.h"
 #include "Clusters/PCGExClusterCache.h"
+#include "Clusters/PCGExClusterTopology.h"
 
 #include "Data/PCGExPointIO.h"
 #include "Data/PCGExData.h"
 #include "Data/PCGExDataTags.h"
 #include "Clusters/PCGExClusterCommon.h"
 #include "Math/PCGExMathAxis.h"
+#include "Helpers/PCGExMetaHelpers.h"
+#include "Core/PCGExMTCommon.h"
 
 namespace PCGExClusters
 {
@@ -67,6 +70,7 @@ namespace PCGExClusters
 		{
 			Nodes = OriginalCluster->Nodes;
 			NodesDataPtr = OriginalCluster->NodesDataPtr;
+			Adjacency = OriginalCluster->Adjacency;
 
 			// Update index lookup
 			for (const FNode& Node : *Nodes) { NodeIndexLookup->GetMutable(Node.PointIndex) = Node.Index; }
@@ -128,6 +132,7 @@ namespace PCGExClusters
 	{
 		NodeOctree.Reset();
 		EdgeOctree.Reset();
+		NodeKDTree.Reset();
 		BoundedEdges.Reset();
 		EdgeLengths.Reset();
 		bEdgeLengthsDirty = true;
@@ -153,6 +158,7 @@ namespace PCGExClusters
 
 		Nodes->Empty();
 		Edges->Empty();
+		Adjacency.Reset();
 
 		// Each edge stores its two endpoint vertex indices packed into a single int64.
 		// The EndpointsLookup maps vertex hash → point index to resolve edges.
@@ -162,23 +168,52 @@ namespace PCGExClusters
 		NumRawVtx = InNodePoints->GetNumPoints();
 		NumRawEdges = PinnedEdgesIO->GetNum();
 
+		const int32 NumEdges = PinnedEdgesIO->GetNum();
+		const int32 NumSlots = NumEdges * 2;
+
+		PCGExArrayHelpers::InitArray(Edges, NumEdges);
+
+		const TArray<int64>& Endpoints = *EndpointsBuffer->GetInValues().Get();
+		FEdge* EdgesData = Edges->GetData();
+
+		// The node lookup is shared with other clusters of the same vtx data, but each cluster only touches its own points.
+		// Until nodes are created, the entry of each referenced point holds the first edge slot (Edge * 2 + Side) referencing it.
+		int32* LookupData = static_cast<TArrayView<int32>>(*NodeIndexLookup).GetData();
+
 		auto OnFail = [&]()
 		{
+			PCGEX_PARALLEL_FOR(
+				NumEdges,
+				uint32 A;
+				uint32 B;
+				PCGEx::H64(Endpoints[i], A, B);
+				if (const int32* PointIndexPtr = InEndpointsLookup.Find(A)) { LookupData[*PointIndexPtr] = -1; }
+				if (const int32* PointIndexPtr = InEndpointsLookup.Find(B)) { LookupData[*PointIndexPtr] = -1; }
+			)
+
 			Nodes->Empty();
 			Edges->Empty();
 			return false;
 		};
 
-		const int32 NumEdges = PinnedEdgesIO->GetNum();
+		auto ClaimSlot = [LookupData](const int32 PointIndex, const int32 Slot)
+		{
+			int32 Current = FPlatformAtomics::AtomicRead(LookupData + PointIndex);
+			while (Current == -1 || Slot < Current)
+			{
+				const int32 Previous = FPlatformAtomics::InterlockedCompareExchange(LookupData + PointIndex, Slot, Current);
+				if (Previous == Current) { return; }
+				Current = Previous;
+			}
+		};
 
-		PCGExArrayHelpers::InitArray(Edges, NumEdges);
-		Nodes->Reserve(NumRawVtx);
+		// 1. Resolve endpoints in parallel
 
-		const TArray<int64>& Endpoints = *EndpointsBuffer->GetInValues().Get();
+		std::atomic<bool> bInvalid{false};
+
+		PCGEX_PARALLEL_FOR(
+			NumEdges,
 
-		for (int i = 0; i < NumEdges; i++)
-		{
-			// Unpack the two vertex hashes from the int64 edge descriptor.
 			uint32 A;
 			uint32 B;
 			PCGEx::H64(Endpoints[i], A, B);
@@ -187,19 +222,94 @@ namespace PCGExClusters
 			const int32* EndPointIndexPtr = InEndpointsLookup.Find(B);
 
 			// Reject edges with missing endpoints or self-loops.
-			if ((!StartPointIndexPtr || !EndPointIndexPtr || *StartPointIndexPtr == *EndPointIndexPtr)) { return OnFail(); }
+			if (!StartPointIndexPtr || !EndPointIndexPtr || *StartPointIndexPtr == *EndPointIndexPtr)
+			{
+				bInvalid = true;
+				return;
+			}
+
+			EdgesData[i] = FEdge(i, *StartPointIndexPtr, *EndPointIndexPtr, i, EdgeIOIndex);
+			ClaimSlot(*StartPointIndexPtr, i * 2);
+			ClaimSlot(*EndPointIndexPtr, i * 2 + 1);
+		)
+
+		if (bInvalid) { return OnFail(); }
+
+		// 2. Nodes are a subset of all vtx points - only those referenced by at least one edge get a node.
+		// They are numbered by first appearance, same as if they were created edge after edge.
+
+		TArray<int32> NodePoints;
+		NodePoints.Reserve(FMath::Min(NumSlots, NumRawVtx));
+
+		for (int32 Slot = 0; Slot < NumSlots; Slot++)
+		{
+			const FEdge& Edge = EdgesData[Slot >> 1];
+			const int32 PointIndex = (Slot & 1) ? Edge.End : Edge.Start;
+			if (LookupData[PointIndex] == Slot) { NodePoints.Add(PointIndex); }
+		}
+
+		const int32 NumNodes = NodePoints.Num();
+		Nodes->SetNum(NumNodes);
+		FNode* NodesData = Nodes->GetData();
 
-			// Lazily create cluster nodes for each vertex. Nodes are a subset of all
-			// vtx points - only those referenced by at least one edge get a node.
-			const int32 StartNode = GetOrCreateNode_Unsafe(*StartPointIndexPtr);
-			const int32 EndNode = GetOrCreateNode_Unsafe(*EndPointIndexPtr);
+		PCGEX_PARALLEL_FOR(
+			NumNodes,
+			FNode& Node = NodesData[i];
+			Node.Index = i;
+			Node.PointIndex = NodePoints[i];
+			LookupData[Node.PointIndex] = i;
+		)
 
-			(Nodes->GetData() + StartNode)->Link(EndNode, i);
-			(Nodes->GetData() + EndNode)->Link(StartNode, i);
+		// 3. Degrees, offsets, then parallel link fill. Links are sorted by edge index, same as sequential insertion.
 
-			*(Edges->GetData() + i) = FEdge(i, *StartPointIndexPtr, *EndPointIndexPtr, i, EdgeIOIndex);
+		TArray<int32> Offsets;
+		Offsets.Init(0, NumNodes + 1);
+
+		PCGEX_PARALLEL_FOR(
+			NumEdges,
+			const FEdge& Edge = EdgesData[i];
+			FPlatformAtomics::InterlockedIncrement(&Offsets[LookupData[Edge.Start]]);
+			FPlatformAtomics::InterlockedIncrement(&Offsets[LookupData[Edge.End]]);
+		)
+
+		for (int32 i = 0, Sum = 0; i <= NumNodes; i++)
+		{
+			const int32 Degree = Offsets[i];
+			Offsets[i] = Sum;
+			Sum += Degree;
 		}
 
+		TArray<int32> Cursors = Offsets;
+		TArray<int32> NodeEdges;
+		NodeEdges.SetNumUninitialized(NumSlots);
+
+		PCGEX_PARALLEL_FOR(
+			NumEdges,
+			const FEdge& Edge = EdgesData[i];
+			NodeEdges[FPlatformAtomics::InterlockedIncrement(&Cursors[LookupData[Edge.Start]]) - 1] = i;
+			NodeEdges[FPlatformAtomics::InterlockedIncrement(&Cursors[LookupData[Edge.End]]) - 1] = i;
+		)
+
+		PCGEX_PARALLEL_FOR(
+			NumNodes,
+
+			FNode& Node = NodesData[i];
+			const int32 Start = Offsets[i];
+			const int32 Count = Offsets[i + 1] - Start;
+
+			TArrayView<int32> Adjacent(NodeEdges.GetData() + Start, Count);
+			Adjacent.Sort();
+
+			Node.Links.Reset(Count);
+			for (const int32 EdgeIndex : Adjacent)
+			{
+				const FEdge& Edge = EdgesData[EdgeIndex];
+				Node.Links.Emplace(LookupData[Edge.Other(Node.PointIndex)], EdgeIndex);
+			}
+		)
+
+		for (int32 i = 0; i < NumNodes; i++) { Bounds += VtxTransforms[NodePoints[i]].GetLocation(); }
+
 		// Validate against expected adjacency counts (from a previous cluster build).
 		// Only checks for missing connections, not extra ones, to detect broken edges.
 		if (InExpectedAdjacency)
@@ -210,7 +320,6 @@ namespace PCGExClusters
 			}
 		}
 
-		Nodes->Shrink();
 		Bounds = Bounds.ExpandBy(10);
 
 		NodesDataPtr = Nodes->GetData();
@@ -219,6 +328,151 @@ namespace PCGExClusters
 		return true;
 	}
 
+	bool FCluster::BuildFromTopology(const TConstArrayView<uint8> InPayload, const TArray<int32>* InExpectedAdjacency)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExCluster::BuildFromTopology);
+
+		if (InPayload.IsEmpty()) { return false; }
+
+		const TSharedPtr<PCGExData::FPointIO> PinnedVtxIO = VtxIO.Pin();
+		const TSharedPtr<PCGExData::FPointIO> PinnedEdgesIO = EdgesIO.Pin();
+
+		if (!PinnedVtxIO || !PinnedEdgesIO) { return false; }
+
+		const UPCGBasePointData* InNodePoints = PinnedVtxIO->GetIn();
+
+		Topology::FView View;
+		if (!Topology::Read(InPayload, InNodePoints->GetNumPoints(), PinnedEdgesIO->GetNum(), View)) { return false; }
+
+		const int32 EdgeIOIndex = PinnedEdgesIO->IOIndex;
+		const int32 NumVtx = View.Header.NumRawVtx;
+		const int32 NumEdges = View.Header.NumRawEdges;
+		const int32 NumNodes = View.Header.NumNodes;
+
+		// Counts alone don't tell whether vtx have been reordered or replaced; each edge is checked against the packed endpoints
+		// BuildFrom would resolve, using the vtx ids found at the payload point indices.
+		const TUniquePtr<PCGExData::TArrayBuffer<int64>> EndpointsBuffer = MakeUnique<PCGExData::TArrayBuffer<int64>>(PinnedEdgesIO.ToSharedRef(), Labels::Attr_PCGExEdgeIdx);
+		if (!EndpointsBuffer->InitForRead()) { return false; }
+
+		const FPCGMetadataAttribute<int64>* VtxIdxAttribute = PCGExMetaHelpers::TryGetConstAttribute<int64>(InNodePoints, Labels::Attr_PCGExVtxIdx);
+		if (!VtxIdxAttribute) { return false; }
+
+		const TArray<int64>& Endpoints = *EndpointsBuffer->GetInValues().Get();
+		const TConstPCGValueRange<int64> VtxEntries = InNodePoints->GetConstMetadataEntryValueRange();
+
+		Nodes->Empty();
+		Edges->Empty();
+		Adjacency.Reset();
+
+		// Sections are range-checked while being copied; any out-of-range index or endpoint mismatch discards the whole payload.
+
+		std::atomic<bool> bInvalid{false};
+
+		PCGExArrayHelpers::InitArray(Edges, NumEdges);
+		FEdge* EdgesData = Edges->GetData();
+
+		PCGEX_PARALLEL_FOR(
+			NumEdges,
+
+			const uint32 Start = View.Endpoints[i * 2];
+			const uint32 End = View.Endpoints[i * 2 + 1];
+
+			if (Start >= static_cast<uint32>(NumVtx) || End >= static_cast<uint32>(NumVtx) || Start == End)
+			{
+				bInvalid = true;
+				return;
+			}
+
+			const uint64 Expected = PCGEx::H64(
+				PCGEx::H64A(VtxIdxAttribute->GetValueFromItemKey(VtxEntries[Start])),
+				PCGEx::H64A(VtxIdxAttribute->GetValueFromItemKey(VtxEntries[End])));
+
+			if (static_cast<uint64>(Endpoints[i]) != Expected)
+			{
+				bInvalid = true;
+				return;
+			}
+
+			EdgesData[i] = FEdge(i, Start, End, i, EdgeIOIndex);
+		)
+
+		if (bInvalid)
+		{
+			Edges->Empty();
+			return false;
+		}
+
+		Nodes->SetNum(NumNodes);
+		FNode* NodesData = Nodes->GetData();
+
+		PCGEX_PARALLEL_FOR(
+			NumNodes,
+
+			FNode& Node = NodesData[i];
+			Node.Index = i;
+			Node.PointIndex = View.NodePoints[i];
+
+			if (Node.PointIndex < 0 || Node.PointIndex >= NumVtx)
+			{
+				bInvalid = true;
+				return;
+			}
+
+			const int32 Start = View.Offsets[i];
+			const int32 Count = View.Offsets[i + 1] - Start;
+			const PCGExGraphs::FLink* Links = View.Links.GetData() + Start;
+
+			for (int32 j = 0; j < Count; j++)
+			{
+				if (Links[j].Node < 0 || Links[j].Node >= NumNodes || Links[j].Edge < 0 || Links[j].Edge >= NumEdges)
+				{
+					bInvalid = true;
+					return;
+				}
+			}
+
+			Node.Links.Append(Links, Count);
+		)
+
+		if (bInvalid)
+		{
+			Nodes->Empty();
+			Edges->Empty();
+			return false;
+		}
+
+		// Validate against expected adjacency counts, same as a regular build
+		if (InExpectedAdjacency)
+		{
+			for (const FNode& Node : (*Nodes))
+			{
+				if ((*InExpectedAdjacency)[Node.PointIndex] > Node.Num())
+				{
+					Nodes->Empty();
+					Edges->Empty();
+					return false;
+				}
+			}
+		}
+
+		NumRawVtx = NumVtx;
+		NumRawEdges = NumEdges;
+		VtxTransforms = InNodePoints->GetConstTransformValueRange();
+
+		int32* LookupData = static_cast<TArrayView<int32>>(*NodeIndexLookup).GetData();
+		PCGEX_PARALLEL_FOR(NumNodes, LookupData[NodesData[i].PointIndex] = i;)
+
+		for (int32 i = 0; i < NumNodes; i++) { Bounds += VtxTransforms[NodesData[i].PointIndex].GetLocation(); }
+		Bounds = Bounds.ExpandBy(10);
+
+		NodesDataPtr = Nodes->GetData();
+		EdgesDataPtr = Edges->GetData();
+
+		bBuiltFromTopology = true;
+
+		return true;
+	}
+
 	void FCluster::BuildFromSubgraphData(const TSharedPtr<PCGExData::FFacade>& InVtxFacade, const TSharedPtr<PCGExData::FFacade>& InEdgeFacade, const TArray<FEdge>& InEdges, const int32 InNumNodes)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExCluster::BuildClusterFromSubgraph);
@@ -234,6 +488,7 @@ namespace PCGExClusters
 		VtxTransforms = SubVtxPoints->GetConstTransformValueRange();
 
 		Nodes->Reserve(InNumNodes);
+		Adjacency.Reset();
 
 		Edges->Reserve(NumRawEdges);
 		Edges->Append(InEdges);
@@ -381,6 +636,12 @@ namespace PCGExClusters
 		return EdgeOctree;
 	}
 
+	TSharedPtr<PCGExKDTree::FKDTree> FCluster::GetNodeKDTree()
+	{
+		if (!NodeKDTree) { RebuildNodeKDTree(); }
+		return NodeKDTree;
+	}
+
 	void FCluster::RebuildNodeOctree()
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FCluster::RebuildNodeOctree);
@@ -394,6 +655,21 @@ namespace PCGExClusters
 		}
 	}
 
+	void FCluster::RebuildNodeKDTree()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FCluster::RebuildNodeKDTree);
+
+		const int32 NumNodes = Nodes->Num();
+
+		// Item index is the node index
+		TArray<FVector> Positions;
+		Positions.SetNumUninitialized(NumNodes);
+		PCGEX_PARALLEL_FOR(NumNodes, Positions[i] = GetPos(i);)
+
+		NodeKDTree = MakeShared<PCGExKDTree::FKDTree>();
+		NodeKDTree->Build(Positions);
+	}
+
 	void FCluster::RebuildEdgeOctree()
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FCluster::RebuildEdgeOctree);
@@ -439,6 +715,19 @@ namespace PCGExClusters
 		}
 	}
 
+	void FCluster::RebuildSearchIndex(const EPCGExClusterClosestSearchMode Mode, const bool bForceRebuild)
+	{
+		switch (Mode)
+		{
+		case EPCGExClusterClosestSearchMode::Vtx: if (NodeKDTree && !bForceRebuild) { return; }
+			RebuildNodeKDTree();
+			break;
+		case EPCGExClusterClosestSearchMode::Edge: RebuildOctree(Mode, bForceRebuild);
+			break;
+		default: ;
+		}
+	}
+
 	void FCluster::GatherNodesPointIndices(TArray<int32>& OutValidNodesPointIndices, const bool bValidity) const
 	{
 		const TArray<FNode>& NodesRef = *Nodes.Get();
@@ -467,6 +756,13 @@ namespace PCGExClusters
 
 		const TArray<FNode>& NodesRef = *Nodes;
 
+		if (NodeKDTree)
+		{
+			double DistSquared = 0;
+			if (MinNeighbors <= 0) { return NodeKDTree->FindNearest(Position, DistSquared); }
+			return NodeKDTree->FindNearest(Position, DistSquared, [&](const int32 NodeIndex) { return NodesRef[NodeIndex].Num() >= MinNeighbors; });
+		}
+
 		if (NodeOctree)
 		{
 			auto ProcessCandidate = [&](const PCGExOctree::FItem& Item)
@@ -939,6 +1235,18 @@ namespace PCGExClusters
 		CachedData.Add(Key, Data);
 	}
 
+	TSharedPtr<const FClusterAdjacency> FCluster::GetAdjacency() const
+	{
+		{
+			FReadScopeLock ReadLock(ClusterLock);
+			if (Adjacency) { return Adjacency; }
+		}
+
+		FWriteScopeLock WriteLock(ClusterLock);
+		if (!Adjacency) { Adjacency = FClusterAdjacency::Make(*Nodes); }
+		return Adjacency;
+	}
+
 	void FCluster::ClearCachedData()
 	{
 		FWriteScopeLock WriteLock(ClusterLock);
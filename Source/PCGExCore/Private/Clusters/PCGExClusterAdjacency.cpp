@@ -0,0 +1,42 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Clusters/PCGExClusterAdjacency.h"
+
+#include "Clusters/PCGExNode.h"
+#include "Core/PCGExMTCommon.h"
+
+namespace PCGExClusters
+{
+	TSharedPtr<FClusterAdjacency> FClusterAdjacency::Make(const TArray<FNode>& InNodes)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FClusterAdjacency::Make);
+
+		const int32 NumNodes = InNodes.Num();
+
+		const TSharedPtr<FClusterAdjacency> NewAdjacency = MakeShared<FClusterAdjacency>();
+
+		TArray<int32>& Offsets = NewAdjacency->Offsets;
+		Offsets.SetNumUninitialized(NumNodes + 1);
+
+		int32 NumLinks = 0;
+		for (int32 i = 0; i < NumNodes; i++)
+		{
+			Offsets[i] = NumLinks;
+			NumLinks += InNodes[i].Links.Num();
+		}
+		Offsets[NumNodes] = NumLinks;
+
+		TArray<PCGExGraphs::FLink>& Links = NewAdjacency->Links;
+		Links.SetNumUninitialized(NumLinks);
+
+		PCGEX_PARALLEL_FOR(
+			NumNodes,
+
+			const PCGExGraphs::NodeLinks& NodeLinks = InNodes[i].Links;
+			FMemory::Memcpy(Links.GetData() + Offsets[i], NodeLinks.GetData(), NodeLinks.Num() * sizeof(PCGExGraphs::FLink));
+		)
+
+		return NewAdjacency;
+	}
+}
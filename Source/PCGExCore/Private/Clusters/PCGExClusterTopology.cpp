@@ -0,0 +1,118 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Clusters/PCGExClusterTopology.h"
+
+#include "Clusters/PCGExCluster.h"
+#include "Clusters/PCGExClusterAdjacency.h"
+#include "Core/PCGExMTCommon.h"
+
+namespace PCGExClusters::Topology
+{
+	int64 GetPayloadSize(const FHeader& InHeader)
+	{
+		return sizeof(FHeader)
+			+ sizeof(int32) * (static_cast<int64>(InHeader.NumNodes) * 2 + 1)
+			+ sizeof(PCGExGraphs::FLink) * static_cast<int64>(InHeader.NumLinks)
+			+ sizeof(uint32) * static_cast<int64>(InHeader.NumRawEdges) * 2;
+	}
+
+	bool Write(const FCluster& InCluster, TArray<uint8>& OutPayload)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExClusters::Topology::Write);
+
+		OutPayload.Empty();
+
+		const TArray<FNode>& Nodes = *InCluster.Nodes;
+		const TArray<FEdge>& Edges = *InCluster.Edges;
+
+		const int32 NumNodes = Nodes.Num();
+		const int32 NumEdges = Edges.Num();
+
+		if (!NumNodes || NumEdges != InCluster.NumRawEdges) { return false; }
+
+		// Rehydrated edges are implicitly indexed by their point, make sure that's true for the source cluster
+		std::atomic<bool> bMismatch{false};
+		PCGEX_PARALLEL_FOR(
+			NumEdges,
+			if (Edges[i].Index != i || Edges[i].PointIndex != i) { bMismatch = true; }
+		)
+
+		if (bMismatch) { return false; }
+
+		const TSharedPtr<const FClusterAdjacency> Adjacency = InCluster.GetAdjacency();
+
+		FHeader Header;
+		Header.Magic = Magic;
+		Header.Version = Version;
+		Header.CountsHash = GetCountsHash(InCluster.NumRawVtx, InCluster.NumRawEdges);
+		Header.NumRawVtx = InCluster.NumRawVtx;
+		Header.NumRawEdges = InCluster.NumRawEdges;
+		Header.NumNodes = NumNodes;
+		Header.NumLinks = Adjacency->NumLinks();
+
+		const int64 PayloadSize = GetPayloadSize(Header);
+		if (PayloadSize > MAX_int32) { return false; }
+
+		OutPayload.SetNumUninitialized(static_cast<int32>(PayloadSize));
+		uint8* Cursor = OutPayload.GetData();
+
+		FMemory::Memcpy(Cursor, &Header, sizeof(FHeader));
+		Cursor += sizeof(FHeader);
+
+		int32* NodePoints = reinterpret_cast<int32*>(Cursor);
+		Cursor += sizeof(int32) * NumNodes;
+
+		FMemory::Memcpy(Cursor, Adjacency->Offsets.GetData(), sizeof(int32) * (NumNodes + 1));
+		Cursor += sizeof(int32) * (NumNodes + 1);
+
+		FMemory::Memcpy(Cursor, Adjacency->Links.GetData(), sizeof(PCGExGraphs::FLink) * Header.NumLinks);
+		Cursor += sizeof(PCGExGraphs::FLink) * Header.NumLinks;
+
+		uint32* Endpoints = reinterpret_cast<uint32*>(Cursor);
+
+		PCGEX_PARALLEL_FOR(NumNodes, NodePoints[i] = Nodes[i].PointIndex;)
+
+		PCGEX_PARALLEL_FOR(
+			NumEdges,
+			Endpoints[i * 2] = Edges[i].Start;
+			Endpoints[i * 2 + 1] = Edges[i].End;
+		)
+
+		return true;
+	}
+
+	bool Read(const TConstArrayView<uint8> InPayload, const int32 NumRawVtx, const int32 NumRawEdges, FView& OutView)
+	{
+		if (InPayload.Num() < static_cast<int32>(sizeof(FHeader))) { return false; }
+
+		FHeader& Header = OutView.Header;
+		FMemory::Memcpy(&Header, InPayload.GetData(), sizeof(FHeader));
+
+		if (Header.Magic != Magic || Header.Version != Version) { return false; }
+		if (Header.NumRawVtx != NumRawVtx || Header.NumRawEdges != NumRawEdges) { return false; }
+		if (Header.CountsHash != GetCountsHash(NumRawVtx, NumRawEdges)) { return false; }
+		if (Header.NumNodes <= 0 || Header.NumNodes > NumRawVtx || Header.NumLinks != NumRawEdges * 2) { return false; }
+		if (GetPayloadSize(Header) != InPayload.Num()) { return false; }
+
+		const uint8* Cursor = InPayload.GetData() + sizeof(FHeader);
+
+		OutView.NodePoints = TConstArrayView<int32>(reinterpret_cast<const int32*>(Cursor), Header.NumNodes);
+		Cursor += sizeof(int32) * Header.NumNodes;
+
+		OutView.Offsets = TConstArrayView<int32>(reinterpret_cast<const int32*>(Cursor), Header.NumNodes + 1);
+		Cursor += sizeof(int32) * (Header.NumNodes + 1);
+
+		OutView.Links = TConstArrayView<PCGExGraphs::FLink>(reinterpret_cast<const PCGExGraphs::FLink*>(Cursor), Header.NumLinks);
+		Cursor += sizeof(PCGExGraphs::FLink) * Header.NumLinks;
+
+		OutView.Endpoints = TConstArrayView<uint32>(reinterpret_cast<const uint32*>(Cursor), NumRawEdges * 2);
+
+		// Offsets must be a valid prefix sum, it bounds every node links slice
+		const TConstArrayView<int32>& Offsets = OutView.Offsets;
+		if (Offsets[0] != 0 || Offsets[Header.NumNodes] != Header.NumLinks) { return false; }
+		for (int32 i = 0; i < Header.NumNodes; i++) { if (Offsets[i + 1] < Offsets[i]) { return false; } }
+
+		return true;
+	}
+}
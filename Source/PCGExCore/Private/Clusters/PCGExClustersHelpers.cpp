@@ -127,4 +127,17 @@ namespace PCGExClusters::Helpers
 
 		return nullptr;
 	}
+
+	TConstArrayView<uint8> GetPersistedTopology(const TSharedRef<PCGExData::FPointIO>& EdgeIO)
+	{
+		if (PCGEX_CORE_SETTINGS.bPersistClusterTopology)
+		{
+			if (const UPCGExClusterEdgesData* ClusterEdgesData = Cast<UPCGExClusterEdgesData>(EdgeIO->GetIn()))
+			{
+				return ClusterEdgesData->GetPersistedTopology();
+			}
+		}
+
+		return TConstArrayView<uint8>();
+	}
 }
@@ -49,6 +49,42 @@ namespace PCGExMT
 		return OutSubRanges.Num();
 	}
 
+	int32 GetAdaptiveScopeSize(const int32 NumIterations, const double SecondsPerIteration, const double TargetSeconds, const int32 NumCores)
+	{
+		const int32 MaxScopeSize = FMath::Max(1, FMath::DivideAndRoundUp(NumIterations, FMath::Max(1, NumCores)));
+		if (SecondsPerIteration <= 0) { return MaxScopeSize; }
+		return static_cast<int32>(FMath::Clamp(TargetSeconds / SecondsPerIteration, 1.0, static_cast<double>(MaxScopeSize)));
+	}
+
+	namespace CostEstimates
+	{
+		static FRWLock EstimatesLock;
+		static TMap<uint32, double> Estimates; // Seconds per iteration
+
+		bool Get(const uint32 Key, double& OutSecondsPerIteration)
+		{
+			FReadScopeLock ReadLock(EstimatesLock);
+			if (const double* Estimate = Estimates.Find(Key))
+			{
+				OutSecondsPerIteration = *Estimate;
+				return true;
+			}
+			return false;
+		}
+
+		void Record(const uint32 Key, const uint64 Cycles, const int64 Iterations)
+		{
+			if (Iterations <= 0) { return; }
+
+			const double Sample = FPlatformTime::ToSeconds64(Cycles) / static_cast<double>(Iterations);
+
+			// Exponential moving average, so estimates follow content changes without jittering on a single outlier run
+			FWriteScopeLock WriteLock(EstimatesLock);
+			if (double* Estimate = Estimates.Find(Key)) { *Estimate = *Estimate * 0.75 + Sample * 0.25; }
+			else { Estimates.Add(Key, Sample); }
+		}
+	}
+
 	// IAsyncHandle
 	IAsyncHandle::~IAsyncHandle()
 	{
@@ -421,6 +457,11 @@ namespace PCGExMT
 		: IAsyncHandleGroup(FName("MANAGER")), Context(InContext), ContextHandle(InContext->GetOrCreateHandle())
 	{
 		WorkHandle = Context->GetWorkHandle();
+
+		if (PCGEX_CORE_SETTINGS.bAdaptiveChunkSize)
+		{
+			if (const UPCGSettings* Settings = Context->GetInputSettings<UPCGSettings>()) { SettingsClassHash = GetTypeHash(Settings->GetClass()->GetFName()); }
+		}
 	}
 
 	FTaskManager::~FTaskManager()
@@ -543,6 +584,12 @@ namespace PCGExMT
 
 		PCGEX_MAKE_SHARED(NewGroup, FTaskGroup, InName)
 
+		if (SettingsClassHash)
+		{
+			const uint32 CostKey = HashCombineFast(SettingsClassHash, GetTypeHash(InName));
+			NewGroup->CostKey = CostKey ? CostKey : 1;
+		}
+
 		int32 Idx = -1;
 		{
 			FWriteScopeLock WriteLock(GroupsLock);
@@ -725,7 +772,7 @@ namespace PCGExMT
 		}
 		else
 		{
-			StartRanges<FScopeIterationTask>(NumIterations, SanitizedChunk, bPreparationOnly);
+			StartRanges<FScopeIterationTask>(NumIterations, ChunkSize, bPreparationOnly);
 		}
 	}
 
@@ -754,11 +801,47 @@ namespace PCGExMT
 		StartHandlesBatchImpl(Tasks);
 	}
 
-	void FTaskGroup::ExecScopeIteration(const FScope& Scope, const bool bPrepareOnly) const
+	int32 FTaskGroup::GetScopeSize(const int32 NumIterations, const int32 ChunkSize) const
+	{
+		// Only default chunk sizes are adapted. Explicit sizes are respected, and some loops rely on them
+		// (i.e. a chunk size of 1 to get exactly one item per scope).
+		const bool bIsDefaultChunkSize =
+			ChunkSize > 1 &&
+			(ChunkSize == PCGEX_CORE_SETTINGS.PointsDefaultBatchChunkSize || ChunkSize == PCGEX_CORE_SETTINGS.ClusterDefaultBatchChunkSize);
+
+		double CostPerIteration = 0;
+		if (bIsDefaultChunkSize && CostKey && CostEstimates::Get(CostKey, CostPerIteration) && CostPerIteration > 0)
+		{
+			return GetAdaptiveScopeSize(NumIterations, CostPerIteration, PCGEX_CORE_SETTINGS.AdaptiveTargetScopeDuration * 0.001, FPlatformMisc::NumberOfCores());
+		}
+
+		return FMath::Max(1, GetSanitizedBatchSize(NumIterations, ChunkSize));
+	}
+
+	void FTaskGroup::ExecScopeIteration(const FScope& Scope, const bool bPrepareOnly)
 	{
 		if (!IsAvailable()) { return; }
+
+		const uint64 StartCycles = CostKey ? FPlatformTime::Cycles64() : 0;
+
 		if (OnSubLoopStartCallback) { OnSubLoopStartCallback(Scope); }
 		if (!bPrepareOnly) { PCGEX_SCOPE_LOOP(i) { OnIterationCallback(i, Scope); } }
+
+		if (CostKey)
+		{
+			MeasuredCycles.fetch_add(FPlatformTime::Cycles64() - StartCycles, std::memory_order_relaxed);
+			MeasuredIterations.fetch_add(Scope.Count, std::memory_order_relaxed);
+		}
+	}
+
+	void FTaskGroup::OnEnd(const bool bWasCancelled)
+	{
+		if (CostKey && !bWasCancelled)
+		{
+			CostEstimates::Record(CostKey, MeasuredCycles.load(std::memory_order_acquire), MeasuredIterations.load(std::memory_order_acquire));
+		}
+
+		IAsyncHandleGroup::OnEnd(bWasCancelled);
 	}
 
 	void FTaskGroup::TriggerSimpleCallback(int32 Index)
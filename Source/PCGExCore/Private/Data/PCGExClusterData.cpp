@@ -9,6 +9,7 @@
 
 #include "PCGExSettingsCacheBody.h"
 #include "Clusters/PCGExCluster.h"
+#include "Clusters/PCGExClusterTopology.h"
 
 PCG_DEFINE_TYPE_INFO(FPCGExDataTypeInfoClusterPart, UPCGExClusterData)
 PCG_DEFINE_TYPE_INFO(FPCGExDataTypeInfoVtx, UPCGExClusterNodesData)
@@ -30,15 +31,17 @@ UPCGSpatialData* UPCGExClusterNodesData::CopyInternal(FPCGContext* Context) cons
 void UPCGExClusterEdgesData::InitializeSpatialDataInternal(const FPCGInitializeFromDataParams& InParams)
 {
 	Super::InitializeSpatialDataInternal(InParams);
-	if (const UPCGExClusterEdgesData* InEdgeData = Cast<UPCGExClusterEdgesData>(InParams.Source); InEdgeData && PCGEX_CORE_SETTINGS.bCacheClusters)
+	if (const UPCGExClusterEdgesData* InEdgeData = Cast<UPCGExClusterEdgesData>(InParams.Source))
 	{
-		SetBoundCluster(InEdgeData->Cluster);
+		if (PCGEX_CORE_SETTINGS.bCacheClusters) { SetBoundCluster(InEdgeData->Cluster); }
+		if (PCGEX_CORE_SETTINGS.bPersistClusterTopology) { TopologyPayload = InEdgeData->TopologyPayload; }
 	}
 }
 
 UPCGSpatialData* UPCGExClusterEdgesData::CopyInternal(FPCGContext* Context) const
 {
 	PCGEX_NEW_CUSTOM_POINT_DATA(UPCGExClusterEdgesData)
+	NewData->TopologyPayload = TopologyPayload;
 	return NewData;
 }
 
@@ -52,6 +55,11 @@ const TSharedPtr<PCGExClusters::FCluster>& UPCGExClusterEdgesData::GetBoundClust
 	return Cluster;
 }
 
+void UPCGExClusterEdgesData::PersistTopology(const PCGExClusters::FCluster& InCluster)
+{
+	PCGExClusters::Topology::Write(InCluster, TopologyPayload);
+}
+
 void UPCGExClusterEdgesData::BeginDestroy()
 {
 	Super::BeginDestroy();
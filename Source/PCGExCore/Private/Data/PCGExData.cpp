@@ -13,6 +13,7 @@
 #include "Data/PCGExDataTags.h"
 #include "Data/PCGExPointIO.h"
 #include "Data/PCGPointData.h"
+#include "Data/Utils/PCGExColumnCache.h"
 #include "Helpers/PCGExArrayHelpers.h"
 #include "Metadata/Accessors/PCGAttributeAccessorHelpers.h"
 #include "Metadata/Accessors/PCGCustomAccessor.h"
@@ -50,6 +51,52 @@ namespace PCGExData
 		return Identifier;
 	}
 
+	void FDirtyBlocks::Init(const int32 NumValues, const bool bDirty)
+	{
+		Blocks.Init(bDirty ? 1 : 0, (NumValues >> BlockShift) + 1);
+	}
+
+	void FDirtyBlocks::Mark(const PCGExMT::FScope& Scope)
+	{
+		if (!Scope.IsValid()) { return; }
+
+		const int32 FirstBlock = Scope.Start >> BlockShift;
+		const int32 LastBlock = (Scope.End - 1) >> BlockShift;
+		for (int32 i = FirstBlock; i <= LastBlock; i++) { FPlatformAtomics::AtomicStore_Relaxed(Blocks.GetData() + i, static_cast<int8>(1)); }
+	}
+
+	void FDirtyBlocks::MarkAll()
+	{
+		FMemory::Memset(Blocks.GetData(), 1, Blocks.Num());
+	}
+
+	void FDirtyBlocks::Clear()
+	{
+		FMemory::Memzero(Blocks.GetData(), Blocks.Num());
+	}
+
+	void FDirtyBlocks::GetRanges(const int32 NumValues, TArray<PCGExMT::FScope>& OutRanges) const
+	{
+		const int32 NumBlocks = Blocks.Num();
+		int32 Block = 0;
+
+		while (Block < NumBlocks)
+		{
+			if (!Blocks[Block])
+			{
+				Block++;
+				continue;
+			}
+
+			const int32 FirstBlock = Block;
+			while (Block < NumBlocks && Blocks[Block]) { Block++; }
+
+			const int32 Start = FirstBlock << BlockShift;
+			const int32 End = FMath::Min(NumValues, Block << BlockShift);
+			if (End > Start) { OutRanges.Emplace(Start, End - Start, OutRanges.Num()); }
+		}
+	}
+
 	void IBuffer::EnableValueHashCache()
 	{
 		bCacheValueHashes = true;
@@ -125,7 +172,11 @@ template PCGEXCORE_API bool IBuffer::IsA<_TYPE>() const;
 	TSharedPtr<TArray<T>> TArrayBuffer<T>::GetInValues() { return InValues; }
 
 	template <typename T>
-	TSharedPtr<TArray<T>> TArrayBuffer<T>::GetOutValues() { return OutValues; }
+	TSharedPtr<TArray<T>> TArrayBuffer<T>::GetOutValues()
+	{
+		if (bTrackDirtyRanges) { DirtyBlocks.MarkAll(); }
+		return OutValues;
+	}
 
 	template <typename T>
 	int32 TArrayBuffer<T>::GetNumValues(const EIOSide InSide)
@@ -173,7 +224,11 @@ template PCGEXCORE_API bool IBuffer::IsA<_TYPE>() const;
 	}
 
 	template <typename T>
-	void TArrayBuffer<T>::SetValue(const int32 Index, const T& Value) { *(OutValues->GetData() + Index) = Value; }
+	void TArrayBuffer<T>::SetValue(const int32 Index, const T& Value)
+	{
+		*(OutValues->GetData() + Index) = Value;
+		if (bTrackDirtyRanges) { DirtyBlocks.Mark(Index); }
+	}
 
 	template <typename T>
 	PCGExValueHash TArrayBuffer<T>::ReadValueHash(const int32 Index)
@@ -197,6 +252,7 @@ template PCGEXCORE_API bool IBuffer::IsA<_TYPE>() const;
 		const int32 NumReadValue = Source->GetIn()->GetNumPoints();
 		InValues = MakeShared<TArray<T>>();
 		PCGExArrayHelpers::InitArray(InValues, NumReadValue);
+		UpdateStoragePointers();
 
 		if (bCacheValueHashes) { InHashes.Init(0, NumReadValue); }
 
@@ -206,6 +262,25 @@ template PCGEXCORE_API bool IBuffer::IsA<_TYPE>() const;
 		bSparseBuffer = bScoped;
 	}
 
+	template <typename T>
+	bool TArrayBuffer<T>::TryShareCachedColumn(const uint64 ColumnUID, const FPCGMetadataAttributeBase* Attribute)
+	{
+		TSharedPtr<TArray<T>> Cached = ColumnCache::Find<T>(Source->GetIn(), ColumnUID);
+		if (!Cached || Cached->Num() != Source->GetIn()->GetNumPoints()) { return false; }
+
+		InValues = MoveTemp(Cached);
+		UpdateStoragePointers();
+
+		if (bCacheValueHashes) { InHashes.Init(0, InValues->Num()); }
+
+		InAttribute = Attribute;
+		TypedInAttribute = Attribute ? static_cast<const FPCGMetadataAttribute<T>*>(Attribute) : nullptr;
+
+		bSparseBuffer = false;
+		bReadComplete = true;
+		return true;
+	}
+
 	template <typename T>
 	void TArrayBuffer<T>::InitForWriteInternal(FPCGMetadataAttributeBase* Attribute, const T& InDefaultValue, const EBufferInit Init)
 	{
@@ -213,6 +288,7 @@ template PCGEXCORE_API bool IBuffer::IsA<_TYPE>() const;
 
 		OutValues = MakeShared<TArray<T>>();
 		OutValues->Init(InDefaultValue, Source->GetOut()->GetNumPoints());
+		UpdateStoragePointers();
 
 		OutAttribute = Attribute;
 		TypedOutAttribute = Attribute ? static_cast<FPCGMetadataAttribute<T>*>(Attribute) : nullptr;
@@ -223,6 +299,7 @@ template PCGEXCORE_API bool IBuffer::IsA<_TYPE>() const;
 	{
 		if (InValues) { return true; }
 		InValues = OutValues;
+		UpdateStoragePointers();
 		return InValues ? true : false;
 	}
 
@@ -239,6 +316,34 @@ template PCGEXCORE_API bool IBuffer::IsA<_TYPE>() const;
 		}
 	}
 
+	template <typename T>
+	void TArrayBuffer<T>::EnableDirtyTracking()
+	{
+		FWriteScopeLock WriteScopeLock(BufferLock);
+
+		if (bTrackDirtyRanges) { return; }
+
+		// Requested before InitForWrite, tracking will start there
+		if (!OutValues)
+		{
+			bTrackDirtyRanges = true;
+			return;
+		}
+
+		// Values may already have been modified by whoever initialized the buffer, there's no telling which.
+		// Tracking only pays off when requested before InitForWrite, see FFacade::GetWritable.
+		if (!bPartialWriteSafe) { return; }
+
+		DirtyBlocks.Init(OutValues->Num(), true);
+		bTrackDirtyRanges = true;
+	}
+
+	template <typename T>
+	void TArrayBuffer<T>::MarkDirty(const PCGExMT::FScope& Scope)
+	{
+		if (bTrackDirtyRanges) { DirtyBlocks.Mark(Scope); }
+	}
+
 	template <typename T>
 	bool TArrayBuffer<T>::InitForRead(const EIOSide InSide, const bool bScoped)
 	{
@@ -260,6 +365,7 @@ template PCGEXCORE_API bool IBuffer::IsA<_TYPE>() const;
 				check(false)
 				// Out-source Reader was created before writer, this is bad?
 				InValues = nullptr;
+				UpdateStoragePointers();
 			}
 			else
 			{
@@ -273,6 +379,7 @@ template PCGEXCORE_API bool IBuffer::IsA<_TYPE>() const;
 			// so reads reflect in-progress writes (used for read-modify-write patterns).
 			check(OutValues)
 			InValues = OutValues;
+			UpdateStoragePointers();
 			return true;
 		}
 
@@ -294,6 +401,9 @@ template PCGEXCORE_API bool IBuffer::IsA<_TYPE>() const;
 			return false;
 		}
 
+		// Full reads may share a column another buffer already decoded from the same data
+		if (!bScoped && TryShareCachedColumn(this->UID, TypedInAttribute)) { return true; }
+
 		InitForReadInternal(bScoped, TypedInAttribute);
 
 		// Non-scoped buffers bulk-read all values upfront. Scoped buffers leave
@@ -303,6 +413,8 @@ template PCGEXCORE_API bool IBuffer::IsA<_TYPE>() const;
 			TArrayView<T> InRange = MakeArrayView(InValues->GetData(), InValues->Num());
 			InAccessor->GetRange<T>(InRange, 0, *Source->GetInKeys());
 			bReadComplete = true;
+
+			ColumnCache::Add<T>(Source->GetIn(), this->UID, InValues);
 		}
 
 		return true;
@@ -332,6 +444,7 @@ template PCGEXCORE_API bool IBuffer::IsA<_TYPE>() const;
 				check(false)
 				// Out-source broadcaster was created before writer, this is bad?
 				InValues = nullptr;
+				UpdateStoragePointers();
 			}
 			else
 			{
@@ -346,6 +459,17 @@ template PCGEXCORE_API bool IBuffer::IsA<_TYPE>() const;
 			return false;
 		}
 
+		// Broadcasts are keyed by selector rather than buffer identifier, as they may read extra names/properties.
+		// Min/Max are not cached, so capturing reads always decode.
+		const uint64 BroadcastUID = PCGEx::H64(GetTypeHash(InSelector.ToString()), static_cast<uint32>(this->Type) | 0x100);
+		const bool bShareable = !bScoped && !bCaptureMinMax;
+
+		if (bShareable && TryShareCachedColumn(BroadcastUID, InternalBroadcaster->GetAttribute()))
+		{
+			InternalBroadcaster.Reset();
+			return true;
+		}
+
 		InitForReadInternal(bScoped, InternalBroadcaster->GetAttribute());
 
 		if (!bSparseBuffer && !bReadComplete)
@@ -353,6 +477,8 @@ template PCGEXCORE_API bool IBuffer::IsA<_TYPE>() const;
 			InternalBroadcaster->GrabAndDump(*InValues, bCaptureMinMax, this->Min, this->Max);
 			bReadComplete = true;
 			InternalBroadcaster.Reset();
+
+			if (bShareable) { ColumnCache::Add<T>(Source->GetIn(), BroadcastUID, InValues); }
 		}
 
 		return true;
@@ -402,6 +528,15 @@ template PCGEXCORE_API bool IBuffer::IsA<_TYPE>() const;
 		if (Init == EBufferInit::Inherit) { GrabExistingValues(); }
 		else if (!bHasIn && ExistingEntryCount != 0) { GrabExistingValues(); }
 
+		// Untouched values match the attribute if they were grabbed from it, or if it's brand new and only holds its default value
+		bPartialWriteSafe = this->bIsNewOutput || Init == EBufferInit::Inherit || (!bHasIn && ExistingEntryCount != 0);
+
+		if (bTrackDirtyRanges)
+		{
+			if (bPartialWriteSafe) { DirtyBlocks.Init(OutValues->Num(), false); }
+			else { bTrackDirtyRanges = false; }
+		}
+
 		return true;
 	}
 
@@ -455,7 +590,20 @@ template PCGEXCORE_API bool IBuffer::IsA<_TYPE>() const;
 		SharedContext.Get()->AddProtectedAttributeName(TypedOutAttribute->Name);
 
 		TArrayView<const T> View = MakeArrayView(OutValues->GetData(), OutValues->Num());
-		OutAccessor->SetRange<T>(View, 0, *Source->GetOutKeys(bEnsureValidKeys).Get());
+		const TSharedPtr<IPCGAttributeAccessorKeys> OutKeys = Source->GetOutKeys(bEnsureValidKeys);
+
+		if (!bTrackDirtyRanges)
+		{
+			OutAccessor->SetRange<T>(View, 0, *OutKeys.Get());
+			return;
+		}
+
+		// Only commit runs of modified blocks, untouched values already match the attribute
+		TArray<PCGExMT::FScope> DirtyRanges;
+		DirtyBlocks.GetRanges(View.Num(), DirtyRanges);
+		for (const PCGExMT::FScope& Range : DirtyRanges) { OutAccessor->SetRange<T>(View.Slice(Range.Start, Range.Count), Range.Start, *OutKeys.Get()); }
+
+		DirtyBlocks.Clear();
 	}
 
 	template <typename T>
@@ -478,7 +626,10 @@ template PCGEXCORE_API bool IBuffer::IsA<_TYPE>() const;
 	{
 		InValues.Reset();
 		OutValues.Reset();
+		DirtyBlocks.Empty();
+		bTrackDirtyRanges = false;
 		InternalBroadcaster.Reset();
+		UpdateStoragePointers();
 	}
 
 	template <typename T>
@@ -817,7 +968,7 @@ template class PCGEXCORE_API TSingleValueBuffer<_TYPE>;
 
 
 	template <typename T>
-	TSharedPtr<TBuffer<T>> FFacade::GetWritable(const FPCGAttributeIdentifier& InIdentifier, T DefaultValue, bool bAllowInterpolation, EBufferInit Init)
+	TSharedPtr<TBuffer<T>> FFacade::GetWritable(const FPCGAttributeIdentifier& InIdentifier, T DefaultValue, bool bAllowInterpolation, EBufferInit Init, const bool bTrackDirtyRanges)
 	{
 		TSharedPtr<TBuffer<T>> Buffer = nullptr;
 
@@ -830,14 +981,19 @@ template class PCGEXCORE_API TSingleValueBuffer<_TYPE>;
 			Buffer = GetBuffer<T>(InIdentifier);
 		}
 
-		if (!Buffer || !Buffer->InitForWrite(DefaultValue, bAllowInterpolation, Init)) { return nullptr; }
+		if (!Buffer) { return nullptr; }
+
+		// Must be requested before InitForWrite so tracking starts from clean blocks
+		if (bTrackDirtyRanges) { Buffer->EnableDirtyTracking(); }
+
+		if (!Buffer->InitForWrite(DefaultValue, bAllowInterpolation, Init)) { return nullptr; }
 		return Buffer;
 	}
 
 	template <typename T>
-	TSharedPtr<TBuffer<T>> FFacade::GetWritable(const FPCGMetadataAttribute<T>* InAttribute, EBufferInit Init)
+	TSharedPtr<TBuffer<T>> FFacade::GetWritable(const FPCGMetadataAttribute<T>* InAttribute, EBufferInit Init, const bool bTrackDirtyRanges)
 	{
-		return GetWritable(FPCGAttributeIdentifier(InAttribute->Name, InAttribute->GetMetadataDomain()->GetDomainID()), InAttribute->GetValue(PCGDefaultValueKey), InAttribute->AllowsInterpolation(), Init);
+		return GetWritable(FPCGAttributeIdentifier(InAttribute->Name, InAttribute->GetMetadataDomain()->GetDomainID()), InAttribute->GetValue(PCGDefaultValueKey), InAttribute->AllowsInterpolation(), Init, bTrackDirtyRanges);
 	}
 
 	template <typename T>
@@ -935,8 +1091,8 @@ template class PCGEXCORE_API TSingleValueBuffer<_TYPE>;
 template PCGEXCORE_API TSharedPtr<TBuffer<_TYPE>> FFacade::FindBuffer_Unsafe<_TYPE>(const FPCGAttributeIdentifier& InIdentifier); \
 template PCGEXCORE_API TSharedPtr<TBuffer<_TYPE>> FFacade::FindBuffer<_TYPE>(const FPCGAttributeIdentifier& InIdentifier); \
 template PCGEXCORE_API TSharedPtr<TBuffer<_TYPE>> FFacade::GetBuffer<_TYPE>(const FPCGAttributeIdentifier& InIdentifier); \
-template PCGEXCORE_API TSharedPtr<TBuffer<_TYPE>> FFacade::GetWritable<_TYPE>(const FPCGAttributeIdentifier& InIdentifier, _TYPE DefaultValue, bool bAllowInterpolation, EBufferInit Init); \
-template PCGEXCORE_API TSharedPtr<TBuffer<_TYPE>> FFacade::GetWritable<_TYPE>(const FPCGMetadataAttribute<_TYPE>* InAttribute, EBufferInit Init); \
+template PCGEXCORE_API TSharedPtr<TBuffer<_TYPE>> FFacade::GetWritable<_TYPE>(const FPCGAttributeIdentifier& InIdentifier, _TYPE DefaultValue, bool bAllowInterpolation, EBufferInit Init, bool bTrackDirtyRanges); \
+template PCGEXCORE_API TSharedPtr<TBuffer<_TYPE>> FFacade::GetWritable<_TYPE>(const FPCGMetadataAttribute<_TYPE>* InAttribute, EBufferInit Init, bool bTrackDirtyRanges); \
 template PCGEXCORE_API TSharedPtr<TBuffer<_TYPE>> FFacade::GetWritable<_TYPE>(const FPCGAttributeIdentifier& InIdentifier, EBufferInit Init); \
 template PCGEXCORE_API TSharedPtr<TBuffer<_TYPE>> FFacade::GetReadable<_TYPE>(const FPCGAttributeIdentifier& InIdentifier, const EIOSide InSide, const bool bSupportScoped); \
 template PCGEXCORE_API TSharedPtr<TBuffer<_TYPE>> FFacade::GetBroadcaster<_TYPE>(const FPCGAttributePropertyInputSelector& InSelector, const bool bSupportScoped, const bool bCaptureMinMax, const bool bQuiet); \
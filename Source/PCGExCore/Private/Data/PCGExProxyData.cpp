@@ -194,6 +194,20 @@ namespace PCGExData
 		if (bWantsSubSelection) { CachedSubSelection.Initialize(InSubSelection, RealType, WorkingType); }
 	}
 
+	void IBufferProxy::GetVoidRange(const int32 Start, const int32 Count, void* OutValues) const
+	{
+		const int32 Stride = PCGExTypes::FScopedTypedValue::GetTypeSize(WorkingType);
+		uint8* Out = static_cast<uint8*>(OutValues);
+		for (int32 i = 0; i < Count; i++) { GetVoid(Start + i, Out + i * Stride); }
+	}
+
+	void IBufferProxy::SetVoidRange(const int32 Start, const int32 Count, const void* Values) const
+	{
+		const int32 Stride = PCGExTypes::FScopedTypedValue::GetTypeSize(WorkingType);
+		const uint8* In = static_cast<const uint8*>(Values);
+		for (int32 i = 0; i < Count; i++) { SetVoid(Start + i, In + i * Stride); }
+	}
+
 	void IBufferProxy::InitForRole(EProxyRole InRole)
 	{
 		// Default: no-op. Override in property proxies.
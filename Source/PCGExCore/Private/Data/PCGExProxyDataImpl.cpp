@@ -132,6 +132,34 @@ namespace PCGExData
 		}
 	}
 
+	template <typename T_REAL>
+	void TAttributeBufferProxy<T_REAL>::GetVoidRange(const int32 Start, const int32 Count, void* OutValues) const
+	{
+		check(Buffer);
+
+		// Same type, no sub-selection : single bulk read straight into the output
+		if (!bWantsSubSelection && RealType == WorkingType) { Buffer->Read(Start, TArrayView<T_REAL>(static_cast<T_REAL*>(OutValues), Count)); }
+		else { IBufferProxy::GetVoidRange(Start, Count, OutValues); }
+	}
+
+	template <typename T_REAL>
+	void TAttributeBufferProxy<T_REAL>::SetVoidRange(const int32 Start, const int32 Count, const void* Values) const
+	{
+		check(Buffer);
+
+		if (!bWantsSubSelection && RealType == WorkingType)
+		{
+			const T_REAL* In = static_cast<const T_REAL*>(Values);
+			const TArrayView<T_REAL> OutSpan = Buffer->GetOutSpan(PCGExMT::FScope(Start, Count));
+			if (!OutSpan.IsEmpty()) { for (int32 i = 0; i < Count; i++) { OutSpan[i] = In[i]; } }
+			else { for (int32 i = 0; i < Count; i++) { Buffer->SetValue(Start + i, In[i]); } }
+		}
+		else
+		{
+			IBufferProxy::SetVoidRange(Start, Count, Values);
+		}
+	}
+
 	template <typename T_REAL>
 	TSharedPtr<IBuffer> TAttributeBufferProxy<T_REAL>::GetBuffer() const
 	{
@@ -0,0 +1,135 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Data/Utils/PCGExColumnCache.h"
+
+#include "PCGData.h"
+#include "PCGExCoreSettingsCache.h"
+#include "PCGExLog.h"
+#include "PCGExSettingsCacheBody.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeRWLock.h"
+
+namespace PCGExData::ColumnCache
+{
+	struct FKey
+	{
+		uint64 DataUID = 0;
+		uint64 ColumnUID = 0;
+
+		bool operator==(const FKey& Other) const { return DataUID == Other.DataUID && ColumnUID == Other.ColumnUID; }
+		friend uint32 GetTypeHash(const FKey& Key) { return HashCombineFast(GetTypeHash(Key.DataUID), GetTypeHash(Key.ColumnUID)); }
+	};
+
+	struct FEntry
+	{
+		TSharedPtr<void> Column;
+		int64 Size = 0;
+		uint64 LastAccess = 0;
+	};
+
+	static FRWLock CacheLock;
+	static TMap<FKey, FEntry> Entries;
+	static FStats Stats;
+	static uint64 AccessCounter = 0;
+
+	static int64 GetBudget() { return static_cast<int64>(PCGEX_CORE_SETTINGS.ColumnCacheBudget) * 1024 * 1024; }
+
+	static void EvictUntilFits_Unsafe(const int64 InBudget)
+	{
+		// Linear scan for the least recently used entry; columns are coarse (one per attribute per data), so this stays cheap
+		while (Stats.UsedBytes > InBudget && !Entries.IsEmpty())
+		{
+			const FKey* Oldest = nullptr;
+			uint64 OldestAccess = MAX_uint64;
+
+			for (const TPair<FKey, FEntry>& Pair : Entries)
+			{
+				if (Pair.Value.LastAccess >= OldestAccess) { continue; }
+				OldestAccess = Pair.Value.LastAccess;
+				Oldest = &Pair.Key;
+			}
+
+			const FKey OldestKey = *Oldest;
+			Stats.UsedBytes -= Entries[OldestKey].Size;
+			Stats.Evictions++;
+			Entries.Remove(OldestKey);
+		}
+
+		Stats.NumColumns = Entries.Num();
+	}
+
+	bool IsEnabled()
+	{
+		return PCGEX_CORE_SETTINGS.ColumnCacheBudget > 0;
+	}
+
+	TSharedPtr<void> FindColumn(const UPCGData* InData, const uint64 ColumnUID)
+	{
+		if (!InData || !IsEnabled()) { return nullptr; }
+
+		FWriteScopeLock WriteLock(CacheLock);
+
+		FEntry* Entry = Entries.Find(FKey{InData->UID, ColumnUID});
+		if (!Entry)
+		{
+			Stats.Misses++;
+			return nullptr;
+		}
+
+		Stats.Hits++;
+		Entry->LastAccess = ++AccessCounter;
+		return Entry->Column;
+	}
+
+	void AddColumn(const UPCGData* InData, const uint64 ColumnUID, const TSharedPtr<void>& InColumn, const int64 InSize)
+	{
+		if (!InData || !InColumn || !IsEnabled()) { return; }
+
+		const int64 Budget = GetBudget();
+		if (InSize > Budget) { return; }
+
+		FWriteScopeLock WriteLock(CacheLock);
+
+		FEntry& Entry = Entries.FindOrAdd(FKey{InData->UID, ColumnUID});
+		Stats.UsedBytes += InSize - Entry.Size;
+
+		Entry.Column = InColumn;
+		Entry.Size = InSize;
+		Entry.LastAccess = ++AccessCounter;
+
+		EvictUntilFits_Unsafe(Budget);
+	}
+
+	FStats GetStats()
+	{
+		FReadScopeLock ReadLock(CacheLock);
+		return Stats;
+	}
+
+	void Flush()
+	{
+		FWriteScopeLock WriteLock(CacheLock);
+		Entries.Empty();
+		Stats.UsedBytes = 0;
+		Stats.NumColumns = 0;
+	}
+
+	static FAutoConsoleCommand CommandColumnCacheStats(
+		TEXT("pcgex.ColumnCache.Stats"),
+		TEXT("Logs attribute column cache usage & hit rate."),
+		FConsoleCommandDelegate::CreateLambda(
+			[]()
+			{
+				const FStats CurrentStats = GetStats();
+				UE_LOG(
+					LogPCGEx, Log, TEXT("Column cache : %d columns, %.2f MB / %d MB | %lld hits, %lld misses (%.1f%%) | %lld evictions"),
+					CurrentStats.NumColumns, static_cast<double>(CurrentStats.UsedBytes) / (1024.0 * 1024.0), PCGEX_CORE_SETTINGS.ColumnCacheBudget,
+					CurrentStats.Hits, CurrentStats.Misses, CurrentStats.GetHitRate() * 100, CurrentStats.Evictions);
+			}));
+
+	static FAutoConsoleCommand CommandColumnCacheFlush(
+		TEXT("pcgex.ColumnCache.Flush"),
+		TEXT("Releases all cached attribute columns."),
+		FConsoleCommandDelegate::CreateLambda([]() { Flush(); }));
+}
@@ -41,6 +41,9 @@ namespace PCGExDetails
 	template <typename T>
 	void TSettingValueBuffer<T>::ReadScope(const int32 Start, TArrayView<T> OutResults) { Buffer->Read(Start, OutResults); }
 
+	template <typename T>
+	TConstArrayView<T> TSettingValueBuffer<T>::ReadSpan(const PCGExMT::FScope& Scope, TArray<T>& Scratch) { return Buffer->ReadSpan(Scope, Scratch); }
+
 	template <typename T>
 	T TSettingValueBuffer<T>::Min() { return Buffer->Min; }
 
@@ -79,6 +82,13 @@ namespace PCGExDetails
 		for (int i = 0; i < Count; i++) { OutResults[i] = Constant; }
 	}
 
+	template <typename T>
+	TConstArrayView<T> TSettingValueConstant<T>::ReadSpan(const PCGExMT::FScope& Scope, TArray<T>& Scratch)
+	{
+		Scratch.Init(Constant, Scope.Count);
+		return Scratch;
+	}
+
 	template <typename T>
 	uint32 TSettingValueConstant<T>::ReadValueHash(const int32 Index) { return PCGExTypes::ComputeHash(Constant); }
 
@@ -0,0 +1,87 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "PCGExKDTree.h"
+
+#include <algorithm>
+#include "Core/PCGExMTCommon.h"
+
+namespace PCGExKDTree
+{
+	void FKDTree::Build(const TConstArrayView<FVector> InPositions, const TConstArrayView<int8> InMask)
+	{
+		Entries.Reset();
+
+		const int32 NumPositions = InPositions.Num();
+		const bool bUseMask = InMask.Num() == NumPositions;
+
+		Entries.Reserve(NumPositions);
+		for (int32 i = 0; i < NumPositions; i++)
+		{
+			if (bUseMask && !InMask[i]) { continue; }
+			Entries.Add(FEntry{InPositions[i], i});
+		}
+
+		BuildInternal();
+	}
+
+	void FKDTree::Build(const TConstArrayView<FVector> InPositions, const TConstArrayView<int32> InIndices)
+	{
+		check(InPositions.Num() == InIndices.Num());
+
+		const int32 NumPositions = InPositions.Num();
+		Entries.SetNumUninitialized(NumPositions);
+		for (int32 i = 0; i < NumPositions; i++) { Entries[i] = FEntry{InPositions[i], InIndices[i]}; }
+
+		BuildInternal();
+	}
+
+	void FKDTree::BuildInternal()
+	{
+		const int32 NumEntries = Entries.Num();
+		Axes.Init(0, NumEntries);
+
+		if (NumEntries <= LeafSize) { return; }
+
+		// Split level by level; all ranges of a given level are disjoint and can be partitioned in parallel
+		TArray<PCGExMT::FScope> Level;
+		TArray<PCGExMT::FScope> NextLevel;
+		Level.Emplace(0, NumEntries);
+
+		while (!Level.IsEmpty())
+		{
+			const int32 NumRanges = Level.Num();
+
+			PCGEX_PARALLEL_FOR_THRESHOLD(
+				NumRanges, 2,
+
+				const int32 Begin = Level[i].Start;
+				const int32 End = Level[i].End;
+
+				FBox Bounds(ForceInit);
+				for (int32 j = Begin; j < End; j++) { Bounds += Entries[j].Position; }
+
+				const FVector Extents = Bounds.GetExtent();
+				const uint8 Axis = Extents.X >= Extents.Y ? (Extents.X >= Extents.Z ? 0 : 2) : (Extents.Y >= Extents.Z ? 1 : 2);
+
+				const int32 Mid = Begin + (End - Begin) / 2;
+				FEntry* Data = Entries.GetData();
+				std::nth_element(
+					Data + Begin, Data + Mid, Data + End,
+					[Axis](const FEntry& A, const FEntry& B) { return A.Position[Axis] < B.Position[Axis]; });
+
+				Axes[Mid] = Axis;
+			)
+
+			NextLevel.Reset();
+			for (const PCGExMT::FScope& Range : Level)
+			{
+				const int32 Mid = Range.Start + Range.Count / 2;
+				if (Mid - Range.Start > LeafSize) { NextLevel.Emplace(Range.Start, Mid - Range.Start); }
+				if (Range.End - (Mid + 1) > LeafSize) { NextLevel.Emplace(Mid + 1, Range.End - (Mid + 1)); }
+			}
+
+			Swap(Level, NextLevel);
+		}
+	}
+}
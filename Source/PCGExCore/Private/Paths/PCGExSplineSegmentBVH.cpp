@@ -0,0 +1,212 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Paths/PCGExSplineSegmentBVH.h"
+
+#include <algorithm>
+#include "Data/PCGSplineStruct.h"
+
+namespace PCGExPaths
+{
+	namespace
+	{
+		/** Control points of the [U0, U1] portion of a cubic Bezier, through de Casteljau subdivision */
+		void GetBezierSubSpan(const FVector (&InPoints)[4], const double U0, const double U1, FVector (&OutPoints)[4])
+		{
+			auto SplitLeft = [](const FVector (&P)[4], const double U, FVector (&Out)[4])
+			{
+				const FVector P01 = FMath::Lerp(P[0], P[1], U);
+				const FVector P12 = FMath::Lerp(P[1], P[2], U);
+				const FVector P23 = FMath::Lerp(P[2], P[3], U);
+				const FVector P012 = FMath::Lerp(P01, P12, U);
+				const FVector P123 = FMath::Lerp(P12, P23, U);
+				Out[0] = P[0];
+				Out[1] = P01;
+				Out[2] = P012;
+				Out[3] = FMath::Lerp(P012, P123, U);
+			};
+
+			auto SplitRight = [](const FVector (&P)[4], const double U, FVector (&Out)[4])
+			{
+				const FVector P01 = FMath::Lerp(P[0], P[1], U);
+				const FVector P12 = FMath::Lerp(P[1], P[2], U);
+				const FVector P23 = FMath::Lerp(P[2], P[3], U);
+				const FVector P123 = FMath::Lerp(P12, P23, U);
+				Out[0] = FMath::Lerp(FMath::Lerp(P01, P12, U), P123, U);
+				Out[1] = P123;
+				Out[2] = P23;
+				Out[3] = P[3];
+			};
+
+			FVector Left[4];
+			SplitLeft(InPoints, U1, Left);
+			SplitRight(Left, U1 > 0 ? U0 / U1 : 0, OutPoints);
+		}
+	}
+
+	void FSplineSegmentBVH::Build(const FPCGSplineStruct& InSpline, const int32 InSamplesPerSegment)
+	{
+		Spline = &InSpline;
+		Transform = InSpline.GetTransform();
+
+		Samples.Reset();
+		Edges.Reset();
+		Nodes.Reset();
+		ErrorMargin = 0;
+
+		const FInterpCurveVector& Curve = InSpline.GetSplinePointsPosition();
+		const int32 NumPoints = Curve.Points.Num();
+		const int32 NumSegments = Curve.bIsLooped ? NumPoints : NumPoints - 1;
+		if (NumSegments <= 0) { return; }
+
+		const int32 SamplesPerSegment = FMath::Max(1, InSamplesPerSegment);
+
+		// Polyline LUT
+		Samples.Reserve(NumSegments * SamplesPerSegment + 1);
+		for (int32 s = 0; s < NumSegments; s++)
+		{
+			const double StartKey = Curve.Points[s].InVal;
+			const double EndKey = s == NumPoints - 1 ? Curve.Points[s].InVal + Curve.LoopKeyOffset : Curve.Points[s + 1].InVal;
+
+			// A constant segment holds its start value and jumps to the next one at its end key; index it as points
+			// so no edge bridges the jump, the end value is indexed by the next segment's first sample
+			const bool bCollapsed = Curve.Points[s].InterpMode == CIM_Constant;
+
+			for (int32 j = 0; j < SamplesPerSegment; j++)
+			{
+				const double Key = FMath::Lerp(StartKey, EndKey, static_cast<double>(j) / SamplesPerSegment);
+				Samples.Add(FSample{Curve.Eval(static_cast<float>(Key)), Key, s, bCollapsed});
+			}
+		}
+
+		const double LastKey = Curve.bIsLooped ? Curve.Points.Last().InVal + Curve.LoopKeyOffset : Curve.Points.Last().InVal;
+		Samples.Add(FSample{Curve.Eval(static_cast<float>(LastKey)), LastKey, NumSegments - 1, true});
+
+		// The last sample only needs its own point edge if the last segment doesn't reach it, and no other segment starts there
+		const bool bIndexLastSample = !Curve.bIsLooped && Curve.Points[NumSegments - 1].InterpMode == CIM_Constant;
+		const int32 NumEdges = Samples.Num() - (bIndexLastSample ? 0 : 1);
+
+		Edges.SetNumUninitialized(NumEdges);
+		for (int32 i = 0; i < NumEdges; i++) { Edges[i] = i; }
+
+		// Bound how far the curve strays from the polyline.
+		// Each curved segment is converted to its Bezier form; every edge sub-span lies within the hull of its own control points,
+		// so the farthest sub-span control point from the edge is a conservative bound on the deviation.
+		// Linear segments lie on their edges, constant ones are indexed as points on the curve.
+		double MaxDeviationSquared = 0;
+		for (int32 s = 0; s < NumSegments; s++)
+		{
+			const FInterpCurvePoint<FVector>& Prev = Curve.Points[s];
+			if (Prev.InterpMode == CIM_Linear || Prev.InterpMode == CIM_Constant) { continue; }
+
+			const FInterpCurvePoint<FVector>& Next = Curve.Points[s == NumPoints - 1 ? 0 : s + 1];
+			const double Diff = s == NumPoints - 1 ? Curve.LoopKeyOffset : Next.InVal - Prev.InVal;
+
+			const FVector Bezier[4] = {Prev.OutVal, Prev.OutVal + Prev.LeaveTangent * (Diff / 3), Next.OutVal - Next.ArriveTangent * (Diff / 3), Next.OutVal};
+
+			for (int32 j = 0; j < SamplesPerSegment; j++)
+			{
+				const int32 Edge = s * SamplesPerSegment + j;
+				const FVector& A = Samples[Edge].Position;
+				const FVector& B = Samples[Edge + 1].Position;
+
+				FVector SubSpan[4];
+				GetBezierSubSpan(Bezier, static_cast<double>(j) / SamplesPerSegment, static_cast<double>(j + 1) / SamplesPerSegment, SubSpan);
+
+				// Sub-span endpoints are measured against the samples themselves, to absorb float evaluation differences
+				MaxDeviationSquared = FMath::Max(
+					MaxDeviationSquared, FMath::Max(
+						FMath::Max(FVector::DistSquared(SubSpan[0], A), FVector::DistSquared(SubSpan[3], B)),
+						FMath::Max(FMath::PointDistToSegmentSquared(SubSpan[1], A, B), FMath::PointDistToSegmentSquared(SubSpan[2], A, B))));
+			}
+		}
+
+		ErrorMargin = FMath::Sqrt(MaxDeviationSquared) + UE_KINDA_SMALL_NUMBER;
+
+		// BVH, median split on the longest axis of edges centers
+		auto GetEdgeBounds = [&](const int32 Begin, const int32 End)
+		{
+			FBox Bounds(ForceInit);
+			for (int32 i = Begin; i < End; i++)
+			{
+				Bounds += Samples[Edges[i]].Position;
+				Bounds += GetEdgeEnd(Edges[i]);
+			}
+			return Bounds;
+		};
+
+		Nodes.Reserve(FMath::Max(1, 2 * NumEdges / LeafSize));
+		Nodes.Add(FNode{GetEdgeBounds(0, NumEdges), 0, NumEdges});
+
+		TArray<int32> Stack;
+		Stack.Add(0);
+
+		while (!Stack.IsEmpty())
+		{
+			const int32 NodeIndex = Stack.Pop(EAllowShrinking::No);
+			const FNode Node = Nodes[NodeIndex];
+
+			if (Node.End - Node.Begin <= LeafSize) { continue; }
+
+			const FVector Extents = Node.Bounds.GetExtent();
+			const int32 Axis = Extents.X >= Extents.Y ? (Extents.X >= Extents.Z ? 0 : 2) : (Extents.Y >= Extents.Z ? 1 : 2);
+
+			const int32 Mid = Node.Begin + (Node.End - Node.Begin) / 2;
+			int32* Data = Edges.GetData();
+			std::nth_element(
+				Data + Node.Begin, Data + Mid, Data + Node.End,
+				[&](const int32 A, const int32 B) { return (Samples[A].Position[Axis] + GetEdgeEnd(A)[Axis]) < (Samples[B].Position[Axis] + GetEdgeEnd(B)[Axis]); });
+
+			const int32 Left = Nodes.Add(FNode{GetEdgeBounds(Node.Begin, Mid), Node.Begin, Mid});
+			const int32 Right = Nodes.Add(FNode{GetEdgeBounds(Mid, Node.End), Mid, Node.End});
+
+			Nodes[NodeIndex].Left = Left;
+			Nodes[NodeIndex].Right = Right;
+
+			Stack.Add(Left);
+			Stack.Add(Right);
+		}
+	}
+
+	double FSplineSegmentBVH::FindClosestKey(const FVector& WorldPosition) const
+	{
+		check(IsValid())
+
+		const FVector LocalPosition = Transform.InverseTransformPosition(WorldPosition);
+
+		// Closest polyline edge
+		double BestDistSquared = MAX_dbl;
+		Traverse(
+			LocalPosition, [&]() { return BestDistSquared; },
+			[&](const int32 Edge, const double DistSquared) { BestDistSquared = FMath::Min(BestDistSquared, DistSquared); });
+
+		// The closest curve point is at most one margin farther than the best edge, and its own edge at most one margin closer than it;
+		// any spline segment with an edge within twice the margin of the best one may hold the actual closest point
+		const double Cutoff = FMath::Square(FMath::Sqrt(BestDistSquared) + 2 * ErrorMargin);
+
+		TArray<int32, TInlineAllocator<8>> Candidates;
+		Traverse(
+			LocalPosition, [&]() { return Cutoff; },
+			[&](const int32 Edge, const double DistSquared) { if (DistSquared <= Cutoff) { Candidates.AddUnique(Samples[Edge].Segment); } });
+
+		// Refine on candidate segments only, in segment order so ties resolve like a full search would
+		Candidates.Sort();
+
+		const FInterpCurveVector& Curve = Spline->GetSplinePointsPosition();
+		float BestKey = Curve.Points[0].InVal;
+		float BestSegmentDistSquared = MAX_flt;
+
+		for (const int32 Segment : Candidates)
+		{
+			float SegmentDistSquared = MAX_flt;
+			const float Key = Curve.FindNearestOnSegment(LocalPosition, Segment, SegmentDistSquared);
+			if (SegmentDistSquared < BestSegmentDistSquared)
+			{
+				BestSegmentDistSquared = SegmentDistSquared;
+				BestKey = Key;
+			}
+		}
+
+		return BestKey;
+	}
+}
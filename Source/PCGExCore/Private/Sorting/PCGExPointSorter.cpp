@@ -10,6 +10,7 @@
 #include "Data/PCGExProxyData.h"
 #include "Data/PCGExProxyDataHelpers.h"
 #include "Sorting/PCGExSortingDetails.h"
+#include "Sorting/PCGExSortingHelpers.h"
 
 namespace PCGExSorting
 {
@@ -425,5 +426,35 @@ namespace PCGExSorting
 		return Cache;
 	}
 
+	void FSortCache::SortIndices(TArray<int32>& InOutIndices) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FSortCache::SortIndices);
+
+		const int32 N = InOutIndices.Num();
+		if (N <= 1) { return; }
+
+		TArray<PCGEx::FIndexKey> Keys;
+		Keys.SetNumUninitialized(N);
+
+		// LSD over rules: each pass is stable, so the first rule ends up primary and later rules break its ties
+		for (int32 RuleIdx = CachedNumRules - 1; RuleIdx >= 0; RuleIdx--)
+		{
+			const FRuleCache& Rule = Rules[RuleIdx];
+			const double* Values = Rule.Values.GetData();
+			const double Tolerance = Rule.Tolerance;
+			const bool bFlip = Rule.bInvertRule != bDescending;
+
+			PCGEX_PARALLEL_FOR(
+				N,
+				const int32 Index = InOutIndices[i];
+				Keys[i] = PCGEx::FIndexKey(Index, GetNormalizedKey(Values[Index], Tolerance, bFlip));
+			)
+
+			PCGExSortingHelpers::ParallelRadixSort(Keys);
+
+			PCGEX_PARALLEL_FOR(N, InOutIndices[i] = Keys[i].Index;)
+		}
+	}
+
 #pragma endregion
 }
@@ -0,0 +1,108 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Data/PCGExData.h"
+
+BEGIN_DEFINE_SPEC(FPCGExDirtyBlocksSpec, "PCGEx.Core.Data.DirtyBlocks", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+	static constexpr int32 NumValues = 2000; // Not a multiple of the block size, last block is partial
+	static constexpr int32 BlockSize = 1 << PCGExData::FDirtyBlocks::BlockShift;
+
+	// Index of the range covering Index, -1 if none
+	static int32 FindRange(const TArray<PCGExMT::FScope>& Ranges, const int32 Index)
+	{
+		for (int32 i = 0; i < Ranges.Num(); i++) { if (Index >= Ranges[i].Start && Index < Ranges[i].End) { return i; } }
+		return -1;
+	}
+
+END_DEFINE_SPEC(FPCGExDirtyBlocksSpec)
+
+void FPCGExDirtyBlocksSpec::Define()
+{
+	Describe("GetRanges", [this]()
+	{
+		It("returns nothing for clean blocks", [this]()
+		{
+			PCGExData::FDirtyBlocks DirtyBlocks;
+			DirtyBlocks.Init(NumValues, false);
+
+			TArray<PCGExMT::FScope> Ranges;
+			DirtyBlocks.GetRanges(NumValues, Ranges);
+			TestEqual(TEXT("Range count"), Ranges.Num(), 0);
+		});
+
+		It("returns the whole buffer once when everything is dirty", [this]()
+		{
+			PCGExData::FDirtyBlocks DirtyBlocks;
+			DirtyBlocks.Init(NumValues, true);
+
+			TArray<PCGExMT::FScope> Ranges;
+			DirtyBlocks.GetRanges(NumValues, Ranges);
+			if (!TestEqual(TEXT("Range count"), Ranges.Num(), 1)) { return; }
+			TestEqual(TEXT("Start"), Ranges[0].Start, 0);
+			TestEqual(TEXT("End"), Ranges[0].End, NumValues);
+		});
+
+		It("only covers blocks touched by a masked write", [this]()
+		{
+			PCGExData::FDirtyBlocks DirtyBlocks;
+			DirtyBlocks.Init(NumValues, false);
+
+			// Sparse per-index writes, plus a scope write that straddles a block boundary and one in the partial last block
+			TBitArray<> Written(false, NumValues);
+			for (int32 i = 3; i < NumValues; i += 701)
+			{
+				Written[i] = true;
+				DirtyBlocks.Mark(i);
+			}
+
+			const PCGExMT::FScope Scope(BlockSize * 4 - 2, 5);
+			for (int32 i = Scope.Start; i < Scope.End; i++) { Written[i] = true; }
+			DirtyBlocks.Mark(Scope);
+
+			Written[NumValues - 1] = true;
+			DirtyBlocks.Mark(NumValues - 1);
+
+			TArray<PCGExMT::FScope> Ranges;
+			DirtyBlocks.GetRanges(NumValues, Ranges);
+
+			for (int32 i = 0; i < NumValues; i++)
+			{
+				if (Written[i] && FindRange(Ranges, i) == -1) { AddError(FString::Printf(TEXT("Written index %d is not committed."), i)); }
+			}
+
+			for (const PCGExMT::FScope& Range : Ranges)
+			{
+				TestTrue(TEXT("Range is within the buffer"), Range.Start >= 0 && Range.End <= NumValues && Range.Count > 0);
+
+				// Every committed block must hold at least one written value
+				for (int32 BlockStart = Range.Start; BlockStart < Range.End; BlockStart += BlockSize)
+				{
+					bool bBlockWritten = false;
+					for (int32 i = BlockStart; i < FMath::Min(BlockStart + BlockSize, NumValues); i++) { bBlockWritten |= Written[i]; }
+					if (!bBlockWritten) { AddError(FString::Printf(TEXT("Untouched block at %d is committed."), BlockStart)); }
+				}
+			}
+
+			// Adjacent dirty blocks are merged
+			for (int32 i = 1; i < Ranges.Num(); i++) { TestTrue(TEXT("Ranges are disjoint and not adjacent"), Ranges[i].Start > Ranges[i - 1].End); }
+		});
+
+		It("is clean again after a commit", [this]()
+		{
+			PCGExData::FDirtyBlocks DirtyBlocks;
+			DirtyBlocks.Init(NumValues, false);
+			DirtyBlocks.Mark(42);
+			DirtyBlocks.Clear();
+
+			TArray<PCGExMT::FScope> Ranges;
+			DirtyBlocks.GetRanges(NumValues, Ranges);
+			TestEqual(TEXT("Range count"), Ranges.Num(), 0);
+		});
+	});
+}
+
+#endif
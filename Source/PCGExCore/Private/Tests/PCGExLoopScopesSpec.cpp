@@ -0,0 +1,90 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Core/PCGExMT.h"
+
+BEGIN_DEFINE_SPEC(FPCGExLoopScopesSpec, "PCGEx.Core.MT.LoopScopes", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+	// Scopes must cover [0, NumIterations) exactly once, in order, with consistent loop indices
+	void TestTiling(const FString& What, const TArray<PCGExMT::FScope>& Loops, const int32 NumIterations)
+	{
+		int32 Cursor = 0;
+		for (int32 i = 0; i < Loops.Num(); i++)
+		{
+			const PCGExMT::FScope& Scope = Loops[i];
+			if (Scope.Start != Cursor || Scope.Count <= 0 || Scope.End != Scope.Start + Scope.Count || Scope.LoopIndex != i)
+			{
+				AddError(FString::Printf(TEXT("%s : scope #%d [%d, %d) doesn't follow %d."), *What, i, Scope.Start, Scope.End, Cursor));
+				return;
+			}
+			Cursor = Scope.End;
+		}
+
+		TestEqual(What + TEXT(" : covered iterations"), Cursor, NumIterations);
+	}
+
+END_DEFINE_SPEC(FPCGExLoopScopesSpec)
+
+void FPCGExLoopScopesSpec::Define()
+{
+	static const int32 IterationCounts[] = {1, 7, 1000, 4096, 100003};
+
+	Describe("GetAdaptiveScopeSize", [this]()
+	{
+		It("produces scopes that tile the loop, with at least one scope per core", [this]()
+		{
+			static const double Costs[] = {0, 1e-9, 1e-6, 1e-3, 1};
+			static const int32 CoreCounts[] = {1, 8, 32};
+
+			for (const int32 NumIterations : IterationCounts)
+			{
+				for (const double Cost : Costs)
+				{
+					for (const int32 NumCores : CoreCounts)
+					{
+						const FString What = FString::Printf(TEXT("N=%d, Cost=%g, Cores=%d"), NumIterations, Cost, NumCores);
+
+						const int32 ScopeSize = PCGExMT::GetAdaptiveScopeSize(NumIterations, Cost, 0.001, NumCores);
+						if (!TestTrue(What + TEXT(" : scope size is positive"), ScopeSize >= 1)) { continue; }
+
+						TArray<PCGExMT::FScope> Loops;
+						const int32 NumLoops = PCGExMT::SubLoopScopes(Loops, NumIterations, ScopeSize);
+
+						TestEqual(What + TEXT(" : returned scope count"), NumLoops, Loops.Num());
+						TestTrue(What + TEXT(" : one scope per core"), NumLoops >= FMath::Min(NumIterations, NumCores));
+						TestTiling(What, Loops, NumIterations);
+					}
+				}
+			}
+		});
+
+		It("fits the target duration when there is enough work", [this]()
+		{
+			// 1µs per iteration, 1ms target : 1000 iterations per scope
+			TestEqual(TEXT("Scope size"), PCGExMT::GetAdaptiveScopeSize(1000000, 1e-6, 0.001, 8), 1000);
+		});
+	});
+
+	Describe("GetSanitizedBatchSize", [this]()
+	{
+		It("produces scopes that tile the loop", [this]()
+		{
+			static const int32 ChunkSizes[] = {1, 32, 128, 1024, 4096};
+
+			for (const int32 NumIterations : IterationCounts)
+			{
+				for (const int32 ChunkSize : ChunkSizes)
+				{
+					TArray<PCGExMT::FScope> Loops;
+					PCGExMT::SubLoopScopes(Loops, NumIterations, PCGExMT::GetSanitizedBatchSize(NumIterations, ChunkSize));
+					TestTiling(FString::Printf(TEXT("N=%d, Chunk=%d"), NumIterations, ChunkSize), Loops, NumIterations);
+				}
+			}
+		});
+	});
+}
+
+#endif
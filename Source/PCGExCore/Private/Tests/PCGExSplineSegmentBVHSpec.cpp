@@ -0,0 +1,104 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Components/SplineComponent.h"
+#include "Data/PCGSplineStruct.h"
+#include "Paths/PCGExSplineSegmentBVH.h"
+
+BEGIN_DEFINE_SPEC(FPCGExSplineSegmentBVHSpec, "PCGEx.Core.Paths.SplineSegmentBVH", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+	static FPCGSplineStruct MakeSpline(const TArray<FVector>& Positions, const TArray<ESplinePointType::Type>& Types, const FVector& Tangent, const bool bClosedLoop)
+	{
+		TArray<FSplinePoint> SplinePoints;
+		SplinePoints.SetNum(Positions.Num());
+		for (int32 i = 0; i < Positions.Num(); i++)
+		{
+			SplinePoints[i] = FSplinePoint(static_cast<float>(i), Positions[i], Tangent, Tangent, FRotator::ZeroRotator, FVector::OneVector, Types[i % Types.Num()]);
+		}
+
+		FPCGSplineStruct Spline;
+		Spline.Initialize(SplinePoints, bClosedLoop, FTransform::Identity);
+		return Spline;
+	}
+
+	static double GetDistance(const FPCGSplineStruct& Spline, const FVector& Position, const double Key)
+	{
+		return FVector::Dist(Position, Spline.GetSplinePointsPosition().Eval(static_cast<float>(Key)));
+	}
+
+	// The BVH must never return a point farther than the full-curve reference search does
+	void TestAgainstReference(const FString& What, const FPCGSplineStruct& Spline, const int32 SamplesPerSegment)
+	{
+		PCGExPaths::FSplineSegmentBVH BVH;
+		BVH.Build(Spline, SamplesPerSegment);
+		if (!TestTrue(What + TEXT(" : BVH is valid"), BVH.IsValid())) { return; }
+
+		const FBox Bounds = Spline.GetBounds().ExpandBy(500);
+		FRandomStream Random(1337);
+
+		int32 NumFailures = 0;
+		for (int32 i = 0; i < 2000; i++)
+		{
+			const FVector Position = Random.RandPointInBox(Bounds);
+			const double Dist = GetDistance(Spline, Position, BVH.FindClosestKey(Position));
+			const double RefDist = GetDistance(Spline, Position, Spline.FindInputKeyClosestToWorldLocation(Position));
+
+			if (Dist > RefDist + 0.01 && NumFailures++ < 5)
+			{
+				AddError(FString::Printf(TEXT("%s : query %s is %f away from the BVH result, %f from the reference."), *What, *Position.ToString(), Dist, RefDist));
+			}
+		}
+
+		TestEqual(What + TEXT(" : queries farther than the reference"), NumFailures, 0);
+	}
+
+END_DEFINE_SPEC(FPCGExSplineSegmentBVHSpec)
+
+void FPCGExSplineSegmentBVHSpec::Define()
+{
+	const TArray<FVector> Zigzag = {
+		FVector(0, 0, 0), FVector(400, 300, 50), FVector(800, -200, 0), FVector(1200, 350, -80),
+		FVector(1500, 0, 0), FVector(1100, -600, 40), FVector(300, -500, 0)
+	};
+
+	Describe("FindClosestKey", [this, Zigzag]()
+	{
+		It("matches the reference search on curved splines", [this, Zigzag]()
+		{
+			const TArray<ESplinePointType::Type> Types = {ESplinePointType::CurveCustomTangent};
+			TestAgainstReference(TEXT("Open"), MakeSpline(Zigzag, Types, FVector(600, 400, 0), false), 8);
+			TestAgainstReference(TEXT("Closed"), MakeSpline(Zigzag, Types, FVector(600, 400, 0), true), 8);
+			TestAgainstReference(TEXT("Coarse"), MakeSpline(Zigzag, Types, FVector(1200, -900, 300), false), 2);
+		});
+
+		It("matches the reference search on mixed linear & constant splines", [this, Zigzag]()
+		{
+			const TArray<ESplinePointType::Type> Types = {ESplinePointType::Constant, ESplinePointType::CurveCustomTangent, ESplinePointType::Linear};
+			TestAgainstReference(TEXT("Mixed open"), MakeSpline(Zigzag, Types, FVector(300, 300, 0), false), 4);
+			TestAgainstReference(TEXT("Mixed closed"), MakeSpline(Zigzag, Types, FVector(300, 300, 0), true), 4);
+
+			// Last segment constant, its end value is only reachable through the last sample
+			TestAgainstReference(TEXT("Constant tail"), MakeSpline(Zigzag, {ESplinePointType::Constant}, FVector::ZeroVector, false), 4);
+		});
+
+		It("doesn't treat a constant segment jump as part of the curve", [this]()
+		{
+			// Constant from A to B, then a linear run back above the jump; the query sits right on the jump
+			const FPCGSplineStruct Spline = MakeSpline(
+				{FVector(0, 0, 0), FVector(1000, 0, 0), FVector(1000, 300, 0), FVector(0, 300, 0)},
+				{ESplinePointType::Constant, ESplinePointType::Linear, ESplinePointType::Linear, ESplinePointType::Linear},
+				FVector::ZeroVector, false);
+
+			PCGExPaths::FSplineSegmentBVH BVH;
+			BVH.Build(Spline, 4);
+
+			const FVector Position(500, 10, 0);
+			TestEqual(TEXT("Distance to the closest curve point"), GetDistance(Spline, Position, BVH.FindClosestKey(Position)), 290.0, 0.01);
+		});
+	});
+}
+
+#endif
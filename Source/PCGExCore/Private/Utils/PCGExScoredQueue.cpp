@@ -0,0 +1,187 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Utils/PCGExScoredQueue.h"
+
+namespace PCGEx
+{
+	namespace ScoredQueue
+	{
+		void FBinaryHeap::Init(const int32 InSize)
+		{
+			Heap.Reserve(InSize);
+			HeapIndex.Init(-1, InSize);
+			Size = 0;
+		}
+
+		void FBinaryHeap::Reset()
+		{
+			for (int32 i = 0; i < Size; i++) { HeapIndex[Heap[i].Value] = -1; }
+			Size = 0;
+		}
+
+		void FQuaternaryHeap::Init(const int32 InSize)
+		{
+			Keys.Reserve(InSize);
+			Values.Reserve(InSize);
+			HeapIndex.Init(-1, InSize);
+			Size = 0;
+		}
+
+		void FQuaternaryHeap::Reset()
+		{
+			for (int32 i = 0; i < Size; i++) { HeapIndex[Values[i]] = -1; }
+			Size = 0;
+		}
+
+		void FRadixHeap::Init(const int32 InSize)
+		{
+			Queued.Init(false, InSize);
+			Last = 0;
+			Size = 0;
+		}
+
+		void FRadixHeap::Refill(const TStampedArray<double>& Scores)
+		{
+			for (int32 b = 1; b < NumBuckets; b++)
+			{
+				TArray<FEntry>& Bucket = Buckets[b];
+				if (Bucket.IsEmpty()) { continue; }
+
+				uint64 MinKey = MAX_uint64;
+				for (const FEntry& Entry : Bucket) { if (IsLive(Entry, Scores)) { MinKey = FMath::Min(MinKey, Entry.Key); } }
+
+				if (MinKey == MAX_uint64)
+				{
+					// Only outdated entries left in there
+					Bucket.Reset();
+					continue;
+				}
+
+				Last = MinKey;
+
+				// Every live entry lands in a strictly lower bucket, at least one of them in bucket 0
+				for (const FEntry& Entry : Bucket) { if (IsLive(Entry, Scores)) { Buckets[BucketIndex(Entry.Key)].Add(Entry); } }
+
+				Bucket.Reset();
+				return;
+			}
+		}
+
+		void FRadixHeap::Reset()
+		{
+			for (TArray<FEntry>& Bucket : Buckets)
+			{
+				for (const FEntry& Entry : Bucket) { Queued[Entry.Index] = false; }
+				Bucket.Reset();
+			}
+
+			Last = 0;
+			Size = 0;
+		}
+
+		void FBucketQueue::Init(const int32 InSize, const double InBucketWidth)
+		{
+			BucketOf.Init(-1, InSize);
+			InvWidth = 1 / FMath::Max(InBucketWidth, UE_DOUBLE_SMALL_NUMBER);
+			Cursor = 0;
+			Size = 0;
+		}
+
+		void FBucketQueue::Advance()
+		{
+			const int32 NumBuckets = Buckets.Num();
+			while (Cursor < NumBuckets)
+			{
+				TArray<int32>& Bucket = Buckets[Cursor];
+				for (int32 i = Bucket.Num() - 1; i >= 0; i--)
+				{
+					if (BucketOf[Bucket[i]] != Cursor) { Bucket.RemoveAtSwap(i, 1, EAllowShrinking::No); }
+				}
+
+				if (!Bucket.IsEmpty()) { return; }
+				Cursor++;
+			}
+		}
+
+		bool FBucketQueue::Pop(int32& OutItem, double& OutScore, const TStampedArray<double>& Scores)
+		{
+			if (Size == 0) { return false; }
+
+			Advance();
+			check(Cursor < Buckets.Num())
+
+			TArray<int32>& Bucket = Buckets[Cursor];
+
+			int32 Best = 0;
+			double BestScore = Scores[Bucket[0]];
+			for (int32 i = 1; i < Bucket.Num(); i++)
+			{
+				const double Score = Scores[Bucket[i]];
+				if (Score < BestScore || (Score == BestScore && Bucket[i] < Bucket[Best]))
+				{
+					BestScore = Score;
+					Best = i;
+				}
+			}
+
+			OutItem = Bucket[Best];
+			OutScore = BestScore;
+
+			Bucket.RemoveAtSwap(Best, 1, EAllowShrinking::No);
+			BucketOf[OutItem] = -1;
+			Size--;
+
+			return true;
+		}
+
+		void FBucketQueue::Reset()
+		{
+			for (TArray<int32>& Bucket : Buckets)
+			{
+				for (const int32 Index : Bucket) { BucketOf[Index] = -1; }
+				Bucket.Reset();
+			}
+
+			Cursor = 0;
+			Size = 0;
+		}
+	}
+
+	FScoredQueue::FScoredQueue(const int32 InSize, const EScoredQueueBackend InBackend, const double InBucketWidth)
+		: Backend(InBackend)
+	{
+		Scores.Init(MAX_dbl, InSize);
+
+		switch (Backend)
+		{
+		default:
+		case EScoredQueueBackend::BinaryHeap: BinaryHeap.Init(InSize);
+			break;
+		case EScoredQueueBackend::QuaternaryHeap: QuaternaryHeap.Init(InSize);
+			break;
+		case EScoredQueueBackend::RadixHeap: RadixHeap.Init(InSize);
+			break;
+		case EScoredQueueBackend::BucketQueue: BucketQueue.Init(InSize, InBucketWidth);
+			break;
+		}
+	}
+
+	void FScoredQueue::Reset()
+	{
+		switch (Backend)
+		{
+		default:
+		case EScoredQueueBackend::BinaryHeap: BinaryHeap.Reset();
+			break;
+		case EScoredQueueBackend::QuaternaryHeap: QuaternaryHeap.Reset();
+			break;
+		case EScoredQueueBackend::RadixHeap: RadixHeap.Reset();
+			break;
+		case EScoredQueueBackend::BucketQueue: BucketQueue.Reset();
+			break;
+		}
+
+		Scores.Reset();
+	}
+}
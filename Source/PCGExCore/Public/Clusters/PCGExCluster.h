@@ -5,10 +5,12 @@
 
 #include "CoreMinimal.h"
 #include "PCGExClusterCache.h"
+#include "PCGExClusterAdjacency.h"
 #include "PCGExEdge.h"
 #include "PCGExNode.h"
 #include "PCGExClusterCommon.h"
 #include "PCGExOctree.h"
+#include "PCGExKDTree.h"
 #include "Containers/PCGExIndexLookup.h"
 #include "Helpers/PCGExArrayHelpers.h"
 #include "Utils/PCGValueRange.h"
@@ -61,6 +63,8 @@ namespace PCGExClusters
 
 		TMap<FName, TSharedPtr<ICachedClusterData>> CachedData;
 
+		mutable TSharedPtr<const FClusterAdjacency> Adjacency;
+
 		// Internal helpers for O(1) visited tracking (uses TBitArray instead of TArray::Contains)
 		void GetConnectedNodesInternal(const int32 FromIndex, TArray<int32>& OutIndices, TBitArray<>& Visited, const int32 SearchDepth) const;
 		void GetConnectedNodesInternal(const int32 FromIndex, TArray<int32>& OutIndices, TBitArray<>& Visited, const int32 SearchDepth, const TSet<int32>& Skip) const;
@@ -76,6 +80,7 @@ namespace PCGExClusters
 
 		bool bValid = false;
 		bool bIsOneToOne = false; // Whether the input data has a single set of edges for a single set of vtx
+		bool bBuiltFromTopology = false; // Whether the cluster has been rehydrated from a persisted topology payload
 
 		int32 ClusterID = -1;
 		TSharedPtr<PCGEx::FIndexLookup> NodeIndexLookup; // Point Index -> Node index
@@ -96,6 +101,7 @@ namespace PCGExClusters
 
 		TSharedPtr<PCGExOctree::FItemOctree> NodeOctree;
 		TSharedPtr<PCGExOctree::FItemOctree> EdgeOctree;
+		TSharedPtr<PCGExKDTree::FKDTree> NodeKDTree; // Compact alternative to NodeOctree for nearest/radius queries on node positions
 
 		/**
 		 * Get cached data by key, optionally validating context hash.
@@ -120,6 +126,12 @@ namespace PCGExClusters
 		void SetCachedData(FName Key, const TSharedPtr<ICachedClusterData>& Data);
 		void ClearCachedData();
 
+		/**
+		 * Get the packed (CSR) adjacency of this cluster, built on first request.
+		 * Node links are only ever set while building the cluster, so the view stays valid for the cluster lifetime.
+		 */
+		TSharedPtr<const FClusterAdjacency> GetAdjacency() const;
+
 		FCluster(const TSharedPtr<PCGExData::FPointIO>& InVtxIO, const TSharedPtr<PCGExData::FPointIO>& InEdgesIO, const TSharedPtr<PCGEx::FIndexLookup>& InNodeIndexLookup);
 		FCluster(const TSharedRef<FCluster>& OtherCluster, const TSharedPtr<PCGExData::FPointIO>& InVtxIO, const TSharedPtr<PCGExData::FPointIO>& InEdgesIO, const TSharedPtr<PCGEx::FIndexLookup>& InNodeIndexLookup, bool bCopyNodes, bool bCopyEdges, bool bCopyLookup);
 
@@ -166,6 +178,13 @@ namespace PCGExClusters
 		~FCluster();
 
 		bool BuildFrom(const TMap<uint32, int32>& InEndpointsLookup, const TArray<int32>* InExpectedAdjacency);
+
+		/**
+		 * Rehydrate the cluster from a persisted topology payload (see PCGExClusters::Topology), skipping endpoints resolution.
+		 * Each payload edge is still checked against the packed edge endpoints & vtx ids, so reordered or replaced vtx are caught.
+		 * @return false if the payload is missing, stale or corrupted; the cluster and its lookup entries are left untouched.
+		 */
+		bool BuildFromTopology(const TConstArrayView<uint8> InPayload, const TArray<int32>* InExpectedAdjacency);
 		void BuildFromSubgraphData(const TSharedPtr<PCGExData::FFacade>& InVtxFacade, const TSharedPtr<PCGExData::FFacade>& InEdgeFacade, const TArray<FEdge>& InEdges, const int32 InNumNodes);
 
 		bool IsValidWith(const TSharedRef<PCGExData::FPointIO>& InVtxIO, const TSharedRef<PCGExData::FPointIO>& InEdgesIO) const;
@@ -249,11 +268,19 @@ namespace PCGExClusters
 
 		TSharedPtr<PCGExOctree::FItemOctree> GetNodeOctree();
 		TSharedPtr<PCGExOctree::FItemOctree> GetEdgeOctree();
+		TSharedPtr<PCGExKDTree::FKDTree> GetNodeKDTree();
 
 		void RebuildNodeOctree();
 		void RebuildEdgeOctree();
+		void RebuildNodeKDTree();
 		void RebuildOctree(EPCGExClusterClosestSearchMode Mode, const bool bForceRebuild = false);
 
+		/**
+		 * Build the spatial index FindClosestNode relies on for a given mode.
+		 * Vtx mode uses the node KD-tree rather than the node octree; use RebuildOctree if you need to query NodeOctree directly.
+		 */
+		void RebuildSearchIndex(EPCGExClusterClosestSearchMode Mode, const bool bForceRebuild = false);
+
 		void GatherNodesPointIndices(TArray<int32>& OutValidNodesPointIndices, const bool bValidity) const;
 
 		int32 FindClosestNode(const FVector& Position, EPCGExClusterClosestSearchMode Mode, const int32 MinNeighbors = 0) const;
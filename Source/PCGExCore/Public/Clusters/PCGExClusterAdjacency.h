@@ -0,0 +1,40 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGExLink.h"
+
+namespace PCGExClusters
+{
+	struct FNode;
+
+	/**
+	 * Compressed sparse row view of a cluster adjacency.
+	 * Links of node N are packed in Links[Offsets[N], Offsets[N + 1]), in the same order as FNode::Links, so the
+	 * flat index of a link (Offsets[N] + i) can be used to address any per-link table built by walking nodes in order.
+	 * Immutable once built; iterating neighbors is a linear scan over a single array instead of a jump per node.
+	 */
+	class PCGEXCORE_API FClusterAdjacency : public TSharedFromThis<FClusterAdjacency>
+	{
+	public:
+		TArray<int32> Offsets; // NumNodes + 1 entries, first flat link of each node
+		TArray<PCGExGraphs::FLink> Links;
+
+		FORCEINLINE int32 NumNodes() const { return Offsets.Num() - 1; }
+		FORCEINLINE int32 NumLinks() const { return Links.Num(); }
+
+		FORCEINLINE int32 GetOffset(const int32 NodeIndex) const { return Offsets[NodeIndex]; }
+		FORCEINLINE int32 Num(const int32 NodeIndex) const { return Offsets[NodeIndex + 1] - Offsets[NodeIndex]; }
+		FORCEINLINE TConstArrayView<PCGExGraphs::FLink> GetLinks(const int32 NodeIndex) const
+		{
+			return TConstArrayView<PCGExGraphs::FLink>(Links.GetData() + Offsets[NodeIndex], Offsets[NodeIndex + 1] - Offsets[NodeIndex]);
+		}
+
+		SIZE_T GetAllocatedSize() const { return Offsets.GetAllocatedSize() + Links.GetAllocatedSize(); }
+
+		/** Pack node links. Offsets are a sequential prefix sum, links are copied in parallel. */
+		static TSharedPtr<FClusterAdjacency> Make(const TArray<FNode>& InNodes);
+	};
+}
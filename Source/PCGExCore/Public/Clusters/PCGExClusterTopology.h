@@ -0,0 +1,67 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGExLink.h"
+
+namespace PCGExClusters
+{
+	class FCluster;
+
+	/**
+	 * Compact binary snapshot of a cluster topology, meant to be stored alongside edge data so a cluster can be
+	 * rehydrated without resolving packed edge endpoints again.
+	 * Layout : FHeader, node point indices (NumNodes), CSR offsets (NumNodes + 1), CSR links (NumLinks), edge endpoints (NumRawEdges * 2).
+	 * Every section is made of 4-byte values, so section views can point straight into the payload.
+	 */
+	namespace Topology
+	{
+		inline constexpr uint32 Magic = 0x54584350; // "PCXT"
+		inline constexpr uint32 Version = 1;
+
+		struct FHeader
+		{
+			uint32 Magic = 0;
+			uint32 Version = 0;
+			uint32 CountsHash = 0;
+			int32 NumRawVtx = 0;
+			int32 NumRawEdges = 0;
+			int32 NumNodes = 0;
+			int32 NumLinks = 0;
+		};
+
+		struct FView
+		{
+			FHeader Header;
+			TConstArrayView<int32> NodePoints;
+			TConstArrayView<int32> Offsets;
+			TConstArrayView<PCGExGraphs::FLink> Links;
+			TConstArrayView<uint32> Endpoints;
+		};
+
+		/** Hash of the raw vtx/edge counts a payload has been written against */
+		FORCEINLINE uint32 GetCountsHash(const int32 NumRawVtx, const int32 NumRawEdges)
+		{
+			return HashCombineFast(HashCombineFast(Version, GetTypeHash(NumRawVtx)), GetTypeHash(NumRawEdges));
+		}
+
+		/** Expected payload size, in bytes, for a given header */
+		PCGEXCORE_API int64 GetPayloadSize(const FHeader& InHeader);
+
+		/**
+		 * Write the topology of a built cluster.
+		 * Only clusters whose edges map 1:1 to edge points can be written; OutPayload is emptied otherwise.
+		 * @return Whether a payload was written
+		 */
+		PCGEXCORE_API bool Write(const FCluster& InCluster, TArray<uint8>& OutPayload);
+
+		/**
+		 * Validate a payload header & sections against the raw vtx/edge counts it is going to be used with.
+		 * Section content is neither range-checked nor matched against the endpoints attributes here, see FCluster::BuildFromTopology.
+		 * @return Whether the payload can be used; OutView sections point into InPayload
+		 */
+		PCGEXCORE_API bool Read(const TConstArrayView<uint8> InPayload, const int32 NumRawVtx, const int32 NumRawEdges, FView& OutView);
+	}
+}
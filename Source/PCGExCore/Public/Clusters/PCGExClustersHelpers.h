@@ -35,4 +35,7 @@ namespace PCGExClusters::Helpers
 	PCGEXCORE_API void GetAdjacencyData(const FCluster* InCluster, FNode& InNode, TArray<FAdjacencyData>& OutData);
 
 	PCGEXCORE_API TSharedPtr<FCluster> TryGetCachedCluster(const TSharedRef<PCGExData::FPointIO>& VtxIO, const TSharedRef<PCGExData::FPointIO>& EdgeIO);
+
+	/** Persisted topology payload of the input edges, empty if there is none or persistence is disabled */
+	PCGEXCORE_API TConstArrayView<uint8> GetPersistedTopology(const TSharedRef<PCGExData::FPointIO>& EdgeIO);
 }
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/PCGExStampedArray.h"
 
 namespace PCGEx
 {
@@ -46,6 +47,24 @@ namespace PCGEx
 		operator TArrayView<uint64>() { return Data; }
 	};
 
+	/** Array lookup with an O(1) Reset, for lookups that are reset far more often than they are filled */
+	class FHashLookupStamped : public FHashLookup
+	{
+	protected:
+		TStampedArray<uint64> Data;
+
+	public:
+		explicit FHashLookupStamped(const uint64 InitValue, const int32 Size)
+			: FHashLookup(InitValue, Size)
+		{
+			Data.Init(InitValue, Size);
+		}
+
+		FORCEINLINE virtual void Set(const int32 At, const uint64 Value) override { Data.Set(At, Value); }
+		FORCEINLINE virtual uint64 Get(const int32 At) override { return Data[At]; }
+		virtual void Reset() override { Data.Reset(); }
+	};
+
 	class FHashLookupMap : public FHashLookup
 	{
 	protected:
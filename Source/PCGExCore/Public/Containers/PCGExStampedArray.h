@@ -0,0 +1,87 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGEx
+{
+	/**
+	 * Fixed-size array whose entries all revert to a default value on Reset, in O(1).
+	 * Each slot carries the epoch it was last written in; slots from older epochs read as the default value.
+	 * Stamps are only cleared for real when the epoch counter wraps around.
+	 */
+	template <typename T>
+	class TStampedArray
+	{
+	protected:
+		TArray<T> Values;
+		TArray<uint32> Stamps;
+		T DefaultValue = T{};
+		uint32 Epoch = 1;
+
+	public:
+		TStampedArray() = default;
+
+		void Init(const T& InDefaultValue, const int32 InNum)
+		{
+			DefaultValue = InDefaultValue;
+			Values.Init(InDefaultValue, InNum);
+			Stamps.Init(0, InNum);
+			Epoch = 1;
+		}
+
+		FORCEINLINE int32 Num() const { return Stamps.Num(); }
+		FORCEINLINE bool IsEmpty() const { return Stamps.IsEmpty(); }
+
+		FORCEINLINE bool IsSet(const int32 Index) const { return Stamps[Index] == Epoch; }
+		FORCEINLINE T operator[](const int32 Index) const { return Stamps[Index] == Epoch ? Values[Index] : DefaultValue; }
+
+		FORCEINLINE void Set(const int32 Index, const T& InValue)
+		{
+			Values[Index] = InValue;
+			Stamps[Index] = Epoch;
+		}
+
+		void Reset()
+		{
+			if (++Epoch != 0) { return; }
+
+			// Wrapped around, older stamps could collide with the new epochs
+			FMemory::Memzero(Stamps.GetData(), Stamps.Num() * sizeof(uint32));
+			Epoch = 1;
+		}
+
+		SIZE_T GetAllocatedSize() const { return Values.GetAllocatedSize() + Stamps.GetAllocatedSize(); }
+	};
+
+	/** Set of flags that all clear on Reset, in O(1). Same epoch scheme as TStampedArray, without the payload. */
+	class FStampedFlags
+	{
+	protected:
+		TArray<uint32> Stamps;
+		uint32 Epoch = 1;
+
+	public:
+		FStampedFlags() = default;
+
+		void Init(const int32 InNum)
+		{
+			Stamps.Init(0, InNum);
+			Epoch = 1;
+		}
+
+		FORCEINLINE int32 Num() const { return Stamps.Num(); }
+		FORCEINLINE bool operator[](const int32 Index) const { return Stamps[Index] == Epoch; }
+		FORCEINLINE void Set(const int32 Index) { Stamps[Index] = Epoch; }
+		FORCEINLINE void Clear(const int32 Index) { Stamps[Index] = 0; }
+
+		void Reset()
+		{
+			if (++Epoch != 0) { return; }
+			FMemory::Memzero(Stamps.GetData(), Stamps.Num() * sizeof(uint32));
+			Epoch = 1;
+		}
+	};
+}
@@ -34,6 +34,23 @@ namespace PCGExMT
 	PCGEXCORE_API
 	int32 SubLoopScopes(TArray<FScope>& OutSubRanges, const int32 NumIterations, const int32 RangeSize);
 
+	/** Scope size fitting TargetSeconds of work given a measured per-iteration cost, while keeping at least one scope per core. */
+	PCGEXCORE_API
+	int32 GetAdaptiveScopeSize(const int32 NumIterations, const double SecondsPerIteration, const double TargetSeconds, const int32 NumCores);
+
+	/**
+	 * Session-wide per-iteration cost estimates of task group loops, keyed by settings class & group name.
+	 * Used to size loop scopes to a target duration when adaptive chunk sizing is enabled.
+	 */
+	namespace CostEstimates
+	{
+		PCGEXCORE_API
+		bool Get(const uint32 Key, double& OutSecondsPerIteration);
+
+		PCGEXCORE_API
+		void Record(const uint32 Key, const uint64 Cycles, const int64 Iterations);
+	}
+
 	enum class EAsyncHandleState : uint8
 	{
 		Idle    = 0,
@@ -195,6 +212,7 @@ namespace PCGExMT
 		TWeakPtr<PCGEx::FWorkHandle> WorkHandle;
 		FPCGExContext* Context = nullptr;
 		TWeakPtr<FPCGContextHandle> ContextHandle;
+		uint32 SettingsClassHash = 0; // Used to key group cost estimates, 0 when adaptive chunk sizing is disabled
 
 		// Groups and tokens managed separately (they start immediately)
 		mutable FRWLock GroupsLock;
@@ -252,6 +270,8 @@ namespace PCGExMT
 		using FSubLoopStartCallback = std::function<void(const FScope&)>;
 		FSubLoopStartCallback OnSubLoopStartCallback;
 
+		uint32 CostKey = 0; // Non-zero when scope costs are measured & used for sizing, see CostEstimates
+
 		explicit FTaskGroup(const FName InName);
 
 		template <typename T, typename... Args>
@@ -266,7 +286,7 @@ namespace PCGExMT
 			}
 
 			TArray<FScope> Loops;
-			const int32 NumLoops = SubLoopScopes(Loops, NumIterations, FMath::Max(1, GetSanitizedBatchSize(NumIterations, ChunkSize)));
+			const int32 NumLoops = SubLoopScopes(Loops, NumIterations, GetScopeSize(NumIterations, ChunkSize));
 
 			if (OnPrepareSubLoopsCallback) { OnPrepareSubLoopsCallback(Loops); }
 
@@ -296,7 +316,14 @@ namespace PCGExMT
 	protected:
 		TArray<FSimpleCallback> SimpleCallbacks;
 
-		void ExecScopeIteration(const FScope& Scope, bool bPrepareOnly) const;
+		std::atomic<uint64> MeasuredCycles{0};
+		std::atomic<int64> MeasuredIterations{0};
+
+		/** Scope size for a parallel loop; derived from the measured cost of this loop if available and the requested chunk size is a default one, otherwise from the requested chunk size. */
+		int32 GetScopeSize(const int32 NumIterations, const int32 ChunkSize) const;
+
+		void ExecScopeIteration(const FScope& Scope, bool bPrepareOnly);
+		virtual void OnEnd(bool bWasCancelled) override;
 		void TriggerSimpleCallback(int32 Index);
 	};
 
@@ -88,10 +88,18 @@ public:
 	virtual void SetBoundCluster(const TSharedPtr<PCGExClusters::FCluster>& InCluster);
 	const TSharedPtr<PCGExClusters::FCluster>& GetBoundCluster() const;
 
+	/** Store a compact snapshot of the given cluster topology, so it can be rehydrated once the bound cluster is gone. */
+	void PersistTopology(const PCGExClusters::FCluster& InCluster);
+	const TArray<uint8>& GetPersistedTopology() const { return TopologyPayload; }
+
 	virtual void BeginDestroy() override;
 
 protected:
 	TSharedPtr<PCGExClusters::FCluster> Cluster;
 
+	/** Optional binary topology payload, see PCGExClusters::Topology. Unlike the bound cluster, it is serialized with the data. */
+	UPROPERTY()
+	TArray<uint8> TopologyPayload;
+
 	virtual UPCGSpatialData* CopyInternal(FPCGContext* Context) const override;
 };
@@ -82,6 +82,7 @@ namespace PCGExData
 		bool bReadComplete = false;
 
 		bool bCacheValueHashes = false;
+		bool bTrackDirtyRanges = false;
 
 	public:
 		FPCGAttributeIdentifier Identifier;
@@ -92,6 +93,19 @@ namespace PCGExData
 		void Enable() { bIsEnabled.store(true, std::memory_order_release); }
 		virtual void EnableValueHashCache();
 
+		/**
+		 * Only write back the output ranges that were modified, instead of the whole buffer.
+		 * Has no effect on buffers that don't support it, or when untouched values can't be guaranteed to match the attribute.
+		 * Enabled after InitForWrite, every block starts dirty; prefer requesting it through FFacade::GetWritable.
+		 */
+		virtual void EnableDirtyTracking()
+		{
+		}
+
+		virtual void MarkDirty(const PCGExMT::FScope& Scope)
+		{
+		}
+
 		// Unsafe read value hash from input
 		virtual PCGExValueHash ReadValueHash(const int32 Index) = 0;
 
@@ -157,6 +171,10 @@ extern template bool IBuffer::IsA<_TYPE>() const;
 		const FPCGMetadataAttribute<T>* TypedInAttribute = nullptr;
 		FPCGMetadataAttribute<T>* TypedOutAttribute = nullptr;
 
+		// Contiguous storage, if the implementation has one. Enables non-virtual span access.
+		const T* InData = nullptr;
+		T* OutData = nullptr;
+
 	public:
 		T Min = T{};
 		T Max = T{};
@@ -187,6 +205,39 @@ extern template bool IBuffer::IsA<_TYPE>() const;
 		// Unsafe set value in output
 		virtual void SetValue(const int32 Index, const T& Value) = 0;
 
+		FORCEINLINE bool HasContiguousInput() const { return InData != nullptr; }
+		FORCEINLINE bool HasContiguousOutput() const { return OutData != nullptr; }
+
+		/**
+		 * Unsafe read of a scope of input values, as a contiguous view.
+		 * Array buffers return a view over their storage, no copy & no virtual call; other buffers (single value)
+		 * materialize the scope into Scratch with a single bulk read. Scoped buffers must have fetched that scope.
+		 */
+		FORCEINLINE TConstArrayView<T> ReadSpan(const PCGExMT::FScope& Scope, TArray<T>& Scratch) const
+		{
+			if (InData) { return TConstArrayView<T>(InData + Scope.Start, Scope.Count); }
+			Scratch.SetNumUninitialized(Scope.Count, EAllowShrinking::No);
+			Read(Scope.Start, TArrayView<T>(Scratch));
+			return Scratch;
+		}
+
+		/** Unsafe read of a scope of output values, as a contiguous view. See ReadSpan. */
+		FORCEINLINE TConstArrayView<T> GetSpan(const PCGExMT::FScope& Scope, TArray<T>& Scratch)
+		{
+			if (OutData) { return TConstArrayView<T>(OutData + Scope.Start, Scope.Count); }
+			Scratch.SetNumUninitialized(Scope.Count, EAllowShrinking::No);
+			GetValues(Scope.Start, TArrayView<T>(Scratch));
+			return Scratch;
+		}
+
+		/** Unsafe writable view over a scope of output values. Empty if the output isn't contiguous, in which case use SetValue. */
+		FORCEINLINE TArrayView<T> GetOutSpan(const PCGExMT::FScope& Scope)
+		{
+			if (!OutData) { return TArrayView<T>(); }
+			if (bTrackDirtyRanges) { this->MarkDirty(Scope); }
+			return TArrayView<T>(OutData + Scope.Start, Scope.Count);
+		}
+
 		virtual bool InitForRead(const EIOSide InSide = EIOSide::In, const bool bScoped = false) = 0;
 		virtual bool InitForBroadcast(const FPCGAttributePropertyInputSelector& InSelector, const bool bCaptureMinMax = false, const bool bScoped = false, const bool bQuiet = false) = 0;
 		virtual bool InitForWrite(const T& DefaultValue, bool bAllowInterpolation, EBufferInit Init = EBufferInit::Inherit) = 0;
@@ -225,7 +276,29 @@ extern template bool IBuffer::IsA<_TYPE>() const;
 	using TBuffer<T>::TypedOutAttribute;\
 	using TBuffer<T>::bReadComplete;\
 	using TBuffer<T>::IsEnabled;\
-	using TBuffer<T>::bCacheValueHashes;
+	using TBuffer<T>::bCacheValueHashes;\
+	using TBuffer<T>::bTrackDirtyRanges;\
+	using TBuffer<T>::InData;\
+	using TBuffer<T>::OutData;
+
+	/** One flag per block of values, set when any value in that block is modified. Used to only commit modified ranges. */
+	struct PCGEXCORE_API FDirtyBlocks
+	{
+		static constexpr int32 BlockShift = 8;
+
+		TArray<int8> Blocks;
+
+		void Init(const int32 NumValues, const bool bDirty);
+		void Empty() { Blocks.Empty(); }
+
+		FORCEINLINE void Mark(const int32 Index) { FPlatformAtomics::AtomicStore_Relaxed(Blocks.GetData() + (Index >> BlockShift), static_cast<int8>(1)); }
+		void Mark(const PCGExMT::FScope& Scope);
+		void MarkAll();
+		void Clear();
+
+		/** Merged runs of dirty blocks, as value ranges clamped to NumValues. */
+		void GetRanges(const int32 NumValues, TArray<PCGExMT::FScope>& OutRanges) const;
+	};
 
 	template <typename T>
 	class PCGEXCORE_API TArrayBuffer : public TBuffer<T>
@@ -241,12 +314,17 @@ extern template bool IBuffer::IsA<_TYPE>() const;
 		TSharedPtr<TArray<T>> OutValues;
 		TArray<PCGExValueHash> InHashes;
 
+		FDirtyBlocks DirtyBlocks; // Modified output blocks; see EnableDirtyTracking
+		bool bPartialWriteSafe = false; // Untouched output values are known to match the attribute
+
 	public:
 		TArrayBuffer(const TSharedRef<FPointIO>& InSource, const FPCGAttributeIdentifier& InIdentifier);
 
 		virtual bool IsSparse() const override { return bSparseBuffer || InternalBroadcaster; }
 
 		TSharedPtr<TArray<T>> GetInValues();
+
+		// Direct access to output values; assumes the whole buffer may be modified
 		TSharedPtr<TArray<T>> GetOutValues();
 
 		virtual int32 GetNumValues(const EIOSide InSide) override;
@@ -265,14 +343,26 @@ extern template bool IBuffer::IsA<_TYPE>() const;
 		virtual PCGExValueHash ReadValueHash(const int32 Index) override;
 
 	protected:
+		FORCEINLINE void UpdateStoragePointers()
+		{
+			InData = InValues ? InValues->GetData() : nullptr;
+			OutData = OutValues ? OutValues->GetData() : nullptr;
+		}
+
 		virtual void ComputeValueHashes(const PCGExMT::FScope& Scope);
 
 		virtual void InitForReadInternal(const bool bScoped, const FPCGMetadataAttributeBase* Attribute);
+
+		// Adopt a column shared through the column cache as read-only input values, if one exists
+		bool TryShareCachedColumn(const uint64 ColumnUID, const FPCGMetadataAttributeBase* Attribute);
+
 		virtual void InitForWriteInternal(FPCGMetadataAttributeBase* Attribute, const T& InDefaultValue, const EBufferInit Init);
 
 	public:
 		virtual bool EnsureReadable() override;
 		virtual void EnableValueHashCache() override;
+		virtual void EnableDirtyTracking() override;
+		virtual void MarkDirty(const PCGExMT::FScope& Scope) override;
 
 		virtual bool InitForRead(const EIOSide InSide = EIOSide::In, const bool bScoped = false) override;
 		virtual bool InitForBroadcast(const FPCGAttributePropertyInputSelector& InSelector, const bool bCaptureMinMax = false, const bool bScoped = false, const bool bQuiet = false) override;
@@ -384,11 +474,12 @@ extern template class TSingleValueBuffer<_TYPE>;
 
 #pragma region Writable
 
+		/** bTrackDirtyRanges : only commit modified ranges on write, for writers that leave most values untouched. See IBuffer::EnableDirtyTracking. */
 		template <typename T>
-		TSharedPtr<TBuffer<T>> GetWritable(const FPCGAttributeIdentifier& InIdentifier, T DefaultValue, bool bAllowInterpolation, EBufferInit Init);
+		TSharedPtr<TBuffer<T>> GetWritable(const FPCGAttributeIdentifier& InIdentifier, T DefaultValue, bool bAllowInterpolation, EBufferInit Init, bool bTrackDirtyRanges = false);
 
 		template <typename T>
-		TSharedPtr<TBuffer<T>> GetWritable(const FPCGMetadataAttribute<T>* InAttribute, EBufferInit Init);
+		TSharedPtr<TBuffer<T>> GetWritable(const FPCGMetadataAttribute<T>* InAttribute, EBufferInit Init, bool bTrackDirtyRanges = false);
 
 		template <typename T>
 		TSharedPtr<TBuffer<T>> GetWritable(const FPCGAttributeIdentifier& InIdentifier, EBufferInit Init);
@@ -479,8 +570,8 @@ extern template class TSingleValueBuffer<_TYPE>;
 extern template TSharedPtr<TBuffer<_TYPE>> FFacade::FindBuffer_Unsafe<_TYPE>(const FPCGAttributeIdentifier& InIdentifier); \
 extern template TSharedPtr<TBuffer<_TYPE>> FFacade::FindBuffer<_TYPE>(const FPCGAttributeIdentifier& InIdentifier); \
 extern template TSharedPtr<TBuffer<_TYPE>> FFacade::GetBuffer<_TYPE>(const FPCGAttributeIdentifier& InIdentifier); \
-extern template TSharedPtr<TBuffer<_TYPE>> FFacade::GetWritable<_TYPE>(const FPCGAttributeIdentifier& InIdentifier, _TYPE DefaultValue, bool bAllowInterpolation, EBufferInit Init); \
-extern template TSharedPtr<TBuffer<_TYPE>> FFacade::GetWritable<_TYPE>(const FPCGMetadataAttribute<_TYPE>* InAttribute, EBufferInit Init); \
+extern template TSharedPtr<TBuffer<_TYPE>> FFacade::GetWritable<_TYPE>(const FPCGAttributeIdentifier& InIdentifier, _TYPE DefaultValue, bool bAllowInterpolation, EBufferInit Init, bool bTrackDirtyRanges); \
+extern template TSharedPtr<TBuffer<_TYPE>> FFacade::GetWritable<_TYPE>(const FPCGMetadataAttribute<_TYPE>* InAttribute, EBufferInit Init, bool bTrackDirtyRanges); \
 extern template TSharedPtr<TBuffer<_TYPE>> FFacade::GetWritable<_TYPE>(const FPCGAttributeIdentifier& InIdentifier, EBufferInit Init); \
 extern template TSharedPtr<TBuffer<_TYPE>> FFacade::GetReadable<_TYPE>(const FPCGAttributeIdentifier& InIdentifier, const EIOSide InSide, const bool bSupportScoped); \
 extern template TSharedPtr<TBuffer<_TYPE>> FFacade::GetBroadcaster<_TYPE>(const FPCGAttributePropertyInputSelector& InSelector, const bool bSupportScoped, const bool bCaptureMinMax, const bool bQuiet); \
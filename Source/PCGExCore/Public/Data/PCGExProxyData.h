@@ -166,6 +166,13 @@ namespace PCGExData
 		virtual void SetVoid(const int32 Index, const void* Value) const = 0;
 		virtual void GetCurrentVoid(const int32 Index, void* OutValue) const { GetVoid(Index, OutValue); }
 
+		//
+		// Type-erased range access over [Start, Start + Count)
+		// Values are contiguous & constructed working-type values. Defaults go through GetVoid/SetVoid.
+		//
+		virtual void GetVoidRange(const int32 Start, const int32 Count, void* OutValues) const;
+		virtual void SetVoidRange(const int32 Start, const int32 Count, const void* Values) const;
+
 		// Hash computation
 		virtual PCGExValueHash ReadValueHash(const int32 Index) const = 0;
 
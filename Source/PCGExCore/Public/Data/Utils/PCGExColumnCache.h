@@ -0,0 +1,60 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UPCGData;
+
+/**
+ * Session-wide cache of fully decoded, read-only attribute columns.
+ * Input data is never mutated once it has been produced, so a column decoded from a given data (by UID) can be shared
+ * as-is with any other buffer reading the same attribute as the same type, across nodes.
+ * Columns are immutable once cached; buffers that hold one must never write into it.
+ * Memory is capped by the global ColumnCacheBudget setting, least recently used columns are evicted first.
+ */
+namespace PCGExData::ColumnCache
+{
+	struct FStats
+	{
+		int64 Hits = 0;
+		int64 Misses = 0;
+		int64 Evictions = 0;
+		int64 UsedBytes = 0;
+		int32 NumColumns = 0;
+
+		double GetHitRate() const
+		{
+			const int64 NumRequests = Hits + Misses;
+			return NumRequests ? static_cast<double>(Hits) / static_cast<double>(NumRequests) : 0;
+		}
+	};
+
+	PCGEXCORE_API bool IsEnabled();
+
+	PCGEXCORE_API TSharedPtr<void> FindColumn(const UPCGData* InData, const uint64 ColumnUID);
+	PCGEXCORE_API void AddColumn(const UPCGData* InData, const uint64 ColumnUID, const TSharedPtr<void>& InColumn, const int64 InSize);
+
+	PCGEXCORE_API FStats GetStats();
+	PCGEXCORE_API void Flush();
+
+	/**
+	 * Find a cached column.
+	 * @param InData Data the column was decoded from
+	 * @param ColumnUID Unique identifier of the column within that data, must account for value type
+	 */
+	template <typename T>
+	TSharedPtr<TArray<T>> Find(const UPCGData* InData, const uint64 ColumnUID)
+	{
+		return StaticCastSharedPtr<TArray<T>>(FindColumn(InData, ColumnUID));
+	}
+
+	/** Share a fully decoded column with other readers. The column must not be modified afterward. */
+	template <typename T>
+	void Add(const UPCGData* InData, const uint64 ColumnUID, const TSharedPtr<TArray<T>>& InColumn)
+	{
+		if (!InColumn) { return; }
+		AddColumn(InData, ColumnUID, InColumn, InColumn->GetAllocatedSize());
+	}
+}
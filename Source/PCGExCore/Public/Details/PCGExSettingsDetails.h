@@ -47,6 +47,9 @@ namespace PCGExDetails
 		FORCEINLINE virtual T Read(const int32 Index) = 0;
 		virtual void ReadScope(const int32 Start, TArrayView<T> OutResults) = 0;
 
+		// Read a scope as a contiguous view, either over the underlying buffer storage or materialized into Scratch
+		virtual TConstArrayView<T> ReadSpan(const PCGExMT::FScope& Scope, TArray<T>& Scratch) = 0;
+
 		FORCEINLINE virtual T Min() = 0;
 		FORCEINLINE virtual T Max() = 0;
 		FORCEINLINE virtual uint32 ReadValueHash(const int32 Index) = 0;
@@ -69,6 +72,7 @@ namespace PCGExDetails
 
 		virtual T Read(const int32 Index) override;
 		virtual void ReadScope(const int32 Start, TArrayView<T> OutResults) override;
+		virtual TConstArrayView<T> ReadSpan(const PCGExMT::FScope& Scope, TArray<T>& Scratch) override;
 
 		virtual T Min() override;
 		virtual T Max() override;
@@ -111,6 +115,7 @@ namespace PCGExDetails
 
 		FORCEINLINE virtual T Read(const int32 Index) override { return Constant; }
 		virtual void ReadScope(const int32 Start, TArrayView<T> OutResults) override;
+		virtual TConstArrayView<T> ReadSpan(const PCGExMT::FScope& Scope, TArray<T>& Scratch) override;
 
 		FORCEINLINE virtual T Min() override { return Constant; }
 		FORCEINLINE virtual T Max() override { return Constant; }
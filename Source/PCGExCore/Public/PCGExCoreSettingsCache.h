@@ -40,8 +40,15 @@ struct PCGEXCORE_API FPCGExCoreSettingsCache
 	bool bCacheClusters = true;
 	bool bDefaultScopedIndexLookupBuild = true;
 	bool bDefaultBuildAndCacheClusters = true;
+	bool bPersistClusterTopology = false;
 	EPCGExExecutionPolicy ExecutionPolicy = EPCGExExecutionPolicy::Default;
 
+	bool bAdaptiveChunkSize = false;
+	double AdaptiveTargetScopeDuration = 0.5;
+
+	int32 TrivialProcessorsBundleSize = 32;
+	int32 ColumnCacheBudget = 0;
+
 	int32 SmallPointsSize = 1024;
 	bool IsSmallPointSize(const int32 InNum) const { return InNum <= SmallPointsSize; }
 
@@ -0,0 +1,246 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/SharedPointer.h"
+
+namespace PCGExKDTree
+{
+	/** A query result : original item index and squared distance to the query position */
+	struct FNeighbor
+	{
+		int32 Index = -1;
+		double DistSquared = MAX_dbl;
+
+		FNeighbor() = default;
+
+		FNeighbor(const int32 InIndex, const double InDistSquared)
+			: Index(InIndex), DistSquared(InDistSquared)
+		{
+		}
+	};
+
+	/**
+	 * Static, implicit KD-tree over positions.
+	 * Entries are stored in a single flat array, in tree order. Each [Begin, End) range is split at its middle element,
+	 * left side is [Begin, Mid), right side is [Mid + 1, End). Ranges smaller than the leaf size are scanned linearly.
+	 * Build is parallel per tree level; the tree is immutable once built and can be queried concurrently.
+	 */
+	class PCGEXCORE_API FKDTree : public TSharedFromThis<FKDTree>
+	{
+	public:
+		struct FEntry
+		{
+			FVector Position = FVector::ZeroVector;
+			int32 Index = -1;
+		};
+
+	protected:
+		TArray<FEntry> Entries;
+		TArray<uint8> Axes;
+		int32 LeafSize = 8;
+
+		struct FStackItem
+		{
+			int32 Begin = 0;
+			int32 End = 0;
+			double MinDistSquared = 0;
+		};
+
+	public:
+		explicit FKDTree(const int32 InLeafSize = 8)
+			: LeafSize(FMath::Max(1, InLeafSize))
+		{
+		}
+
+		/**
+		 * Build the tree from a list of positions.
+		 * @param InPositions Positions to index, item index is the position index
+		 * @param InMask Optional mask, only positions with a non-zero mask value are added to the tree
+		 */
+		void Build(const TConstArrayView<FVector> InPositions, const TConstArrayView<int8> InMask = TConstArrayView<int8>());
+
+		/**
+		 * Build the tree from a list of positions, using explicit item indices.
+		 * @param InPositions Positions to index
+		 * @param InIndices Item index associated with each position
+		 */
+		void Build(const TConstArrayView<FVector> InPositions, const TConstArrayView<int32> InIndices);
+
+		void Reset()
+		{
+			Entries.Empty();
+			Axes.Empty();
+		}
+
+		FORCEINLINE int32 Num() const { return Entries.Num(); }
+		FORCEINLINE bool IsEmpty() const { return Entries.IsEmpty(); }
+		FORCEINLINE const TArray<FEntry>& GetEntries() const { return Entries; }
+
+		SIZE_T GetAllocatedSize() const { return Entries.GetAllocatedSize() + Axes.GetAllocatedSize(); }
+
+		/**
+		 * Find the nearest item to a given position. Ties are resolved in favor of the lowest item index.
+		 * @param InPosition Query position
+		 * @param OutDistSquared Squared distance to the nearest item, MAX_dbl if none was found
+		 * @param Filter Predicate (int32 Index) -> bool; items that don't pass are ignored
+		 * @param MaxDistSquared Optional squared search radius
+		 * @return Index of the nearest item, -1 if none was found
+		 */
+		template <typename FilterFunc>
+		int32 FindNearest(const FVector& InPosition, double& OutDistSquared, FilterFunc&& Filter, const double MaxDistSquared = MAX_dbl) const
+		{
+			int32 Best = -1;
+			double BestDistSquared = MaxDistSquared;
+
+			Traverse(
+				InPosition, [&]() { return BestDistSquared; },
+				[&](const FEntry& Entry, const double DistSquared)
+				{
+					if (DistSquared > BestDistSquared) { return; }
+					if (DistSquared == BestDistSquared && Best != -1 && Entry.Index > Best) { return; }
+					if (!Filter(Entry.Index)) { return; }
+					BestDistSquared = DistSquared;
+					Best = Entry.Index;
+				});
+
+			OutDistSquared = Best == -1 ? MAX_dbl : BestDistSquared;
+			return Best;
+		}
+
+		int32 FindNearest(const FVector& InPosition, double& OutDistSquared, const double MaxDistSquared = MAX_dbl) const
+		{
+			return FindNearest(InPosition, OutDistSquared, [](const int32) { return true; }, MaxDistSquared);
+		}
+
+		/**
+		 * Find the K nearest items to a given position, using a bounded max-heap of size K.
+		 * @param InPosition Query position
+		 * @param K Maximum number of neighbors to gather
+		 * @param OutNeighbors Results, sorted by ascending distance. Array is reset.
+		 * @param Filter Predicate (int32 Index) -> bool; items that don't pass are ignored
+		 * @param MaxDistSquared Optional squared search radius
+		 */
+		template <typename FilterFunc>
+		void FindKNearest(const FVector& InPosition, const int32 K, TArray<FNeighbor>& OutNeighbors, FilterFunc&& Filter, const double MaxDistSquared = MAX_dbl) const
+		{
+			OutNeighbors.Reset();
+			if (K <= 0) { return; }
+
+			OutNeighbors.Reserve(K);
+			auto MaxHeapPredicate = [](const FNeighbor& A, const FNeighbor& B) { return A.DistSquared > B.DistSquared; };
+
+			Traverse(
+				InPosition, [&]() { return OutNeighbors.Num() < K ? MaxDistSquared : OutNeighbors.HeapTop().DistSquared; },
+				[&](const FEntry& Entry, const double DistSquared)
+				{
+					if (DistSquared > MaxDistSquared) { return; }
+
+					if (OutNeighbors.Num() < K)
+					{
+						if (!Filter(Entry.Index)) { return; }
+						OutNeighbors.HeapPush(FNeighbor(Entry.Index, DistSquared), MaxHeapPredicate);
+					}
+					else if (DistSquared < OutNeighbors.HeapTop().DistSquared)
+					{
+						if (!Filter(Entry.Index)) { return; }
+						OutNeighbors.HeapPopDiscard(MaxHeapPredicate, EAllowShrinking::No);
+						OutNeighbors.HeapPush(FNeighbor(Entry.Index, DistSquared), MaxHeapPredicate);
+					}
+				});
+
+			OutNeighbors.Sort([](const FNeighbor& A, const FNeighbor& B) { return A.DistSquared < B.DistSquared || (A.DistSquared == B.DistSquared && A.Index < B.Index); });
+		}
+
+		void FindKNearest(const FVector& InPosition, const int32 K, TArray<FNeighbor>& OutNeighbors, const double MaxDistSquared = MAX_dbl) const
+		{
+			FindKNearest(InPosition, K, OutNeighbors, [](const int32) { return true; }, MaxDistSquared);
+		}
+
+		/**
+		 * Visit all items within a given squared radius.
+		 * @param InPosition Query position
+		 * @param RadiusSquared Squared search radius
+		 * @param Func Callback (int32 Index, double DistSquared)
+		 */
+		template <typename CallbackFunc>
+		void FindInRadius(const FVector& InPosition, const double RadiusSquared, CallbackFunc&& Func) const
+		{
+			Traverse(
+				InPosition, [&]() { return RadiusSquared; },
+				[&](const FEntry& Entry, const double DistSquared)
+				{
+					if (DistSquared <= RadiusSquared) { Func(Entry.Index, DistSquared); }
+				});
+		}
+
+		/** Count items within a given squared radius. */
+		int32 CountInRadius(const FVector& InPosition, const double RadiusSquared) const
+		{
+			int32 Count = 0;
+			FindInRadius(InPosition, RadiusSquared, [&](const int32, const double) { Count++; });
+			return Count;
+		}
+
+	protected:
+		void BuildInternal();
+
+		/**
+		 * Core traversal. Visits entries whose range lower bound is below the current cutoff, near side first.
+		 * @param InPosition Query position
+		 * @param GetCutoff () -> double; current squared distance beyond which ranges can be skipped
+		 * @param Visit (const FEntry&, double DistSquared)
+		 */
+		template <typename CutoffFunc, typename VisitFunc>
+		void Traverse(const FVector& InPosition, CutoffFunc&& GetCutoff, VisitFunc&& Visit) const
+		{
+			const int32 NumEntries = Entries.Num();
+			if (!NumEntries) { return; }
+
+			TArray<FStackItem, TInlineAllocator<64>> Stack;
+			Stack.Add(FStackItem{0, NumEntries, 0});
+
+			const FEntry* RESTRICT EntriesPtr = Entries.GetData();
+			const uint8* RESTRICT AxesPtr = Axes.GetData();
+
+			while (!Stack.IsEmpty())
+			{
+				const FStackItem Item = Stack.Pop(EAllowShrinking::No);
+				if (Item.MinDistSquared > GetCutoff()) { continue; }
+
+				const int32 Count = Item.End - Item.Begin;
+				if (Count <= LeafSize)
+				{
+					for (int32 i = Item.Begin; i < Item.End; i++)
+					{
+						const FEntry& Entry = EntriesPtr[i];
+						Visit(Entry, FVector::DistSquared(InPosition, Entry.Position));
+					}
+					continue;
+				}
+
+				const int32 Mid = Item.Begin + Count / 2;
+				const FEntry& Pivot = EntriesPtr[Mid];
+				const uint8 Axis = AxesPtr[Mid];
+				const double Delta = InPosition[Axis] - Pivot.Position[Axis];
+				const double DeltaSquared = Delta * Delta;
+
+				// Push far side first so near side is processed first
+				if (Delta < 0)
+				{
+					Stack.Add(FStackItem{Mid + 1, Item.End, FMath::Max(Item.MinDistSquared, DeltaSquared)});
+					Visit(Pivot, FVector::DistSquared(InPosition, Pivot.Position));
+					Stack.Add(FStackItem{Item.Begin, Mid, Item.MinDistSquared});
+				}
+				else
+				{
+					Stack.Add(FStackItem{Item.Begin, Mid, FMath::Max(Item.MinDistSquared, DeltaSquared)});
+					Visit(Pivot, FVector::DistSquared(InPosition, Pivot.Position));
+					Stack.Add(FStackItem{Mid + 1, Item.End, Item.MinDistSquared});
+				}
+			}
+		}
+	};
+}
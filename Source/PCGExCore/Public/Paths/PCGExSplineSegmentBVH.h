@@ -0,0 +1,121 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/SharedPointer.h"
+
+struct FPCGSplineStruct;
+
+namespace PCGExPaths
+{
+	/**
+	 * Accelerated closest input key lookup on a spline.
+	 * Spline segments are sampled into a polyline LUT (key & spline-local position per sample) whose edges are indexed by a BVH.
+	 * Queries gather the polyline edges that may hold the closest point, accounting for a conservative bound on the polyline
+	 * deviation from the curve, and only refine the exact key on the spline segments they belong to, instead of searching the whole curve.
+	 * Candidate segments always include the one holding the true closest point; refinement is the same per-segment search
+	 * FPCGSplineStruct::FindInputKeyClosestToWorldLocation runs, so results only differ where that search doesn't converge.
+	 * Immutable once built, can be queried concurrently.
+	 */
+	class PCGEXCORE_API FSplineSegmentBVH : public TSharedFromThis<FSplineSegmentBVH>
+	{
+	public:
+		struct FSample
+		{
+			FVector Position = FVector::ZeroVector; // Spline-local
+			double Key = 0;
+			int32 Segment = -1;
+			bool bCollapsed = false; // Edge starting at this sample is the sample itself, see GetEdgeEnd
+		};
+
+	protected:
+		struct FNode
+		{
+			FBox Bounds = FBox(ForceInit);
+			int32 Begin = 0;
+			int32 End = 0;
+			int32 Left = -1;
+			int32 Right = -1;
+		};
+
+		const FPCGSplineStruct* Spline = nullptr;
+		FTransform Transform = FTransform::Identity;
+
+		TArray<FSample> Samples;
+		TArray<int32> Edges; // Polyline edges, as the index of their first sample, in BVH order; collapsed edges are single points
+		TArray<FNode> Nodes;
+
+		double ErrorMargin = 0;
+		int32 LeafSize = 4;
+
+	public:
+		explicit FSplineSegmentBVH(const int32 InLeafSize = 4)
+			: LeafSize(FMath::Max(1, InLeafSize))
+		{
+		}
+
+		/**
+		 * Build the LUT & BVH for a given spline. The spline must outlive this object.
+		 * @param InSpline Spline to index
+		 * @param InSamplesPerSegment Number of polyline samples per spline segment. More samples means tighter candidate sets, at the cost of memory.
+		 */
+		void Build(const FPCGSplineStruct& InSpline, const int32 InSamplesPerSegment = 8);
+
+		FORCEINLINE bool IsValid() const { return Spline && !Nodes.IsEmpty(); }
+		FORCEINLINE const TArray<FSample>& GetSamples() const { return Samples; }
+
+		SIZE_T GetAllocatedSize() const { return Samples.GetAllocatedSize() + Edges.GetAllocatedSize() + Nodes.GetAllocatedSize(); }
+
+		/** Spline input key closest to the given world position. */
+		double FindClosestKey(const FVector& WorldPosition) const;
+
+	protected:
+		FORCEINLINE const FVector& GetEdgeEnd(const int32 Edge) const { return Samples[Edge].bCollapsed ? Samples[Edge].Position : Samples[Edge + 1].Position; }
+
+		/**
+		 * Visit polyline edges whose bounds are within the current cutoff.
+		 * @param LocalPosition Spline-local query position
+		 * @param GetCutoff () -> double; squared distance beyond which nodes can be skipped
+		 * @param Visit (int32 Edge, double DistSquared)
+		 */
+		template <typename CutoffFunc, typename VisitFunc>
+		void Traverse(const FVector& LocalPosition, CutoffFunc&& GetCutoff, VisitFunc&& Visit) const
+		{
+			TArray<int32, TInlineAllocator<64>> Stack;
+			Stack.Add(0);
+
+			while (!Stack.IsEmpty())
+			{
+				const FNode& Node = Nodes[Stack.Pop(EAllowShrinking::No)];
+				if (Node.Bounds.ComputeSquaredDistanceToPoint(LocalPosition) > GetCutoff()) { continue; }
+
+				if (Node.Left == -1)
+				{
+					for (int32 i = Node.Begin; i < Node.End; i++)
+					{
+						const int32 Edge = Edges[i];
+						Visit(Edge, FMath::PointDistToSegmentSquared(LocalPosition, Samples[Edge].Position, GetEdgeEnd(Edge)));
+					}
+					continue;
+				}
+
+				// Push farthest child first so the nearest one is processed first
+				const double LeftDist = Nodes[Node.Left].Bounds.ComputeSquaredDistanceToPoint(LocalPosition);
+				const double RightDist = Nodes[Node.Right].Bounds.ComputeSquaredDistanceToPoint(LocalPosition);
+
+				if (LeftDist < RightDist)
+				{
+					Stack.Add(Node.Right);
+					Stack.Add(Node.Left);
+				}
+				else
+				{
+					Stack.Add(Node.Left);
+					Stack.Add(Node.Right);
+				}
+			}
+		}
+	};
+}
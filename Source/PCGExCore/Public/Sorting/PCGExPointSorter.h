@@ -91,7 +91,7 @@ namespace PCGExSorting
 	 *
 	 * Usage:
 	 *   auto Cache = Sorter->BuildCache(NumPoints);
-	 *   Order.Sort([&](int32 A, int32 B) { return Cache->Compare(A, B); });
+	 *   Cache->SortIndices(Order);
 	 */
 	class PCGEXCORE_API FSortCache
 	{
@@ -121,6 +121,28 @@ namespace PCGExSorting
 		/** Get number of rules */
 		FORCEINLINE int32 NumRules() const { return CachedNumRules; }
 
+		/**
+		 * Order-preserving 64-bit key for a rule value. Values are quantized by the rule tolerance, so values that fall
+		 * within the same tolerance step share a key. Flipped keys sort in reverse order.
+		 */
+		static uint64 GetNormalizedKey(double Value, const double Tolerance, const bool bFlip)
+		{
+			if (Tolerance > 0) { Value = FMath::FloorToDouble(Value / Tolerance); }
+			Value += 0.0; // -0 -> +0
+
+			uint64 Bits;
+			FMemory::Memcpy(&Bits, &Value, sizeof(double));
+			Bits = (Bits & 0x8000000000000000ull) ? ~Bits : Bits | 0x8000000000000000ull;
+
+			return bFlip ? ~Bits : Bits;
+		}
+
+		/**
+		 * Sort element indices using normalized keys : one stable parallel radix pass per rule, last rule first.
+		 * Equivalent to sorting with Compare, except tolerance is applied as fixed-size steps; ties keep their input order.
+		 */
+		void SortIndices(TArray<int32>& InOutIndices) const;
+
 		/** Fast comparison using cached values. No virtual calls. */
 		FORCEINLINE bool Compare(const int32 A, const int32 B) const
 		{
@@ -5,6 +5,7 @@
 
 #include "PCGExH.h"
 #include "CoreMinimal.h"
+#include "Core/PCGExMTCommon.h"
 
 namespace PCGExSortingHelpers
 {
@@ -73,4 +74,142 @@ namespace PCGExSortingHelpers
 			Swap(Curr, Out);
 		}
 	}
+
+	/**
+	 * Stable LSD radix sort by Key, parallel over fixed-size chunks.
+	 * Each pass gathers per-chunk histograms in parallel, then every chunk scatters from its own offsets (bucket-major, chunk-minor),
+	 * which keeps the output stable. Passes where all keys share the same byte are skipped.
+	 */
+	static void ParallelRadixSort(TArray<FIndexKey>& Keys, const int32 ChunkSize = 16384)
+	{
+		const int32 N = Keys.Num();
+		if (N <= ChunkSize)
+		{
+			RadixSort(Keys);
+			return;
+		}
+
+		constexpr int32 NUM_BUCKETS = 256;
+		constexpr int32 NUM_PASSES = sizeof(uint64);
+
+		const int32 NumChunks = FMath::DivideAndRoundUp(N, ChunkSize);
+
+		TArray<FIndexKey> Temp;
+		Temp.SetNumUninitialized(N);
+
+		TArray<int32> Offsets;
+		Offsets.SetNumUninitialized(NumChunks * NUM_BUCKETS);
+
+		FIndexKey* Curr = Keys.GetData();
+		FIndexKey* Out = Temp.GetData();
+
+		for (int32 pass = 0; pass < NUM_PASSES; ++pass)
+		{
+			const int32 Shift = pass * 8;
+
+			PCGEX_PARALLEL_FOR_THRESHOLD(
+				NumChunks, 1,
+
+				int32* Count = Offsets.GetData() + i * NUM_BUCKETS;
+				FMemory::Memzero(Count, NUM_BUCKETS * sizeof(int32));
+
+				const int32 End = FMath::Min(N, (i + 1) * ChunkSize);
+				for (int32 j = i * ChunkSize; j < End; ++j) { Count[(Curr[j].Key >> Shift) & 0xFF]++; }
+			)
+
+			int32 s = 0;
+			bool bSharedByte = false;
+			for (int32 b = 0; b < NUM_BUCKETS; ++b)
+			{
+				const int32 BucketStart = s;
+				for (int32 c = 0; c < NumChunks; ++c)
+				{
+					int32& Offset = Offsets[c * NUM_BUCKETS + b];
+					const int32 Count = Offset;
+					Offset = s;
+					s += Count;
+				}
+
+				if (s - BucketStart == N) { bSharedByte = true; }
+			}
+
+			if (bSharedByte) { continue; }
+
+			PCGEX_PARALLEL_FOR_THRESHOLD(
+				NumChunks, 1,
+
+				int32* Sum = Offsets.GetData() + i * NUM_BUCKETS;
+
+				const int32 End = FMath::Min(N, (i + 1) * ChunkSize);
+				for (int32 j = i * ChunkSize; j < End; ++j) { Out[Sum[(Curr[j].Key >> Shift) & 0xFF]++] = Curr[j]; }
+			)
+
+			Swap(Curr, Out);
+		}
+
+		if (Curr != Keys.GetData()) { FMemory::Memcpy(Keys.GetData(), Curr, N * sizeof(FIndexKey)); }
+	}
+
+	static void RadixSort(TArray<uint64>& Keys)
+	{
+		const int32 N = Keys.Num();
+		if (N <= 1) { return; }
+
+		constexpr int32 NUM_BUCKETS = 256;
+		constexpr int32 NUM_PASSES = sizeof(uint64);
+
+		TArray<uint64> Temp;
+		Temp.SetNumUninitialized(N);
+
+		uint64* Curr = Keys.GetData();
+		uint64* Out = Temp.GetData();
+
+		for (int32 pass = 0; pass < NUM_PASSES; ++pass)
+		{
+			int32 Count[NUM_BUCKETS] = {};
+			const int32 Shift = pass * 8;
+
+			for (int32 i = 0; i < N; ++i)
+			{
+				Count[(Curr[i] >> Shift) & 0xFF]++;
+			}
+
+			// All keys share this byte, nothing to reorder
+			if (Count[(Curr[0] >> Shift) & 0xFF] == N) { continue; }
+
+			int32 Sum[NUM_BUCKETS];
+			int32 s = 0;
+			for (int32 i = 0; i < NUM_BUCKETS; ++i)
+			{
+				Sum[i] = s;
+				s += Count[i];
+			}
+
+			for (int32 i = 0; i < N; ++i)
+			{
+				Out[Sum[(Curr[i] >> Shift) & 0xFF]++] = Curr[i];
+			}
+
+			Swap(Curr, Out);
+		}
+
+		if (Curr != Keys.GetData()) { FMemory::Memcpy(Keys.GetData(), Curr, N * sizeof(uint64)); }
+	}
+
+	/** Radix sort keys then remove duplicates in place. */
+	static void SortUnique(TArray<uint64>& Keys)
+	{
+		RadixSort(Keys);
+
+		const int32 N = Keys.Num();
+		if (N <= 1) { return; }
+
+		int32 WriteIndex = 1;
+		for (int32 i = 1; i < N; ++i)
+		{
+			if (Keys[i] != Keys[WriteIndex - 1]) { Keys[WriteIndex++] = Keys[i]; }
+		}
+
+		Keys.SetNum(WriteIndex, EAllowShrinking::No);
+	}
 }
@@ -3,133 +3,415 @@
 
 #pragma once
 
-#include <queue>
-#include <vector>
-#include "CoreMinimal.h"
-
-// Copyright 2026 Timothé Lapetite and contributors
-// Released under the MIT license https://opensource.org/license/MIT/
-
-#pragma once
-
 #include "CoreMinimal.h"
+#include "Containers/PCGExStampedArray.h"
 
 namespace PCGEx
 {
-	class FScoredQueue
+	enum class EScoredQueueBackend : uint8
 	{
-	protected:
-		// Heap storage: pairs of (score, nodeIndex)
-		TArray<TPair<double, int32>> Heap;
+		BinaryHeap = 0, // General purpose, supports any score sequence
+		QuaternaryHeap, // 4-ary heap with SoA key/value storage, shallower and more cache friendly on large queues
+		RadixHeap,      // Monotone radix heap, for non-negative scores that never go below the last dequeued score (Dijkstra-like)
+		BucketQueue,    // Dial-style bucket queue over quantized scores, exact within a bucket
+	};
 
-		// Maps node index -> position in heap (-1 if not in queue)
-		TArray<int32> HeapIndex;
+	namespace ScoredQueue
+	{
+		/** Binary heap of (score, index) pairs with an index -> heap position indirection, supports decrease-key */
+		class PCGEXCORE_API FBinaryHeap
+		{
+		protected:
+			TArray<TPair<double, int32>> Heap;
+			TArray<int32> HeapIndex;
+			int32 Size = 0;
 
-		int32 Size = 0;
+			FORCEINLINE void Swap(const int32 i, const int32 j)
+			{
+				HeapIndex[Heap[i].Value] = j;
+				HeapIndex[Heap[j].Value] = i;
+				::Swap(Heap[i], Heap[j]);
+			}
 
-		FORCEINLINE int32 Parent(const int32 i) const { return (i - 1) >> 1; }
-		FORCEINLINE int32 LeftChild(const int32 i) const { return (i << 1) + 1; }
-		FORCEINLINE int32 RightChild(const int32 i) const { return (i << 1) + 2; }
+			void SiftUp(int32 i)
+			{
+				while (i > 0)
+				{
+					const int32 p = (i - 1) >> 1;
+					if (Heap[i].Key >= Heap[p].Key) { break; }
+					Swap(i, p);
+					i = p;
+				}
+			}
 
-		FORCEINLINE void Swap(const int32 i, const int32 j)
-		{
-			HeapIndex[Heap[i].Value] = j;
-			HeapIndex[Heap[j].Value] = i;
-			::Swap(Heap[i], Heap[j]);
-		}
+			void SiftDown(int32 i)
+			{
+				while (true)
+				{
+					int32 Smallest = i;
+					const int32 L = (i << 1) + 1;
+					const int32 R = L + 1;
 
-		void SiftUp(int32 i)
-		{
-			while (i > 0)
+					if (L < Size && Heap[L].Key < Heap[Smallest].Key) { Smallest = L; }
+					if (R < Size && Heap[R].Key < Heap[Smallest].Key) { Smallest = R; }
+
+					if (Smallest == i) { break; }
+					Swap(i, Smallest);
+					i = Smallest;
+				}
+			}
+
+		public:
+			void Init(const int32 InSize);
+
+			FORCEINLINE int32 Num() const { return Size; }
+
+			FORCEINLINE void Push(const int32 Index, const double InScore)
 			{
-				const int32 p = Parent(i);
-				if (Heap[i].Key >= Heap[p].Key) { break; }
-				Swap(i, p);
-				i = p;
+				const int32 ExistingPos = HeapIndex[Index];
+				if (ExistingPos != -1)
+				{
+					// Decrease-key : score only decreases, so only sift up
+					Heap[ExistingPos].Key = InScore;
+					SiftUp(ExistingPos);
+					return;
+				}
+
+				const int32 Pos = Size++;
+				if (Pos < Heap.Num()) { Heap[Pos] = TPair<double, int32>(InScore, Index); }
+				else { Heap.Emplace(InScore, Index); }
+				HeapIndex[Index] = Pos;
+				SiftUp(Pos);
 			}
-		}
 
-		void SiftDown(int32 i)
-		{
-			while (true)
+			FORCEINLINE bool Pop(int32& OutItem, double& OutScore)
 			{
-				int32 Smallest = i;
-				const int32 L = LeftChild(i);
-				const int32 R = RightChild(i);
+				if (Size == 0) { return false; }
 
-				if (L < Size && Heap[L].Key < Heap[Smallest].Key) { Smallest = L; }
-				if (R < Size && Heap[R].Key < Heap[Smallest].Key) { Smallest = R; }
+				OutItem = Heap[0].Value;
+				OutScore = Heap[0].Key;
+				HeapIndex[OutItem] = -1;
 
-				if (Smallest == i) { break; }
-				Swap(i, Smallest);
-				i = Smallest;
+				Size--;
+				if (Size > 0)
+				{
+					Heap[0] = Heap[Size];
+					HeapIndex[Heap[0].Value] = 0;
+					SiftDown(0);
+				}
+
+				return true;
 			}
-		}
 
-	public:
-		TArray<double> Scores; // Public for compatibility with existing code
+			void Reset();
+		};
 
-		explicit FScoredQueue(const int32 InSize)
+		/** 4-ary heap with keys and values stored in separate arrays, so sift-down only touches the keys it compares */
+		class PCGEXCORE_API FQuaternaryHeap
 		{
-			Heap.Reserve(InSize);
-			HeapIndex.Init(-1, InSize);
-			Scores.Init(MAX_dbl, InSize);
-		}
+		protected:
+			TArray<double> Keys;
+			TArray<int32> Values;
+			TArray<int32> HeapIndex;
+			int32 Size = 0;
 
-		FORCEINLINE bool IsEmpty() const { return Size == 0; }
-		FORCEINLINE int32 Num() const { return Size; }
+			FORCEINLINE void Place(const int32 Pos, const double Key, const int32 Value)
+			{
+				Keys[Pos] = Key;
+				Values[Pos] = Value;
+				HeapIndex[Value] = Pos;
+			}
 
-		bool Enqueue(const int32 Index, const double InScore)
-		{
-			double& RegisteredScore = Scores[Index];
-			if (RegisteredScore <= InScore) { return false; }
+			void SiftUp(int32 i)
+			{
+				const double Key = Keys[i];
+				const int32 Value = Values[i];
 
-			RegisteredScore = InScore;
+				while (i > 0)
+				{
+					const int32 p = (i - 1) >> 2;
+					if (Key >= Keys[p]) { break; }
+					Place(i, Keys[p], Values[p]);
+					i = p;
+				}
 
-			const int32 ExistingPos = HeapIndex[Index];
-			if (ExistingPos != -1)
+				Place(i, Key, Value);
+			}
+
+			void SiftDown(int32 i)
 			{
-				// Decrease-key: update existing entry
-				Heap[ExistingPos].Key = InScore;
-				SiftUp(ExistingPos); // Score only decreases, so only sift up
+				const double Key = Keys[i];
+				const int32 Value = Values[i];
+				const double* RESTRICT KeysPtr = Keys.GetData();
+
+				while (true)
+				{
+					const int32 First = (i << 2) + 1;
+					if (First >= Size) { break; }
+
+					const int32 Last = FMath::Min(First + 4, Size);
+					int32 Smallest = First;
+					for (int32 c = First + 1; c < Last; c++) { if (KeysPtr[c] < KeysPtr[Smallest]) { Smallest = c; } }
+
+					if (KeysPtr[Smallest] >= Key) { break; }
+					Place(i, Keys[Smallest], Values[Smallest]);
+					i = Smallest;
+				}
+
+				Place(i, Key, Value);
 			}
-			else
+
+		public:
+			void Init(const int32 InSize);
+
+			FORCEINLINE int32 Num() const { return Size; }
+
+			FORCEINLINE void Push(const int32 Index, const double InScore)
 			{
-				// Insert new entry
+				const int32 ExistingPos = HeapIndex[Index];
+				if (ExistingPos != -1)
+				{
+					Keys[ExistingPos] = InScore;
+					SiftUp(ExistingPos);
+					return;
+				}
+
 				const int32 Pos = Size++;
-				if (Pos < Heap.Num()) { Heap[Pos] = TPair<double, int32>(InScore, Index); }
-				else { Heap.Emplace(InScore, Index); }
-				HeapIndex[Index] = Pos;
+				if (Pos >= Keys.Num())
+				{
+					Keys.SetNumUninitialized(Pos + 1, EAllowShrinking::No);
+					Values.SetNumUninitialized(Pos + 1, EAllowShrinking::No);
+				}
+
+				Place(Pos, InScore, Index);
 				SiftUp(Pos);
 			}
 
-			return true;
-		}
+			FORCEINLINE bool Pop(int32& OutItem, double& OutScore)
+			{
+				if (Size == 0) { return false; }
+
+				OutItem = Values[0];
+				OutScore = Keys[0];
+				HeapIndex[OutItem] = -1;
+
+				Size--;
+				if (Size > 0)
+				{
+					Place(0, Keys[Size], Values[Size]);
+					SiftDown(0);
+				}
+
+				return true;
+			}
+
+			void Reset();
+		};
 
-		bool Dequeue(int32& OutItem, double& OutScore)
+		/**
+		 * Monotone radix heap over the bit pattern of non-negative doubles (which orders like the doubles themselves).
+		 * Decrease-key is lazy : a new entry is pushed and outdated ones are skipped when they surface.
+		 * Scores below the last dequeued score break the monotone contract; they are ordered as if equal to it.
+		 */
+		class PCGEXCORE_API FRadixHeap
 		{
-			if (Size == 0) { return false; }
+		protected:
+			struct FEntry
+			{
+				uint64 Key;
+				double Score;
+				int32 Index;
+			};
+
+			static constexpr int32 NumBuckets = 65;
+
+			TArray<FEntry> Buckets[NumBuckets];
+			TBitArray<> Queued;
+			uint64 Last = 0;
+			int32 Size = 0;
+
+			static FORCEINLINE uint64 ToKey(const double InScore)
+			{
+				if (!(InScore > 0)) { return 0; }
+				uint64 Key;
+				FMemory::Memcpy(&Key, &InScore, sizeof(uint64));
+				return Key;
+			}
+
+			FORCEINLINE int32 BucketIndex(const uint64 Key) const
+			{
+				const uint64 Diff = Key ^ Last;
+				return Diff ? 64 - static_cast<int32>(FMath::CountLeadingZeros64(Diff)) : 0;
+			}
+
+			FORCEINLINE bool IsLive(const FEntry& Entry, const TStampedArray<double>& Scores) const
+			{
+				return Queued[Entry.Index] && Scores[Entry.Index] == Entry.Score;
+			}
+
+			/** Move the smallest live bucket down into bucket 0 */
+			void Refill(const TStampedArray<double>& Scores);
+
+		public:
+			void Init(const int32 InSize);
+
+			FORCEINLINE int32 Num() const { return Size; }
+
+			FORCEINLINE void Push(const int32 Index, const double InScore)
+			{
+				const uint64 Key = FMath::Max(ToKey(InScore), Last);
+				Buckets[BucketIndex(Key)].Add(FEntry{Key, InScore, Index});
+				if (!Queued[Index])
+				{
+					Queued[Index] = true;
+					Size++;
+				}
+			}
+
+			FORCEINLINE bool Pop(int32& OutItem, double& OutScore, const TStampedArray<double>& Scores)
+			{
+				while (Size > 0)
+				{
+					if (Buckets[0].IsEmpty()) { Refill(Scores); }
+
+					const FEntry Entry = Buckets[0].Pop(EAllowShrinking::No);
+					if (!IsLive(Entry, Scores)) { continue; }
+
+					Queued[Entry.Index] = false;
+					Size--;
+
+					OutItem = Entry.Index;
+					OutScore = Entry.Score;
+					return true;
+				}
+
+				return false;
+			}
+
+			void Reset();
+		};
+
+		/**
+		 * Dial-style bucket queue. Scores are quantized into fixed-width buckets, the lowest non-empty bucket is
+		 * scanned for its exact minimum. Works best when scores are spread over a bounded range relative to the width.
+		 * Decrease-key is lazy, outdated entries are dropped during scans.
+		 */
+		class PCGEXCORE_API FBucketQueue
+		{
+		protected:
+			static constexpr int32 MaxBuckets = 1 << 16;
+
+			TArray<TArray<int32>> Buckets;
+			TArray<int32> BucketOf;
+			double InvWidth = 1;
+			int32 Cursor = 0;
+			int32 Size = 0;
+
+			FORCEINLINE int32 BucketIndex(const double InScore) const
+			{
+				const double Bucket = InScore * InvWidth;
+				if (!(Bucket > 0)) { return 0; }
+				return Bucket >= MaxBuckets - 1 ? MaxBuckets - 1 : static_cast<int32>(Bucket);
+			}
+
+			/** Advance the cursor to the first bucket holding at least one live entry */
+			void Advance();
+
+		public:
+			void Init(const int32 InSize, const double InBucketWidth);
+
+			FORCEINLINE int32 Num() const { return Size; }
+
+			FORCEINLINE void Push(const int32 Index, const double InScore)
+			{
+				const int32 Bucket = BucketIndex(InScore);
+				int32& CurrentBucket = BucketOf[Index];
+
+				if (CurrentBucket == Bucket) { return; } // Already there, scans read the live score
+				if (CurrentBucket == -1) { Size++; }
+
+				CurrentBucket = Bucket;
+				if (Bucket >= Buckets.Num()) { Buckets.SetNum(Bucket + 1); }
+				Buckets[Bucket].Add(Index);
+				Cursor = FMath::Min(Cursor, Bucket);
+			}
+
+			bool Pop(int32& OutItem, double& OutScore, const TStampedArray<double>& Scores);
+
+			void Reset();
+		};
+	}
+
+	/**
+	 * Indexed min-priority queue with decrease-key semantics.
+	 * An index can only be (re)enqueued with a score strictly lower than the last one it was registered with, until Reset.
+	 * The storage backend is picked at construction and can be swapped to match the score distribution of the search.
+	 */
+	class PCGEXCORE_API FScoredQueue
+	{
+	protected:
+		EScoredQueueBackend Backend = EScoredQueueBackend::BinaryHeap;
 
-			OutItem = Heap[0].Value;
-			OutScore = Heap[0].Key;
-			HeapIndex[OutItem] = -1;
+		ScoredQueue::FBinaryHeap BinaryHeap;
+		ScoredQueue::FQuaternaryHeap QuaternaryHeap;
+		ScoredQueue::FRadixHeap RadixHeap;
+		ScoredQueue::FBucketQueue BucketQueue;
 
-			Size--;
-			if (Size > 0)
+	public:
+		TStampedArray<double> Scores; // Last registered score per index, MAX_dbl if none since the last Reset
+
+		explicit FScoredQueue(const int32 InSize, const EScoredQueueBackend InBackend = EScoredQueueBackend::BinaryHeap, const double InBucketWidth = 1);
+
+		FORCEINLINE EScoredQueueBackend GetBackend() const { return Backend; }
+
+		FORCEINLINE int32 Num() const
+		{
+			switch (Backend)
 			{
-				Heap[0] = Heap[Size];
-				HeapIndex[Heap[0].Value] = 0;
-				SiftDown(0);
+			default:
+			case EScoredQueueBackend::BinaryHeap: return BinaryHeap.Num();
+			case EScoredQueueBackend::QuaternaryHeap: return QuaternaryHeap.Num();
+			case EScoredQueueBackend::RadixHeap: return RadixHeap.Num();
+			case EScoredQueueBackend::BucketQueue: return BucketQueue.Num();
+			}
+		}
+
+		FORCEINLINE bool IsEmpty() const { return Num() == 0; }
+
+		FORCEINLINE bool Enqueue(const int32 Index, const double InScore)
+		{
+			if (Scores[Index] <= InScore) { return false; }
+			Scores.Set(Index, InScore);
+
+			switch (Backend)
+			{
+			default:
+			case EScoredQueueBackend::BinaryHeap: BinaryHeap.Push(Index, InScore);
+				break;
+			case EScoredQueueBackend::QuaternaryHeap: QuaternaryHeap.Push(Index, InScore);
+				break;
+			case EScoredQueueBackend::RadixHeap: RadixHeap.Push(Index, InScore);
+				break;
+			case EScoredQueueBackend::BucketQueue: BucketQueue.Push(Index, InScore);
+				break;
 			}
 
 			return true;
 		}
 
-		void Reset()
+		FORCEINLINE bool Dequeue(int32& OutItem, double& OutScore)
 		{
-			for (int32 i = 0; i < Size; i++) { HeapIndex[Heap[i].Value] = -1; }
-			Size = 0;
-			for (double& Score : Scores) { Score = MAX_dbl; }
+			switch (Backend)
+			{
+			default:
+			case EScoredQueueBackend::BinaryHeap: return BinaryHeap.Pop(OutItem, OutScore);
+			case EScoredQueueBackend::QuaternaryHeap: return QuaternaryHeap.Pop(OutItem, OutScore);
+			case EScoredQueueBackend::RadixHeap: return RadixHeap.Pop(OutItem, OutScore, Scores);
+			case EScoredQueueBackend::BucketQueue: return BucketQueue.Pop(OutItem, OutScore, Scores);
+			}
 		}
+
+		/** Reset cost is proportional to what the backend still holds, not to the number of indices */
+		void Reset();
 	};
 }
@@ -25,7 +25,7 @@ bool FPCGExActionWriteValuesOperation::PrepareForData(FPCGExContext* InContext,
 		{
 			using T = decltype(DummyValue);
 			const FPCGMetadataAttribute<T>* TypedAttribute = static_cast<FPCGMetadataAttribute<T>*>(AttributeBase);
-			TSharedPtr<PCGExData::TBuffer<T>> Writer = InPointDataFacade->GetWritable<T>(TypedAttribute, PCGExData::EBufferInit::Inherit);
+			TSharedPtr<PCGExData::TBuffer<T>> Writer = InPointDataFacade->GetWritable<T>(TypedAttribute, PCGExData::EBufferInit::Inherit, true); // Only matching points are written
 			SuccessAttributes.Add(AttributeBase);
 			SuccessWriters.Add(Writer);
 		});
@@ -37,7 +37,7 @@ bool FPCGExActionWriteValuesOperation::PrepareForData(FPCGExContext* InContext,
 		{
 			using T = decltype(DummyValue);
 			const FPCGMetadataAttribute<T>* TypedAttribute = static_cast<FPCGMetadataAttribute<T>*>(AttributeBase);
-			TSharedPtr<PCGExData::TBuffer<T>> Writer = InPointDataFacade->GetWritable<T>(TypedAttribute, PCGExData::EBufferInit::Inherit);
+			TSharedPtr<PCGExData::TBuffer<T>> Writer = InPointDataFacade->GetWritable<T>(TypedAttribute, PCGExData::EBufferInit::Inherit, true); // Only matching points are written
 			FailAttributes.Add(AttributeBase);
 			FailWriters.Add(Writer);
 		});
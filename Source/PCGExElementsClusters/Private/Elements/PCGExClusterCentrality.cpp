@@ -124,15 +124,15 @@ namespace PCGExClusterCentrality
 
 		if (!IProcessor::Process(InTaskManager)) { return false; }
 
+		Adjacency = Cluster->GetAdjacency();
 		CentralityScores.Init(0.0, NumNodes);
 
 		// Degree centrality: compute directly, no Dijkstra needed
 		if (Settings->CentralityType == EPCGExCentralityType::Degree)
 		{
-			const TArray<PCGExClusters::FNode>& Nodes = *Cluster->Nodes.Get();
 			for (int32 i = 0; i < NumNodes; i++)
 			{
-				CentralityScores[i] = static_cast<double>(Nodes[i].Links.Num());
+				CentralityScores[i] = static_cast<double>(Adjacency->Num(i));
 			}
 			WriteResults();
 			return true;
@@ -352,7 +352,7 @@ namespace PCGExClusterCentrality
 			Stack.Add(CurrentNode);
 			const PCGExClusters::FNode& Current = *Cluster->GetNode(CurrentNode);
 
-			for (const PCGExGraphs::FLink Lk : Current.Links)
+			for (const PCGExGraphs::FLink Lk : Adjacency->GetLinks(CurrentNode))
 			{
 				const int32 Neighbor = Lk.Node;
 				const int32 EdgeIndex = Lk.Edge;
@@ -416,7 +416,7 @@ namespace PCGExClusterCentrality
 			Stack.Add(CurrentNode);
 			const PCGExClusters::FNode& Current = *Cluster->GetNode(CurrentNode);
 
-			for (const PCGExGraphs::FLink Lk : Current.Links)
+			for (const PCGExGraphs::FLink Lk : Adjacency->GetLinks(CurrentNode))
 			{
 				const int32 Neighbor = Lk.Node;
 				const int32 EdgeIndex = Lk.Edge;
@@ -475,7 +475,7 @@ namespace PCGExClusterCentrality
 			Stack.Add(CurrentNode);
 			const PCGExClusters::FNode& Current = *Cluster->GetNode(CurrentNode);
 
-			for (const PCGExGraphs::FLink Lk : Current.Links)
+			for (const PCGExGraphs::FLink Lk : Adjacency->GetLinks(CurrentNode))
 			{
 				const int32 Neighbor = Lk.Node;
 				const int32 EdgeIndex = Lk.Edge;
@@ -514,7 +514,6 @@ namespace PCGExClusterCentrality
 
 	void FProcessor::ComputeEigenvector()
 	{
-		const TArray<PCGExClusters::FNode>& Nodes = *Cluster->Nodes.Get();
 		const double InitVal = 1.0 / FMath::Sqrt(static_cast<double>(NumNodes));
 
 		TArray<double> X;
@@ -529,7 +528,7 @@ namespace PCGExClusterCentrality
 			for (int32 i = 0; i < NumNodes; i++)
 			{
 				double Sum = 0;
-				for (const PCGExGraphs::FLink Lk : Nodes[i].Links)
+				for (const PCGExGraphs::FLink Lk : Adjacency->GetLinks(i))
 				{
 					Sum += X[Lk.Node];
 				}
@@ -568,7 +567,6 @@ namespace PCGExClusterCentrality
 
 	void FProcessor::ComputeKatz()
 	{
-		const TArray<PCGExClusters::FNode>& Nodes = *Cluster->Nodes.Get();
 		const double Alpha = Settings->KatzAlpha;
 
 		TArray<double> X;
@@ -583,7 +581,7 @@ namespace PCGExClusterCentrality
 			for (int32 i = 0; i < NumNodes; i++)
 			{
 				double Sum = 0;
-				for (const PCGExGraphs::FLink Lk : Nodes[i].Links)
+				for (const PCGExGraphs::FLink Lk : Adjacency->GetLinks(i))
 				{
 					Sum += X[Lk.Node];
 				}
@@ -120,7 +120,7 @@ namespace PCGExEdgeOrder
 		Depths.Init(-1, NumNodes);
 		Seeded.Init(0, NumNodes);
 
-		if (Settings->bUseOctreeSearch) { Cluster->RebuildOctree(Settings->SeedPicking.PickingMethod); }
+		if (Settings->bUseOctreeSearch) { Cluster->RebuildSearchIndex(Settings->SeedPicking.PickingMethod); }
 
 		PCGEX_ASYNC_GROUP_CHKD(TaskManager, SeedPickingGroup)
 
@@ -167,6 +167,7 @@ namespace PCGExClusterCentrality
 		bool bVtxComplete = true;
 		bool bEdgeComplete = false;
 
+		TSharedPtr<const PCGExClusters::FClusterAdjacency> Adjacency;
 		TArray<int32> RandomSamples;
 		TArray<double> DirectedEdgeScores;
 		TArray<double> CentralityScores;
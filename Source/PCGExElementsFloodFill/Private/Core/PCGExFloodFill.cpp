@@ -26,6 +26,7 @@ namespace PCGExFloodFill
 		: FillControlsHandler(InFillControlsHandler), SeedNode(InSeedNode), Cluster(InCluster)
 	{
 		TravelStack = MakeShared<PCGEx::FHashLookupMap>(0, 0);
+		Adjacency = InCluster->GetAdjacency();
 
 		// Pre-allocate visited array for O(1) lookups instead of TSet hashing
 		const int32 NumNodes = InCluster->Nodes->Num();
@@ -70,7 +71,7 @@ namespace PCGExFloodFill
 		const PCGExClusters::FNode& FromNode = *From.Node;
 		FVector FromPosition = Cluster->GetPos(FromNode);
 
-		for (const PCGExGraphs::FLink& Lk : FromNode.Links)
+		for (const PCGExGraphs::FLink& Lk : Adjacency->GetLinks(FromNode.Index))
 		{
 			PCGExClusters::FNode* OtherNode = Cluster->GetNode(Lk);
 			const int32 OtherIndex = OtherNode->Index;
@@ -93,7 +93,7 @@ namespace PCGExBFSDepth
 			for (int32 i = 0; i < VtxDataFacade->GetNum(); i++) { NormalizedDepthData[i] = -1.0; }
 		}
 
-		if (Settings->bUseOctreeSearch) { Cluster->RebuildOctree(Settings->SeedPicking.PickingMethod); }
+		if (Settings->bUseOctreeSearch) { Cluster->RebuildSearchIndex(Settings->SeedPicking.PickingMethod); }
 
 
 		PCGEX_ASYNC_GROUP_CHKD(TaskManager, SeedPickingGroup)
@@ -154,6 +154,7 @@ namespace PCGExBFSDepth
 		}
 
 		const TArray<PCGExClusters::FNode>& Nodes = *Cluster->Nodes;
+		const PCGExClusters::FClusterAdjacency& Adjacency = *Cluster->GetAdjacency();
 		const bool bComputeDistance = DistanceData != nullptr;
 		const bool bTrackSeedOwner = SeedIndexData != nullptr;
 		const bool bTrackParents = !Parents.IsEmpty();
@@ -197,12 +198,11 @@ namespace PCGExBFSDepth
 			while (Head < Queue.Num())
 			{
 				const int32 CurrentIdx = Queue[Head++];
-				const PCGExClusters::FNode& Current = Nodes[CurrentIdx];
 				const FVector CurrentPos = Cluster->GetPos(CurrentIdx);
 				const int32 NextDepth = Depths[CurrentIdx] + 1;
 				const double CurrentDist = Distances[CurrentIdx];
 
-				for (const PCGExGraphs::FLink& Lk : Current.Links)
+				for (const PCGExGraphs::FLink& Lk : Adjacency.GetLinks(CurrentIdx))
 				{
 					if (Depths[Lk.Node] != -1) { continue; }
 
@@ -235,10 +235,9 @@ namespace PCGExBFSDepth
 			while (Head < Queue.Num())
 			{
 				const int32 CurrentIdx = Queue[Head++];
-				const PCGExClusters::FNode& Current = Nodes[CurrentIdx];
 				const int32 NextDepth = Depths[CurrentIdx] + 1;
 
-				for (const PCGExGraphs::FLink& Lk : Current.Links)
+				for (const PCGExGraphs::FLink& Lk : Adjacency.GetLinks(CurrentIdx))
 				{
 					if (Depths[Lk.Node] != -1) { continue; }
 
@@ -154,7 +154,7 @@ namespace PCGExClusterDiffusion
 			This->InitialDiffusions = MakeShared<PCGExMT::TScopedArray<TSharedPtr<PCGExFloodFill::FDiffusion>>>(Loops);
 		};
 
-		if (Settings->bUseOctreeSearch) { Cluster->RebuildOctree(Settings->Seeds.SeedPicking.PickingMethod); }
+		if (Settings->bUseOctreeSearch) { Cluster->RebuildSearchIndex(Settings->Seeds.SeedPicking.PickingMethod); }
 
 		DiffusionInitialization->OnSubLoopStartCallback = [PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
 		{
@@ -211,6 +211,7 @@ namespace PCGExFloodFill
 
 		TSharedPtr<PCGEx::FHashLookupMap> TravelStack; // Required for FillControls & Heuristics
 		TSharedPtr<PCGExClusters::FCluster> Cluster;
+		TSharedPtr<const PCGExClusters::FClusterAdjacency> Adjacency;
 
 		TArray<FCandidate> Candidates;
 		TArray<FCandidate> Captured;
@@ -107,15 +107,13 @@ namespace PCGExSortPoints
 
 		if (TSharedPtr<PCGExSorting::FSortCache> Cache = Sorter->BuildCache(NumPoints))
 		{
-			Order.Sort([&](const int32 A, const int32 B) { return Cache->Compare(A, B); });
+			Cache->SortIndices(Order);
 		}
 		else
 		{
 			Order.Sort([&](const int32 A, const int32 B) { return Sorter->Sort(A, B); });
 		}
 
-		Order.Sort([&](const int32 A, const int32 B) { return Sorter->Sort(A, B); });
-
 		PointDataFacade->Source->InheritPoints(Order, 0);
 
 		return true;
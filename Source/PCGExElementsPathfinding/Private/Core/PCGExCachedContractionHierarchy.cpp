@@ -0,0 +1,437 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Core/PCGExCachedContractionHierarchy.h"
+
+#include "PCGExH.h"
+#include "Clusters/PCGExCluster.h"
+#include "Containers/PCGExHashLookup.h"
+#include "Core/PCGExSearchAllocations.h"
+#include "Core/PCGExStaticEdgeCosts.h"
+#include "Utils/PCGExScoredQueue.h"
+
+#define LOCTEXT_NAMESPACE "PCGExCachedContractionHierarchy"
+
+namespace PCGExPathfinding
+{
+	namespace ContractionHierarchyHelpers
+	{
+		// Max number of nodes a single witness search may settle before giving up and adding the shortcut
+		constexpr int32 WitnessSettleLimit = 128;
+	}
+
+#pragma region FCachedContractionHierarchy
+
+	bool FCachedContractionHierarchy::FindPath(const int32 Seed, const int32 Goal, FBidirectionalSearchAllocations& Allocations, TArray<int32>& OutNodes, TArray<int32>& OutEdges) const
+	{
+		OutNodes.Reset();
+		OutEdges.Reset();
+
+		if (!Rank.IsValidIndex(Seed) || !Rank.IsValidIndex(Goal)) { return false; }
+
+		PCGEx::TStampedArray<double>& DistForward = Allocations.GScore;
+		PCGEx::TStampedArray<double>& DistBackward = Allocations.GScoreBackward;
+
+		DistForward.Set(Seed, 0);
+		Allocations.ScoredQueue->Enqueue(Seed, 0);
+
+		DistBackward.Set(Goal, 0);
+		Allocations.ScoredQueueBackward->Enqueue(Goal, 0);
+
+		double BestCost = MAX_dbl;
+		int32 MeetingNode = -1;
+
+		auto Step = [&](
+			PCGEx::FScoredQueue& Queue, PCGEx::FStampedFlags& Settled,
+			PCGEx::TStampedArray<double>& Dist, const PCGEx::TStampedArray<double>& OtherDist,
+			PCGEx::FHashLookup& TravelStack,
+			const TArray<int32>& Offsets, const TArray<int32>& ArcList, const bool bUpward)
+		{
+			int32 CurrentIndex;
+			double CurrentScore;
+			if (!Queue.Dequeue(CurrentIndex, CurrentScore)) { return; }
+
+			// Nothing left on this side can improve on the best path
+			if (CurrentScore >= BestCost)
+			{
+				Queue.Reset();
+				return;
+			}
+
+			if (Settled[CurrentIndex]) { return; }
+			Settled.Set(CurrentIndex);
+
+			if (OtherDist.IsSet(CurrentIndex))
+			{
+				const double PathCost = CurrentScore + OtherDist[CurrentIndex];
+				if (PathCost < BestCost)
+				{
+					BestCost = PathCost;
+					MeetingNode = CurrentIndex;
+				}
+			}
+
+			for (int32 i = Offsets[CurrentIndex]; i < Offsets[CurrentIndex + 1]; i++)
+			{
+				const int32 ArcIndex = ArcList[i];
+				const FArc& Arc = Arcs[ArcIndex];
+				const int32 NeighborIndex = bUpward ? Arc.To : Arc.From;
+				const double TentativeScore = CurrentScore + Arc.Cost;
+
+				if (Dist.IsSet(NeighborIndex) && TentativeScore >= Dist[NeighborIndex]) { continue; }
+
+				Dist.Set(NeighborIndex, TentativeScore);
+				TravelStack.Set(NeighborIndex, PCGEx::NH64(CurrentIndex, ArcIndex));
+				Queue.Enqueue(NeighborIndex, TentativeScore);
+			}
+		};
+
+		PCGEx::FScoredQueue& QueueForward = *Allocations.ScoredQueue;
+		PCGEx::FScoredQueue& QueueBackward = *Allocations.ScoredQueueBackward;
+
+		bool bForwardTurn = true;
+		while (!QueueForward.IsEmpty() || !QueueBackward.IsEmpty())
+		{
+			if (QueueBackward.IsEmpty() || (bForwardTurn && !QueueForward.IsEmpty()))
+			{
+				Step(QueueForward, Allocations.Visited, DistForward, DistBackward, *Allocations.TravelStack, UpOffsets, UpArcs, true);
+			}
+			else
+			{
+				Step(QueueBackward, Allocations.VisitedBackward, DistBackward, DistForward, *Allocations.TravelStackBackward, DownOffsets, DownArcs, false);
+			}
+
+			bForwardTurn = !bForwardTurn;
+		}
+
+		if (MeetingNode == -1) { return false; }
+
+		// Gather hierarchy arcs from seed to goal
+		TArray<int32, TInlineAllocator<64>> PathArcs;
+
+		int32 CurrentIndex = MeetingNode;
+		while (CurrentIndex != Seed)
+		{
+			int32 PrevIndex, ArcIndex;
+			PCGEx::NH64(Allocations.TravelStack->Get(CurrentIndex), PrevIndex, ArcIndex);
+			if (PrevIndex == -1) { return false; }
+			PathArcs.Add(ArcIndex);
+			CurrentIndex = PrevIndex;
+		}
+
+		Algo::Reverse(PathArcs);
+
+		CurrentIndex = MeetingNode;
+		while (CurrentIndex != Goal)
+		{
+			int32 NextIndex, ArcIndex;
+			PCGEx::NH64(Allocations.TravelStackBackward->Get(CurrentIndex), NextIndex, ArcIndex);
+			if (NextIndex == -1) { return false; }
+			PathArcs.Add(ArcIndex);
+			CurrentIndex = NextIndex;
+		}
+
+		OutNodes.Add(Seed);
+		for (const int32 ArcIndex : PathArcs) { UnpackArc(ArcIndex, OutNodes, OutEdges); }
+
+		return true;
+	}
+
+	void FCachedContractionHierarchy::UnpackArc(const int32 ArcIndex, TArray<int32>& OutNodes, TArray<int32>& OutEdges) const
+	{
+		TArray<int32, TInlineAllocator<32>> Stack;
+		Stack.Add(ArcIndex);
+
+		while (!Stack.IsEmpty())
+		{
+			const FArc& Arc = Arcs[Stack.Pop(EAllowShrinking::No)];
+
+			if (Arc.IsShortcut())
+			{
+				// Push in reverse so the From -> Via half is expanded first
+				Stack.Add(Arc.ChildB);
+				Stack.Add(Arc.ChildA);
+				continue;
+			}
+
+			OutNodes.Add(Arc.To);
+			OutEdges.Add(Arc.Edge);
+		}
+	}
+
+#pragma endregion
+
+#pragma region FContractionHierarchyCacheFactory
+
+	FText FContractionHierarchyCacheFactory::GetDisplayName() const
+	{
+		return LOCTEXT("DisplayName", "Pathfinding Contraction Hierarchy");
+	}
+
+	FText FContractionHierarchyCacheFactory::GetTooltip() const
+	{
+		return LOCTEXT("Tooltip", "Contraction hierarchy used to answer shortest path queries when heuristics have static edge scores.");
+	}
+
+#pragma endregion
+
+#pragma region ContractionHierarchyHelpers
+
+	namespace ContractionHierarchyHelpers
+	{
+		TSharedPtr<FCachedContractionHierarchy> GetOrBuildContractionHierarchy(PCGExClusters::FCluster* Cluster, const FStaticEdgeCosts& Costs)
+		{
+			if (TSharedPtr<FCachedContractionHierarchy> Cached = Cluster->GetCachedData<FCachedContractionHierarchy>(FContractionHierarchyCacheFactory::CacheKey, Costs.Hash)) { return Cached; }
+
+			TSharedPtr<FCachedContractionHierarchy> NewHierarchy = BuildContractionHierarchy(Cluster, Costs);
+			if (!NewHierarchy) { return nullptr; }
+
+			NewHierarchy->ContextHash = Costs.Hash;
+			Cluster->SetCachedData(FContractionHierarchyCacheFactory::CacheKey, NewHierarchy);
+
+			return NewHierarchy;
+		}
+
+		TSharedPtr<FCachedContractionHierarchy> BuildContractionHierarchy(const PCGExClusters::FCluster* Cluster, const FStaticEdgeCosts& Costs)
+		{
+			using FArc = FCachedContractionHierarchy::FArc;
+
+			const TArray<PCGExClusters::FNode>& NodesRef = *Cluster->Nodes;
+			const int32 NumNodes = NodesRef.Num();
+			if (!NumNodes) { return nullptr; }
+
+			const TSharedPtr<FCachedContractionHierarchy> Hierarchy = MakeShared<FCachedContractionHierarchy>();
+			TArray<FArc>& Arcs = Hierarchy->Arcs;
+			Arcs.Reserve(Costs.NumLinks() * 2);
+
+			// Working graph; arcs to contracted nodes are left in place and skipped
+			TArray<TArray<int32>> OutArcs;
+			TArray<TArray<int32>> InArcs;
+			OutArcs.SetNum(NumNodes);
+			InArcs.SetNum(NumNodes);
+
+			auto AddArc = [&](const FArc& InArc)
+			{
+				if (InArc.From == InArc.To) { return false; }
+
+				for (int32& ArcIndex : OutArcs[InArc.From])
+				{
+					if (Arcs[ArcIndex].To != InArc.To) { continue; }
+					if (Arcs[ArcIndex].Cost <= InArc.Cost) { return false; }
+
+					// Cheaper than the existing arc between the same nodes, supersede it.
+					// The old arc stays in the array since shortcuts may still unpack through it.
+					const int32 Superseded = ArcIndex;
+					ArcIndex = Arcs.Add(InArc);
+
+					TArray<int32>& Incoming = InArcs[InArc.To];
+					Incoming[Incoming.Find(Superseded)] = ArcIndex;
+					return true;
+				}
+
+				const int32 NewIndex = Arcs.Add(InArc);
+				OutArcs[InArc.From].Add(NewIndex);
+				InArcs[InArc.To].Add(NewIndex);
+				return true;
+			};
+
+			for (int32 i = 0; i < NumNodes; i++)
+			{
+				const PCGExClusters::FNode& Node = NodesRef[i];
+				for (int32 l = 0; l < Node.Links.Num(); l++) { AddArc(FArc(i, Node.Links[l].Node, Costs.GetCost(i, l), Node.Links[l].Edge)); }
+			}
+
+			TArray<bool> Contracted;
+			TArray<int32> DeletedNeighbors;
+			TArray<int32>& Rank = Hierarchy->Rank;
+			Contracted.Init(false, NumNodes);
+			DeletedNeighbors.Init(0, NumNodes);
+			Rank.Init(-1, NumNodes);
+
+			// Witness search : is there a path from Source that avoids the node being contracted and is no longer than the shortcut?
+
+			struct FWitnessItem
+			{
+				double Dist;
+				int32 Node;
+			};
+
+			auto WitnessPredicate = [](const FWitnessItem& A, const FWitnessItem& B) { return A.Dist < B.Dist; };
+
+			TArray<double> WitnessDist;
+			TArray<int32> Touched;
+			TArray<FWitnessItem> WitnessHeap;
+			WitnessDist.Init(MAX_dbl, NumNodes);
+
+			auto WitnessSearch = [&](const int32 Source, const int32 Excluded, const double MaxCost)
+			{
+				for (const int32 Index : Touched) { WitnessDist[Index] = MAX_dbl; }
+				Touched.Reset();
+				WitnessHeap.Reset();
+
+				WitnessDist[Source] = 0;
+				Touched.Add(Source);
+				WitnessHeap.HeapPush(FWitnessItem{0, Source}, WitnessPredicate);
+
+				int32 NumSettled = 0;
+				while (!WitnessHeap.IsEmpty() && NumSettled < WitnessSettleLimit)
+				{
+					FWitnessItem Item;
+					WitnessHeap.HeapPop(Item, WitnessPredicate, EAllowShrinking::No);
+
+					if (Item.Dist > WitnessDist[Item.Node]) { continue; }
+					if (Item.Dist > MaxCost) { break; }
+
+					NumSettled++;
+
+					for (const int32 ArcIndex : OutArcs[Item.Node])
+					{
+						const FArc& Arc = Arcs[ArcIndex];
+						if (Arc.To == Excluded || Contracted[Arc.To]) { continue; }
+
+						const double Dist = Item.Dist + Arc.Cost;
+						if (Dist > MaxCost || Dist >= WitnessDist[Arc.To]) { continue; }
+
+						if (WitnessDist[Arc.To] == MAX_dbl) { Touched.Add(Arc.To); }
+						WitnessDist[Arc.To] = Dist;
+						WitnessHeap.HeapPush(FWitnessItem{Dist, Arc.To}, WitnessPredicate);
+					}
+				}
+			};
+
+			// Shortcuts required to contract a node in the current state of the working graph
+
+			TArray<FArc> Shortcuts;
+
+			auto FindShortcuts = [&](const int32 NodeIndex)
+			{
+				Shortcuts.Reset();
+
+				for (const int32 InIndex : InArcs[NodeIndex])
+				{
+					const FArc In = Arcs[InIndex];
+					if (Contracted[In.From]) { continue; }
+
+					double MaxCost = -1;
+					for (const int32 OutIndex : OutArcs[NodeIndex])
+					{
+						const FArc& Out = Arcs[OutIndex];
+						if (Contracted[Out.To] || Out.To == In.From) { continue; }
+						MaxCost = FMath::Max(MaxCost, In.Cost + Out.Cost);
+					}
+
+					if (MaxCost < 0) { continue; }
+
+					WitnessSearch(In.From, NodeIndex, MaxCost);
+
+					for (const int32 OutIndex : OutArcs[NodeIndex])
+					{
+						const FArc& Out = Arcs[OutIndex];
+						if (Contracted[Out.To] || Out.To == In.From) { continue; }
+
+						const double Cost = In.Cost + Out.Cost;
+						if (WitnessDist[Out.To] <= Cost) { continue; }
+
+						Shortcuts.Emplace(In.From, Out.To, Cost, -1, InIndex, OutIndex);
+					}
+				}
+			};
+
+			// Edge difference : shortcuts added minus arcs removed, plus already contracted neighbors to spread contraction evenly
+			auto GetPriority = [&](const int32 NodeIndex)
+			{
+				FindShortcuts(NodeIndex);
+
+				int32 NumRemoved = 0;
+				for (const int32 ArcIndex : OutArcs[NodeIndex]) { if (!Contracted[Arcs[ArcIndex].To]) { NumRemoved++; } }
+				for (const int32 ArcIndex : InArcs[NodeIndex]) { if (!Contracted[Arcs[ArcIndex].From]) { NumRemoved++; } }
+
+				return Shortcuts.Num() - NumRemoved + DeletedNeighbors[NodeIndex];
+			};
+
+			struct FQueuedNode
+			{
+				int32 Priority;
+				int32 Node;
+			};
+
+			auto QueuePredicate = [](const FQueuedNode& A, const FQueuedNode& B) { return A.Priority < B.Priority || (A.Priority == B.Priority && A.Node < B.Node); };
+
+			TArray<FQueuedNode> Queue;
+			Queue.SetNumUninitialized(NumNodes);
+			for (int32 i = 0; i < NumNodes; i++) { Queue[i] = FQueuedNode{GetPriority(i), i}; }
+			Queue.Heapify(QueuePredicate);
+
+			TArray<TArray<int32>> UpLists;
+			TArray<TArray<int32>> DownLists;
+			UpLists.SetNum(NumNodes);
+			DownLists.SetNum(NumNodes);
+
+			int32 NextRank = 0;
+			while (!Queue.IsEmpty())
+			{
+				FQueuedNode Item;
+				Queue.HeapPop(Item, QueuePredicate, EAllowShrinking::No);
+
+				const int32 NodeIndex = Item.Node;
+
+				// Lazy update : priorities go stale as neighbors get contracted
+				const int32 Priority = GetPriority(NodeIndex);
+				if (!Queue.IsEmpty() && Priority > Queue.HeapTop().Priority)
+				{
+					Queue.HeapPush(FQueuedNode{Priority, NodeIndex}, QueuePredicate);
+					continue;
+				}
+
+				// Remaining arcs all lead to nodes that will be ranked higher
+				for (const int32 ArcIndex : OutArcs[NodeIndex])
+				{
+					const int32 To = Arcs[ArcIndex].To;
+					if (Contracted[To]) { continue; }
+					UpLists[NodeIndex].Add(ArcIndex);
+					DeletedNeighbors[To]++;
+				}
+
+				for (const int32 ArcIndex : InArcs[NodeIndex])
+				{
+					const int32 From = Arcs[ArcIndex].From;
+					if (Contracted[From]) { continue; }
+					DownLists[NodeIndex].Add(ArcIndex);
+					DeletedNeighbors[From]++;
+				}
+
+				Contracted[NodeIndex] = true;
+				Rank[NodeIndex] = NextRank++;
+
+				// Shortcuts were found by GetPriority, against the current working graph
+				for (const FArc& Shortcut : Shortcuts) { if (AddArc(Shortcut)) { Hierarchy->NumShortcuts++; } }
+			}
+
+			auto Flatten = [&](const TArray<TArray<int32>>& Lists, TArray<int32>& OutOffsets, TArray<int32>& OutList)
+			{
+				OutOffsets.SetNumUninitialized(NumNodes + 1);
+
+				int32 Num = 0;
+				for (int32 i = 0; i < NumNodes; i++)
+				{
+					OutOffsets[i] = Num;
+					Num += Lists[i].Num();
+				}
+				OutOffsets[NumNodes] = Num;
+
+				OutList.Reserve(Num);
+				for (const TArray<int32>& List : Lists) { OutList.Append(List); }
+			};
+
+			Flatten(UpLists, Hierarchy->UpOffsets, Hierarchy->UpArcs);
+			Flatten(DownLists, Hierarchy->DownOffsets, Hierarchy->DownArcs);
+			Arcs.Shrink();
+
+			return Hierarchy;
+		}
+	}
+
+#pragma endregion
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,162 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Core/PCGExCachedLandmarks.h"
+
+#include "Clusters/PCGExCluster.h"
+#include "Core/PCGExMTCommon.h"
+#include "Core/PCGExStaticEdgeCosts.h"
+#include "Utils/PCGExScoredQueue.h"
+
+#define LOCTEXT_NAMESPACE "PCGExCachedLandmarks"
+
+namespace PCGExPathfinding
+{
+#pragma region FLandmarksCacheFactory
+
+	FText FLandmarksCacheFactory::GetDisplayName() const
+	{
+		return LOCTEXT("DisplayName", "Pathfinding Landmarks");
+	}
+
+	FText FLandmarksCacheFactory::GetTooltip() const
+	{
+		return LOCTEXT("Tooltip", "Landmark distance tables used as A* lower bounds (ALT) when heuristics have static edge scores.");
+	}
+
+#pragma endregion
+
+#pragma region LandmarkHelpers
+
+	namespace LandmarkHelpers
+	{
+		TSharedPtr<FCachedLandmarks> GetOrBuildLandmarks(PCGExClusters::FCluster* Cluster, const FStaticEdgeCosts& Costs, const int32 NumLandmarks)
+		{
+			uint32 Hash = HashCombineFast(Costs.Hash, GetTypeHash(NumLandmarks));
+			if (!Hash) { Hash = 1; }
+
+			if (TSharedPtr<FCachedLandmarks> Cached = Cluster->GetCachedData<FCachedLandmarks>(FLandmarksCacheFactory::CacheKey, Hash)) { return Cached; }
+
+			TSharedPtr<FCachedLandmarks> NewLandmarks = BuildLandmarks(Cluster, Costs, NumLandmarks);
+			if (!NewLandmarks) { return nullptr; }
+
+			NewLandmarks->ContextHash = Hash;
+			Cluster->SetCachedData(FLandmarksCacheFactory::CacheKey, NewLandmarks);
+
+			return NewLandmarks;
+		}
+
+		TSharedPtr<FCachedLandmarks> BuildLandmarks(const PCGExClusters::FCluster* Cluster, const FStaticEdgeCosts& Costs, const int32 NumLandmarks)
+		{
+			const int32 NumNodes = Cluster->Nodes->Num();
+			const int32 MaxLandmarks = FMath::Min(NumLandmarks, NumNodes);
+			if (MaxLandmarks <= 0) { return nullptr; }
+
+			TArray<int32> Landmarks;
+			TArray<TArray<double>> Forward;
+			Landmarks.Reserve(MaxLandmarks);
+			Forward.Reserve(MaxLandmarks);
+
+			TArray<double> MinDistances;
+			MinDistances.Init(MAX_dbl, NumNodes);
+
+			// Start from the node farthest away from an arbitrary one, so the first landmark sits on the periphery
+			auto PickFarthest = [&](const TArray<double>& Distances)
+			{
+				int32 Best = -1;
+				double BestDist = 0;
+				for (int32 i = 0; i < NumNodes; i++)
+				{
+					const double Dist = Distances[i];
+					if (Dist == MAX_dbl || Dist <= BestDist) { continue; }
+					Best = i;
+					BestDist = Dist;
+				}
+				return Best;
+			};
+
+			TArray<double> Distances;
+			ComputeDistances(Cluster, Costs, 0, false, Distances);
+			int32 Next = PickFarthest(Distances);
+			if (Next == -1) { Next = 0; }
+
+			while (Next != -1 && Landmarks.Num() < MaxLandmarks)
+			{
+				Landmarks.Add(Next);
+				TArray<double>& LandmarkDistances = Forward.Emplace_GetRef();
+				ComputeDistances(Cluster, Costs, Next, false, LandmarkDistances);
+
+				// Next landmark is the node farthest from all the picked ones
+				for (int32 i = 0; i < NumNodes; i++) { MinDistances[i] = FMath::Min(MinDistances[i], LandmarkDistances[i]); }
+				Next = PickFarthest(MinDistances);
+			}
+
+			const int32 NumPicked = Landmarks.Num();
+
+			TArray<TArray<double>> Backward;
+			Backward.SetNum(NumPicked);
+			PCGEX_PARALLEL_FOR_THRESHOLD(
+				NumPicked, 2,
+				ComputeDistances(Cluster, Costs, Landmarks[i], true, Backward[i]);
+			)
+
+			const TSharedPtr<FCachedLandmarks> NewLandmarks = MakeShared<FCachedLandmarks>();
+			NewLandmarks->NumLandmarks = NumPicked;
+			NewLandmarks->Landmarks = MoveTemp(Landmarks);
+			NewLandmarks->FromLandmark.SetNumUninitialized(NumNodes * NumPicked);
+			NewLandmarks->ToLandmark.SetNumUninitialized(NumNodes * NumPicked);
+
+			double* FromL = NewLandmarks->FromLandmark.GetData();
+			double* ToL = NewLandmarks->ToLandmark.GetData();
+
+			PCGEX_PARALLEL_FOR(
+				NumNodes,
+				const int32 Offset = i * NumPicked;
+				for (int32 l = 0; l < NumPicked; l++)
+				{
+					FromL[Offset + l] = Forward[l][i];
+					ToL[Offset + l] = Backward[l][i];
+				}
+			)
+
+			return NewLandmarks;
+		}
+
+		void ComputeDistances(const PCGExClusters::FCluster* Cluster, const FStaticEdgeCosts& Costs, const int32 Source, const bool bReverse, TArray<double>& OutDistances)
+		{
+			const TArray<PCGExClusters::FNode>& NodesRef = *Cluster->Nodes;
+			const int32 NumNodes = NodesRef.Num();
+
+			OutDistances.Init(MAX_dbl, NumNodes);
+			if (!NodesRef.IsValidIndex(Source)) { return; }
+
+			// Costs are non-negative, scores are monotone
+			PCGEx::FScoredQueue Queue(NumNodes, PCGEx::EScoredQueueBackend::RadixHeap);
+
+			OutDistances[Source] = 0;
+			Queue.Enqueue(Source, 0);
+
+			int32 CurrentIndex;
+			double CurrentDist;
+			while (Queue.Dequeue(CurrentIndex, CurrentDist))
+			{
+				if (CurrentDist > OutDistances[CurrentIndex]) { continue; }
+
+				const PCGExClusters::FNode& Current = NodesRef[CurrentIndex];
+				for (int32 l = 0; l < Current.Links.Num(); l++)
+				{
+					const int32 NeighborIndex = Current.Links[l].Node;
+					const double Dist = CurrentDist + (bReverse ? Costs.GetReverseCost(CurrentIndex, l) : Costs.GetCost(CurrentIndex, l));
+					if (Dist >= OutDistances[NeighborIndex]) { continue; }
+
+					OutDistances[NeighborIndex] = Dist;
+					Queue.Enqueue(NeighborIndex, Dist);
+				}
+			}
+		}
+	}
+
+#pragma endregion
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -8,6 +8,7 @@
 #include "Data/PCGExPointIO.h"
 #include "Clusters/PCGExCluster.h"
 #include "Core/PCGExPathQuery.h"
+#include "Core/PCGExSearchAllocations.h"
 #include "Search/PCGExSearchOperation.h"
 
 namespace PCGExPathfinding
@@ -40,7 +41,7 @@ namespace PCGExPathfinding
 		}
 	}
 
-	void FPlotQuery::FindPaths(const TSharedPtr<PCGExMT::FTaskManager>& TaskManager, const TSharedPtr<FPCGExSearchOperation>& SearchOperation, const TSharedPtr<FSearchAllocations>& Allocations, const TSharedPtr<PCGExHeuristics::FHandler>& HeuristicsHandler)
+	void FPlotQuery::FindPaths(const TSharedPtr<PCGExMT::FTaskManager>& TaskManager, const TSharedPtr<FPCGExSearchOperation>& SearchOperation, const TSharedPtr<FSearchAllocations>& Allocations, const TSharedPtr<PCGExHeuristics::FHandler>& HeuristicsHandler, const TSharedPtr<FSearchAllocationsPool>& AllocationsPool)
 	{
 		PCGEX_ASYNC_GROUP_CHKD_VOID(TaskManager, PlotTasks)
 
@@ -54,11 +55,13 @@ namespace PCGExPathfinding
 			if (This->OnCompleteCallback) { This->OnCompleteCallback(This); }
 		};
 
-		PlotTasks->OnSubLoopStartCallback = [PCGEX_ASYNC_THIS_CAPTURE, SearchOperation, Allocations, HeuristicsHandler](const PCGExMT::FScope& Scope)
+		PlotTasks->OnSubLoopStartCallback = [PCGEX_ASYNC_THIS_CAPTURE, SearchOperation, Allocations, AllocationsPool, HeuristicsHandler](const PCGExMT::FScope& Scope)
 		{
 			PCGEX_ASYNC_THIS
 			TSharedPtr<FSearchAllocations> LocalAllocations = Allocations;
-			if (!Allocations) { LocalAllocations = SearchOperation->NewAllocations(); }
+			if (!LocalAllocations) { LocalAllocations = AllocationsPool ? AllocationsPool->Acquire() : SearchOperation->NewAllocations(); }
+			ON_SCOPE_EXIT { if (!Allocations && AllocationsPool) { AllocationsPool->Release(LocalAllocations); } };
+
 			PCGEX_SCOPE_LOOP(Index)
 			{
 				This->SubQueries[Index]->FindPath(SearchOperation, LocalAllocations, HeuristicsHandler, This->LocalFeedbackHandler);
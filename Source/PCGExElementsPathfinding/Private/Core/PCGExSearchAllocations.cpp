@@ -7,34 +7,71 @@
 #include "Clusters/PCGExCluster.h"
 #include "Containers/PCGExHashLookup.h"
 #include "Utils/PCGExScoredQueue.h"
+#include "Search/PCGExSearchOperation.h"
 
 namespace PCGExPathfinding
 {
 	void FSearchAllocations::Reset()
 	{
-		if (GScore.Num() == Visited.Num())
-		{
-			for (int i = 0; i < NumNodes; i++)
-			{
-				Visited[i] = false;
-				GScore[i] = -1;
-			}
-		}
-		else
-		{
-			for (int i = 0; i < NumNodes; i++) { Visited[i] = false; }
-		}
-
+		Visited.Reset();
+		GScore.Reset();
 		TravelStack->Reset();
 		ScoredQueue->Reset();
 	}
 
-	void FSearchAllocations::Init(const PCGExClusters::FCluster* InCluster)
+	void FSearchAllocations::Init(const PCGExClusters::FCluster* InCluster, const PCGEx::EScoredQueueBackend InQueueBackend, const double InQueueBucketWidth)
 	{
 		NumNodes = InCluster->Nodes->Num();
+		QueueBackend = InQueueBackend;
+		QueueBucketWidth = InQueueBucketWidth;
+
+		Visited.Init(NumNodes);
+		TravelStack = PCGEx::NewHashLookup<PCGEx::FHashLookupStamped>(PCGEx::NH64(-1, -1), NumNodes);
+		ScoredQueue = MakeShared<PCGEx::FScoredQueue>(NumNodes, QueueBackend, QueueBucketWidth);
+	}
+
+	void FBidirectionalSearchAllocations::Init(const PCGExClusters::FCluster* InCluster, const PCGEx::EScoredQueueBackend InQueueBackend, const double InQueueBucketWidth)
+	{
+		FSearchAllocations::Init(InCluster, InQueueBackend, InQueueBucketWidth);
+
+		GScore.Init(-1, NumNodes);
+		VisitedBackward.Init(NumNodes);
+		GScoreBackward.Init(-1, NumNodes);
+		TravelStackBackward = PCGEx::NewHashLookup<PCGEx::FHashLookupStamped>(PCGEx::NH64(-1, -1), NumNodes);
+		ScoredQueueBackward = MakeShared<PCGEx::FScoredQueue>(NumNodes, QueueBackend, QueueBucketWidth);
+	}
+
+	void FBidirectionalSearchAllocations::Reset()
+	{
+		FSearchAllocations::Reset();
+
+		VisitedBackward.Reset();
+		GScoreBackward.Reset();
+		TravelStackBackward->Reset();
+		ScoredQueueBackward->Reset();
+	}
+
+	FSearchAllocationsPool::FSearchAllocationsPool(const TSharedPtr<FPCGExSearchOperation>& InSearchOperation)
+		: SearchOperation(InSearchOperation), Cluster(InSearchOperation->Cluster)
+	{
+	}
+
+	TSharedPtr<FSearchAllocations> FSearchAllocationsPool::Acquire()
+	{
+		{
+			FScopeLock Lock(&PoolLock);
+			if (!Available.IsEmpty()) { return Available.Pop(EAllowShrinking::No); }
+		}
+
+		return SearchOperation->NewAllocations();
+	}
+
+	void FSearchAllocationsPool::Release(const TSharedPtr<FSearchAllocations>& InAllocations)
+	{
+		if (!InAllocations) { return; }
+		check(InAllocations->GetNumNodes() == Cluster->Nodes->Num())
 
-		Visited.Init(false, NumNodes);
-		TravelStack = PCGEx::NewHashLookup<PCGEx::FHashLookupArray>(PCGEx::NH64(-1, -1), NumNodes);
-		ScoredQueue = MakeShared<PCGEx::FScoredQueue>(NumNodes);
+		FScopeLock Lock(&PoolLock);
+		Available.Add(InAllocations);
 	}
 }
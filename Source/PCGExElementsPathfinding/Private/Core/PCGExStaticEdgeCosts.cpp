@@ -0,0 +1,66 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Core/PCGExStaticEdgeCosts.h"
+
+#include "PCGExHeuristicsHandler.h"
+#include "Clusters/PCGExCluster.h"
+#include "Core/PCGExHeuristicScoreTable.h"
+#include "Core/PCGExMTCommon.h"
+
+namespace PCGExPathfinding
+{
+	int32 FStaticEdgeCosts::NumNodes() const { return Table->NumNodes(); }
+	int32 FStaticEdgeCosts::NumLinks() const { return Table->NumLinks(); }
+	double FStaticEdgeCosts::GetCost(const int32 NodeIndex, const int32 LinkIndex) const { return Table->Scores[Table->Adjacency->GetOffset(NodeIndex) + LinkIndex]; }
+	double FStaticEdgeCosts::GetReverseCost(const int32 NodeIndex, const int32 LinkIndex) const { return Table->Scores[ReverseLinks[Table->Adjacency->GetOffset(NodeIndex) + LinkIndex]]; }
+
+	TSharedPtr<FStaticEdgeCosts> FStaticEdgeCosts::Make(const PCGExClusters::FCluster* InCluster, const PCGExHeuristics::FHandler& InHeuristics)
+	{
+		if (!InCluster || !InHeuristics.ScoreTable) { return nullptr; }
+
+		const TSharedPtr<const PCGExHeuristics::FHeuristicScoreTable> Table = InHeuristics.ScoreTable;
+		const TArray<PCGExClusters::FNode>& NodesRef = *InCluster->Nodes;
+		const int32 NumNodes = NodesRef.Num();
+
+		if (Table->NumNodes() != NumNodes) { return nullptr; }
+
+		// Acceleration structures rely on non-negative costs
+		for (const double Cost : Table->Scores) { if (!FMath::IsFinite(Cost) || Cost < 0) { return nullptr; } }
+
+		const TSharedPtr<FStaticEdgeCosts> NewCosts = MakeShared<FStaticEdgeCosts>();
+		NewCosts->Table = Table;
+
+		const PCGExClusters::FClusterAdjacency& Adjacency = *Table->Adjacency;
+		const TArray<int32>& Offsets = Adjacency.Offsets;
+		TArray<int32>& ReverseLinks = NewCosts->ReverseLinks;
+		ReverseLinks.SetNumUninitialized(Table->NumLinks());
+
+		PCGEX_PARALLEL_FOR(
+			NumNodes,
+
+			const TConstArrayView<PCGExGraphs::FLink> Links = Adjacency.GetLinks(i);
+			const int32 Offset = Offsets[i];
+
+			for (int32 l = 0; l < Links.Num(); l++)
+			{
+				const PCGExGraphs::FLink Lk = Links[l];
+				const TConstArrayView<PCGExGraphs::FLink> OtherLinks = Adjacency.GetLinks(Lk.Node);
+
+				ReverseLinks[Offset + l] = Offset + l;
+				for (int32 r = 0; r < OtherLinks.Num(); r++)
+				{
+					if (OtherLinks[r].Edge != Lk.Edge || OtherLinks[r].Node != i) { continue; }
+					ReverseLinks[Offset + l] = Offsets[Lk.Node] + r;
+					break;
+				}
+			}
+		)
+
+		uint32 Hash = FCrc::MemCrc32(Offsets.GetData(), Offsets.Num() * sizeof(int32));
+		Hash = FCrc::MemCrc32(Table->Scores.GetData(), Table->Scores.Num() * sizeof(double), Hash);
+		NewCosts->Hash = Hash ? Hash : 1;
+
+		return NewCosts;
+	}
+}
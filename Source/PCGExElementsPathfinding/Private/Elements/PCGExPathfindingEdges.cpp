@@ -13,6 +13,7 @@
 #include "Clusters/PCGExClustersHelpers.h"
 #include "Core/PCGExHeuristicsFactoryProvider.h"
 #include "Core/PCGExPathQuery.h"
+#include "Core/PCGExSearchAllocations.h"
 #include "Data/Utils/PCGExDataForward.h"
 #include "GoalPickers/PCGExGoalPickerRandom.h"
 #include "Search/PCGExSearchAStar.h"
@@ -225,7 +226,7 @@ namespace PCGExPathfindingEdges
 		{
 			if (Settings->SeedPicking.PickingMethod == EPCGExClusterClosestSearchMode::Vtx || Settings->GoalPicking.PickingMethod == EPCGExClusterClosestSearchMode::Vtx)
 			{
-				Cluster->RebuildOctree(EPCGExClusterClosestSearchMode::Vtx);
+				Cluster->RebuildSearchIndex(EPCGExClusterClosestSearchMode::Vtx);
 			}
 
 			if (Settings->SeedPicking.PickingMethod == EPCGExClusterClosestSearchMode::Edge || Settings->GoalPicking.PickingMethod == EPCGExClusterClosestSearchMode::Edge)
@@ -244,10 +245,11 @@ namespace PCGExPathfindingEdges
 		}
 
 		SearchOperation = Context->SearchAlgorithm->CreateOperation(); // Create a local copy
-		SearchOperation->PrepareForCluster(Cluster.Get());
+		SearchOperation->PrepareForCluster(Cluster.Get(), HeuristicsHandler);
 
 		bForceSingleThreadedProcessRange = HeuristicsHandler->HasGlobalFeedback() || !Settings->bGreedyQueries;
 		if (bForceSingleThreadedProcessRange) { SearchAllocations = SearchOperation->NewAllocations(); }
+		else { AllocationsPool = MakeShared<PCGExPathfinding::FSearchAllocationsPool>(SearchOperation); }
 
 		const int32 NumQueries = Context->SeedGoalPairs.Num();
 		PCGExArrayHelpers::InitArray(Queries, NumQueries);
@@ -269,6 +271,10 @@ namespace PCGExPathfindingEdges
 
 	void FProcessor::ProcessRange(const PCGExMT::FScope& Scope)
 	{
+		// Lease allocations for the whole scope instead of allocating them for each query
+		const TSharedPtr<PCGExPathfinding::FSearchAllocations> ScopeAllocations = SearchAllocations ? SearchAllocations : AllocationsPool->Acquire();
+		ON_SCOPE_EXIT { if (!SearchAllocations) { AllocationsPool->Release(ScopeAllocations); } };
+
 		PCGEX_SCOPE_LOOP(Index)
 		{
 			TSharedPtr<PCGExPathfinding::FPathQuery> Query = Queries[Index];
@@ -279,7 +285,7 @@ namespace PCGExPathfindingEdges
 
 			if (!Query->HasValidEndpoints()) { continue; }
 
-			Query->FindPath(SearchOperation, SearchAllocations, HeuristicsHandler, nullptr);
+			Query->FindPath(SearchOperation, ScopeAllocations, HeuristicsHandler, nullptr);
 
 			if (!Query->IsQuerySuccessful()) { continue; }
 
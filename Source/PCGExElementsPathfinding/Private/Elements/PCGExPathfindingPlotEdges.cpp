@@ -15,6 +15,7 @@
 #include "Core/PCGExHeuristicsFactoryProvider.h"
 #include "Core/PCGExPathQuery.h"
 #include "Core/PCGExPlotQuery.h"
+#include "Core/PCGExSearchAllocations.h"
 #include "Search/PCGExSearchAStar.h"
 #include "Helpers/PCGExDataMatcher.h"
 #include "Helpers/PCGExMatchingHelpers.h"
@@ -323,7 +324,7 @@ namespace PCGExPathfindingPlotEdges
 		{
 			if (Settings->SeedPicking.PickingMethod == EPCGExClusterClosestSearchMode::Vtx || Settings->GoalPicking.PickingMethod == EPCGExClusterClosestSearchMode::Vtx)
 			{
-				Cluster->RebuildOctree(EPCGExClusterClosestSearchMode::Vtx);
+				Cluster->RebuildSearchIndex(EPCGExClusterClosestSearchMode::Vtx);
 			}
 
 			if (Settings->SeedPicking.PickingMethod == EPCGExClusterClosestSearchMode::Edge || Settings->GoalPicking.PickingMethod == EPCGExClusterClosestSearchMode::Edge)
@@ -342,7 +343,7 @@ namespace PCGExPathfindingPlotEdges
 		}
 
 		SearchOperation = Context->SearchAlgorithm->CreateOperation(); // Create a local copy
-		SearchOperation->PrepareForCluster(Cluster.Get());
+		SearchOperation->PrepareForCluster(Cluster.Get(), HeuristicsHandler);
 		const int32 NumPlots = ValidPlots.Num();
 		PCGExArrayHelpers::InitArray(Queries, NumPlots);
 		QueriesIO.Init(nullptr, NumPlots);
@@ -358,6 +359,7 @@ namespace PCGExPathfindingPlotEdges
 
 		bForceSingleThreadedProcessRange = HeuristicsHandler->HasGlobalFeedback() || !Settings->bGreedyQueries;
 		if (bForceSingleThreadedProcessRange) { SearchAllocations = SearchOperation->NewAllocations(); }
+		else { AllocationsPool = MakeShared<PCGExPathfinding::FSearchAllocationsPool>(SearchOperation); }
 
 		// Build all queries first
 		for (int i = 0; i < NumPlots; i++)
@@ -393,7 +395,7 @@ namespace PCGExPathfindingPlotEdges
 		}
 		else
 		{
-			// Parallel execution - each query gets its own allocations
+			// Parallel execution - each sub-query scope leases allocations from the pool
 			StartParallelLoopForRange(Queries.Num(), 1);
 		}
 
@@ -412,7 +414,7 @@ namespace PCGExPathfindingPlotEdges
 				This->QueriesIO[Plot->QueryIndex]->IOIndex = This->EdgeDataFacade->Source->IOIndex * 100000 + Plot->QueryIndex;
 				Plot->Cleanup();
 			};
-			Query->FindPaths(TaskManager, SearchOperation, SearchAllocations, HeuristicsHandler);
+			Query->FindPaths(TaskManager, SearchOperation, SearchAllocations, HeuristicsHandler, AllocationsPool);
 		}
 	}
 
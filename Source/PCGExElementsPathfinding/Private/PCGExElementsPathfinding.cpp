@@ -3,15 +3,31 @@
 
 #include "PCGExElementsPathfinding.h"
 
+#include "Clusters/PCGExClusterCache.h"
+#include "Core/PCGExCachedContractionHierarchy.h"
+#include "Core/PCGExCachedLandmarks.h"
+
 #define LOCTEXT_NAMESPACE "FPCGExElementsPathfindingModule"
 
 void FPCGExElementsPathfindingModule::StartupModule()
 {
 	IPCGExLegacyModuleInterface::StartupModule();
+
+	// Register cluster cache factories
+	PCGExClusters::FClusterCacheRegistry::Get().Register(
+		MakeShared<PCGExPathfinding::FLandmarksCacheFactory>());
+	PCGExClusters::FClusterCacheRegistry::Get().Register(
+		MakeShared<PCGExPathfinding::FContractionHierarchyCacheFactory>());
 }
 
 void FPCGExElementsPathfindingModule::ShutdownModule()
 {
+	// Unregister cluster cache factories
+	PCGExClusters::FClusterCacheRegistry::Get().Unregister(
+		PCGExPathfinding::FLandmarksCacheFactory::CacheKey);
+	PCGExClusters::FClusterCacheRegistry::Get().Unregister(
+		PCGExPathfinding::FContractionHierarchyCacheFactory::CacheKey);
+
 	IPCGExLegacyModuleInterface::ShutdownModule();
 }
 
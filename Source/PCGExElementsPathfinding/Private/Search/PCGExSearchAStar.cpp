@@ -7,6 +7,7 @@
 #include "PCGExHeuristicsHandler.h"
 #include "Clusters/PCGExCluster.h"
 #include "Containers/PCGExHashLookup.h"
+#include "Core/PCGExCachedLandmarks.h"
 #include "Core/PCGExPathfinding.h"
 #include "Core/PCGExPathQuery.h"
 #include "Core/PCGExSearchAllocations.h"
@@ -20,11 +21,14 @@ bool FPCGExSearchOperationAStar::ResolveQuery(
 {
 	check(InQuery->PickResolution == PCGExPathfinding::EQueryPickResolution::Success)
 
+	if (Hierarchy) { return ResolveQueryWithHierarchy(InQuery, Allocations); }
+
 	TSharedPtr<PCGExPathfinding::FSearchAllocations> LocalAllocations = Allocations;
 	if (!LocalAllocations) { LocalAllocations = NewAllocations(); }
 	else { LocalAllocations->Reset(); }
 
 	const TArray<PCGExClusters::FNode>& NodesRef = *Cluster->Nodes;
+	const PCGExClusters::FClusterAdjacency& AdjacencyRef = *Adjacency;
 	const TArray<PCGExGraphs::FEdge>& EdgesRef = *Cluster->Edges;
 
 	const PCGExClusters::FNode& SeedNode = *InQuery->Seed.Node;
@@ -32,13 +36,16 @@ bool FPCGExSearchOperationAStar::ResolveQuery(
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(UPCGExSearchAStar::FindPath);
 
-	TBitArray<>& Visited = LocalAllocations->Visited;
-	TArray<double>& GScore = LocalAllocations->GScore;
+	PCGEx::FStampedFlags& Visited = LocalAllocations->Visited;
+	PCGEx::TStampedArray<double>& GScore = LocalAllocations->GScore;
 	const TSharedPtr<PCGEx::FHashLookup> TravelStack = LocalAllocations->TravelStack;
 	const TSharedPtr<PCGEx::FScoredQueue> ScoredQueue = LocalAllocations->ScoredQueue;
-	ScoredQueue->Enqueue(SeedNode.Index, Heuristics->GetGlobalScore(SeedNode, SeedNode, GoalNode));
+	// Landmark bounds are consistent with the edge scores they were built from, and replace the global score entirely
+	const PCGExPathfinding::FCachedLandmarks* LandmarksPtr = Landmarks.Get();
+
+	ScoredQueue->Enqueue(SeedNode.Index, LandmarksPtr ? LandmarksPtr->LowerBound(SeedNode.Index, GoalNode.Index) : Heuristics->GetGlobalScore(SeedNode, SeedNode, GoalNode));
 
-	GScore[SeedNode.Index] = 0;
+	GScore.Set(SeedNode.Index, 0);
 
 	const PCGExHeuristics::FLocalFeedbackHandler* Feedback = LocalFeedback.Get();
 
@@ -53,11 +60,14 @@ bool FPCGExSearchOperationAStar::ResolveQuery(
 		const PCGExClusters::FNode& Current = NodesRef[CurrentNodeIndex];
 
 		if (Visited[CurrentNodeIndex]) { continue; }
-		Visited[CurrentNodeIndex] = true;
+		Visited.Set(CurrentNodeIndex);
 		VisitedNum++;
 
-		for (const PCGExGraphs::FLink Lk : Current.Links)
+		const double* StaticScores = Heuristics->GetStaticEdgeScores(Current.Index);
+		const TConstArrayView<PCGExGraphs::FLink> Links = AdjacencyRef.GetLinks(Current.Index);
+		for (int32 l = 0; l < Links.Num(); l++)
 		{
+			const PCGExGraphs::FLink Lk = Links[l];
 			const uint32 NeighborIndex = Lk.Node;
 			const uint32 EdgeIndex = Lk.Edge;
 
@@ -66,17 +76,17 @@ bool FPCGExSearchOperationAStar::ResolveQuery(
 			const PCGExClusters::FNode& AdjacentNode = NodesRef[NeighborIndex];
 			const PCGExGraphs::FEdge& Edge = EdgesRef[EdgeIndex];
 
-			const double EScore = Heuristics->GetEdgeScore(Current, AdjacentNode, Edge, SeedNode, GoalNode, Feedback, TravelStack);
+			const double EScore = StaticScores ? StaticScores[l] : Heuristics->GetEdgeScore(Current, AdjacentNode, Edge, SeedNode, GoalNode, Feedback, TravelStack);
 			const double TentativeGScore = CurrentGScore + EScore;
 
 			const double PreviousGScore = GScore[NeighborIndex];
 			if (PreviousGScore != -1 && TentativeGScore >= PreviousGScore) { continue; }
 
 			TravelStack->Set(NeighborIndex, PCGEx::NH64(CurrentNodeIndex, EdgeIndex));
-			GScore[NeighborIndex] = TentativeGScore;
+			GScore.Set(NeighborIndex, TentativeGScore);
 
-			const double GS = Heuristics->GetGlobalScore(AdjacentNode, SeedNode, GoalNode, Feedback);
-			const double FScore = TentativeGScore + GS * Heuristics->ReferenceWeight;
+			const double HScore = LandmarksPtr ? LandmarksPtr->LowerBound(NeighborIndex, GoalNode.Index) : Heuristics->GetGlobalScore(AdjacentNode, SeedNode, GoalNode, Feedback) * Heuristics->ReferenceWeight;
+			const double FScore = TentativeGScore + HScore;
 
 			ScoredQueue->Enqueue(NeighborIndex, FScore);
 		}
@@ -112,3 +122,13 @@ TSharedPtr<PCGExPathfinding::FSearchAllocations> FPCGExSearchOperationAStar::New
 	Allocations->GScore.Init(-1, Cluster->Nodes->Num());
 	return Allocations;
 }
+
+void UPCGExSearchAStar::CopySettingsFrom(const UPCGExInstancedFactory* Other)
+{
+	Super::CopySettingsFrom(Other);
+	if (const UPCGExSearchAStar* TypedOther = Cast<UPCGExSearchAStar>(Other))
+	{
+		Acceleration = TypedOther->Acceleration;
+		NumLandmarks = TypedOther->NumLandmarks;
+	}
+}
@@ -23,6 +23,7 @@ bool FPCGExSearchOperationBellmanFord::ResolveQuery(
 	else { LocalAllocations->Reset(); }
 
 	const TArray<PCGExClusters::FNode>& NodesRef = *Cluster->Nodes;
+	const PCGExClusters::FClusterAdjacency& AdjacencyRef = *Adjacency;
 	const TArray<PCGExGraphs::FEdge>& EdgesRef = *Cluster->Edges;
 
 	const PCGExClusters::FNode& SeedNode = *InQuery->Seed.Node;
@@ -32,13 +33,13 @@ bool FPCGExSearchOperationBellmanFord::ResolveQuery(
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExSearchOperationBellmanFord::FindPath);
 
-	TArray<double>& Distance = LocalAllocations->GScore;
+	PCGEx::TStampedArray<double>& Distance = LocalAllocations->GScore;
 	const TSharedPtr<PCGEx::FHashLookup> TravelStack = LocalAllocations->TravelStack;
 
 	const PCGExHeuristics::FLocalFeedbackHandler* Feedback = LocalFeedback.Get();
 
 	// Initialize distances
-	Distance[SeedNode.Index] = 0;
+	Distance.Set(SeedNode.Index, 0);
 
 	// Relax all edges |V| - 1 times
 	for (int32 Iteration = 0; Iteration < NumNodes - 1; Iteration++)
@@ -53,20 +54,23 @@ bool FPCGExSearchOperationBellmanFord::ResolveQuery(
 
 			const PCGExClusters::FNode& CurrentNode = NodesRef[NodeIndex];
 
-			for (const PCGExGraphs::FLink Lk : CurrentNode.Links)
+			const double* StaticScores = Heuristics->GetStaticEdgeScores(CurrentNode.Index);
+			const TConstArrayView<PCGExGraphs::FLink> Links = AdjacencyRef.GetLinks(CurrentNode.Index);
+			for (int32 l = 0; l < Links.Num(); l++)
 			{
+				const PCGExGraphs::FLink Lk = Links[l];
 				const uint32 NeighborIndex = Lk.Node;
 				const uint32 EdgeIndex = Lk.Edge;
 
 				const PCGExClusters::FNode& AdjacentNode = NodesRef[NeighborIndex];
 				const PCGExGraphs::FEdge& Edge = EdgesRef[EdgeIndex];
 
-				const double EdgeWeight = Heuristics->GetEdgeScore(CurrentNode, AdjacentNode, Edge, SeedNode, GoalNode, Feedback, TravelStack);
+				const double EdgeWeight = StaticScores ? StaticScores[l] : Heuristics->GetEdgeScore(CurrentNode, AdjacentNode, Edge, SeedNode, GoalNode, Feedback, TravelStack);
 				const double NewDist = CurrentDist + EdgeWeight;
 
 				if (NewDist < Distance[NeighborIndex])
 				{
-					Distance[NeighborIndex] = NewDist;
+					Distance.Set(NeighborIndex, NewDist);
 					TravelStack->Set(NeighborIndex, PCGEx::NH64(NodeIndex, EdgeIndex));
 					bAnyRelaxation = true;
 				}
@@ -90,15 +94,18 @@ bool FPCGExSearchOperationBellmanFord::ResolveQuery(
 
 			const PCGExClusters::FNode& CurrentNode = NodesRef[NodeIndex];
 
-			for (const PCGExGraphs::FLink Lk : CurrentNode.Links)
+			const double* StaticScores = Heuristics->GetStaticEdgeScores(CurrentNode.Index);
+			const TConstArrayView<PCGExGraphs::FLink> Links = AdjacencyRef.GetLinks(CurrentNode.Index);
+			for (int32 l = 0; l < Links.Num(); l++)
 			{
+				const PCGExGraphs::FLink Lk = Links[l];
 				const uint32 NeighborIndex = Lk.Node;
 				const uint32 EdgeIndex = Lk.Edge;
 
 				const PCGExClusters::FNode& AdjacentNode = NodesRef[NeighborIndex];
 				const PCGExGraphs::FEdge& Edge = EdgesRef[EdgeIndex];
 
-				const double EdgeWeight = Heuristics->GetEdgeScore(CurrentNode, AdjacentNode, Edge, SeedNode, GoalNode, Feedback, TravelStack);
+				const double EdgeWeight = StaticScores ? StaticScores[l] : Heuristics->GetEdgeScore(CurrentNode, AdjacentNode, Edge, SeedNode, GoalNode, Feedback, TravelStack);
 
 				// If we can still relax, there's a negative cycle
 				if (CurrentDist + EdgeWeight < Distance[NeighborIndex])
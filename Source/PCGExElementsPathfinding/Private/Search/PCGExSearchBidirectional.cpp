@@ -11,37 +11,6 @@
 #include "Core/PCGExSearchAllocations.h"
 #include "Utils/PCGExScoredQueue.h"
 
-namespace PCGExPathfinding
-{
-	void FBidirectionalSearchAllocations::Init(const PCGExClusters::FCluster* InCluster)
-	{
-		FSearchAllocations::Init(InCluster);
-
-		GScore.Init(-1, NumNodes);
-		VisitedBackward.Init(false, NumNodes);
-		GScoreBackward.Init(-1, NumNodes);
-		TravelStackBackward = PCGEx::NewHashLookup<PCGEx::FHashLookupArray>(PCGEx::NH64(-1, -1), NumNodes);
-		ScoredQueueBackward = MakeShared<PCGEx::FScoredQueue>(NumNodes);
-	}
-
-	void FBidirectionalSearchAllocations::Reset()
-	{
-		FSearchAllocations::Reset();
-
-		for (int i = 0; i < NumNodes; i++) { GScore[i] = -1; }
-
-		const int32 NumVisitedNodes = Visited.Num();
-		for (int i = 0; i < NumVisitedNodes; i++)
-		{
-			VisitedBackward[i] = false;
-			GScoreBackward[i] = -1;
-		}
-
-		TravelStackBackward->Reset();
-		ScoredQueueBackward->Reset();
-	}
-}
-
 bool FPCGExSearchOperationBidirectional::ResolveQuery(
 	const TSharedPtr<PCGExPathfinding::FPathQuery>& InQuery,
 	const TSharedPtr<PCGExPathfinding::FSearchAllocations>& Allocations,
@@ -50,6 +19,8 @@ bool FPCGExSearchOperationBidirectional::ResolveQuery(
 {
 	check(InQuery->PickResolution == PCGExPathfinding::EQueryPickResolution::Success)
 
+	if (Hierarchy) { return ResolveQueryWithHierarchy(InQuery, Allocations); }
+
 	TSharedPtr<PCGExPathfinding::FBidirectionalSearchAllocations> LocalAllocations;
 	if (Allocations)
 	{
@@ -62,6 +33,7 @@ bool FPCGExSearchOperationBidirectional::ResolveQuery(
 	}
 
 	const TArray<PCGExClusters::FNode>& NodesRef = *Cluster->Nodes;
+	const PCGExClusters::FClusterAdjacency& AdjacencyRef = *Adjacency;
 	const TArray<PCGExGraphs::FEdge>& EdgesRef = *Cluster->Edges;
 
 	const PCGExClusters::FNode& SeedNode = *InQuery->Seed.Node;
@@ -70,24 +42,24 @@ bool FPCGExSearchOperationBidirectional::ResolveQuery(
 	TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExSearchOperationBidirectional::FindPath);
 
 	// Forward search structures
-	TBitArray<>& VisitedForward = LocalAllocations->Visited;
-	TArray<double>& GScoreForward = LocalAllocations->GScore;
+	PCGEx::FStampedFlags& VisitedForward = LocalAllocations->Visited;
+	PCGEx::TStampedArray<double>& GScoreForward = LocalAllocations->GScore;
 	const TSharedPtr<PCGEx::FHashLookup> TravelStackForward = LocalAllocations->TravelStack;
 	const TSharedPtr<PCGEx::FScoredQueue> QueueForward = LocalAllocations->ScoredQueue;
 
 	// Backward search structures
-	TBitArray<>& VisitedBackward = LocalAllocations->VisitedBackward;
-	TArray<double>& GScoreBackward = LocalAllocations->GScoreBackward;
+	PCGEx::FStampedFlags& VisitedBackward = LocalAllocations->VisitedBackward;
+	PCGEx::TStampedArray<double>& GScoreBackward = LocalAllocations->GScoreBackward;
 	const TSharedPtr<PCGEx::FHashLookup> TravelStackBackward = LocalAllocations->TravelStackBackward;
 	const TSharedPtr<PCGEx::FScoredQueue> QueueBackward = LocalAllocations->ScoredQueueBackward;
 
 	// Initialize forward search from seed
 	QueueForward->Enqueue(SeedNode.Index, 0);
-	GScoreForward[SeedNode.Index] = 0;
+	GScoreForward.Set(SeedNode.Index, 0);
 
 	// Initialize backward search from goal
 	QueueBackward->Enqueue(GoalNode.Index, 0);
-	GScoreBackward[GoalNode.Index] = 0;
+	GScoreBackward.Set(GoalNode.Index, 0);
 
 	const PCGExHeuristics::FLocalFeedbackHandler* Feedback = LocalFeedback.Get();
 
@@ -120,12 +92,15 @@ bool FPCGExSearchOperationBidirectional::ResolveQuery(
 
 			if (!VisitedForward[CurrentNodeIndex])
 			{
-				VisitedForward[CurrentNodeIndex] = true;
+				VisitedForward.Set(CurrentNodeIndex);
 				const PCGExClusters::FNode& Current = NodesRef[CurrentNodeIndex];
 				const double CurrentGScore = GScoreForward[CurrentNodeIndex];
 
-				for (const PCGExGraphs::FLink Lk : Current.Links)
+				const double* StaticScores = Heuristics->GetStaticEdgeScores(Current.Index);
+				const TConstArrayView<PCGExGraphs::FLink> Links = AdjacencyRef.GetLinks(Current.Index);
+				for (int32 l = 0; l < Links.Num(); l++)
 				{
+					const PCGExGraphs::FLink Lk = Links[l];
 					const uint32 NeighborIndex = Lk.Node;
 					const uint32 EdgeIndex = Lk.Edge;
 
@@ -134,14 +109,14 @@ bool FPCGExSearchOperationBidirectional::ResolveQuery(
 					const PCGExClusters::FNode& AdjacentNode = NodesRef[NeighborIndex];
 					const PCGExGraphs::FEdge& Edge = EdgesRef[EdgeIndex];
 
-					const double EScore = Heuristics->GetEdgeScore(Current, AdjacentNode, Edge, SeedNode, GoalNode, Feedback, TravelStackForward);
+					const double EScore = StaticScores ? StaticScores[l] : Heuristics->GetEdgeScore(Current, AdjacentNode, Edge, SeedNode, GoalNode, Feedback, TravelStackForward);
 					const double TentativeGScore = CurrentGScore + EScore;
 
 					const double PreviousGScore = GScoreForward[NeighborIndex];
 					if (PreviousGScore != -1 && TentativeGScore >= PreviousGScore) { continue; }
 
 					TravelStackForward->Set(NeighborIndex, PCGEx::NH64(CurrentNodeIndex, EdgeIndex));
-					GScoreForward[NeighborIndex] = TentativeGScore;
+					GScoreForward.Set(NeighborIndex, TentativeGScore);
 
 					QueueForward->Enqueue(NeighborIndex, TentativeGScore);
 				}
@@ -170,12 +145,15 @@ bool FPCGExSearchOperationBidirectional::ResolveQuery(
 
 			if (!VisitedBackward[CurrentNodeIndex])
 			{
-				VisitedBackward[CurrentNodeIndex] = true;
+				VisitedBackward.Set(CurrentNodeIndex);
 				const PCGExClusters::FNode& Current = NodesRef[CurrentNodeIndex];
 				const double CurrentGScore = GScoreBackward[CurrentNodeIndex];
 
-				for (const PCGExGraphs::FLink Lk : Current.Links)
+				const double* StaticScores = Heuristics->GetStaticEdgeScores(Current.Index);
+				const TConstArrayView<PCGExGraphs::FLink> Links = AdjacencyRef.GetLinks(Current.Index);
+				for (int32 l = 0; l < Links.Num(); l++)
 				{
+					const PCGExGraphs::FLink Lk = Links[l];
 					const uint32 NeighborIndex = Lk.Node;
 					const uint32 EdgeIndex = Lk.Edge;
 
@@ -185,14 +163,14 @@ bool FPCGExSearchOperationBidirectional::ResolveQuery(
 					const PCGExGraphs::FEdge& Edge = EdgesRef[EdgeIndex];
 
 					// Note: For backward search, we reverse the direction conceptually
-					const double EScore = Heuristics->GetEdgeScore(Current, AdjacentNode, Edge, GoalNode, SeedNode, Feedback, TravelStackBackward);
+					const double EScore = StaticScores ? StaticScores[l] : Heuristics->GetEdgeScore(Current, AdjacentNode, Edge, GoalNode, SeedNode, Feedback, TravelStackBackward);
 					const double TentativeGScore = CurrentGScore + EScore;
 
 					const double PreviousGScore = GScoreBackward[NeighborIndex];
 					if (PreviousGScore != -1 && TentativeGScore >= PreviousGScore) { continue; }
 
 					TravelStackBackward->Set(NeighborIndex, PCGEx::NH64(CurrentNodeIndex, EdgeIndex));
-					GScoreBackward[NeighborIndex] = TentativeGScore;
+					GScoreBackward.Set(NeighborIndex, TentativeGScore);
 
 					QueueBackward->Enqueue(NeighborIndex, TentativeGScore);
 				}
@@ -271,6 +249,15 @@ void FPCGExSearchOperationBidirectional::ReconstructPath(
 TSharedPtr<PCGExPathfinding::FSearchAllocations> FPCGExSearchOperationBidirectional::NewAllocations() const
 {
 	TSharedPtr<PCGExPathfinding::FBidirectionalSearchAllocations> Allocations = MakeShared<PCGExPathfinding::FBidirectionalSearchAllocations>();
-	Allocations->Init(Cluster);
+	Allocations->Init(Cluster, GetQueueBackend(), QueueBucketWidth);
 	return Allocations;
 }
+
+void UPCGExSearchBidirectional::CopySettingsFrom(const UPCGExInstancedFactory* Other)
+{
+	Super::CopySettingsFrom(Other);
+	if (const UPCGExSearchBidirectional* TypedOther = Cast<UPCGExSearchBidirectional>(Other))
+	{
+		Acceleration = TypedOther->Acceleration;
+	}
+}
@@ -24,24 +24,19 @@ bool FPCGExSearchOperationDijkstra::ResolveQuery(
 	else { LocalAllocations->Reset(); }
 
 	const TArray<PCGExClusters::FNode>& NodesRef = *Cluster->Nodes;
+	const PCGExClusters::FClusterAdjacency& AdjacencyRef = *Adjacency;
 	const TArray<PCGExGraphs::FEdge>& EdgesRef = *Cluster->Edges;
 
 	const PCGExClusters::FNode& SeedNode = *InQuery->Seed.Node;
 	const PCGExClusters::FNode& GoalNode = *InQuery->Goal.Node;
 
-	const int32 NumNodes = NodesRef.Num();
-
 	TRACE_CPUPROFILER_EVENT_SCOPE(UPCGExSearchDijkstra::FindPath);
 
 	// Basic Dijkstra implementation
 
-	TBitArray<> Visited;
-	Visited.Init(false, NumNodes);
-
-	// TODO : Use local allocations for the hash lookup
-	const TSharedPtr<PCGEx::FHashLookup> TravelStack = PCGEx::NewHashLookup<PCGEx::FHashLookupArray>(PCGEx::NH64(-1, -1), NumNodes);
-
-	const TUniquePtr<PCGEx::FScoredQueue> ScoredQueue = MakeUnique<PCGEx::FScoredQueue>(NumNodes);
+	PCGEx::FStampedFlags& Visited = LocalAllocations->Visited;
+	const TSharedPtr<PCGEx::FHashLookup> TravelStack = LocalAllocations->TravelStack;
+	const TSharedPtr<PCGEx::FScoredQueue> ScoredQueue = LocalAllocations->ScoredQueue;
 	ScoredQueue->Enqueue(SeedNode.Index, 0);
 
 	const PCGExHeuristics::FLocalFeedbackHandler* Feedback = LocalFeedback.Get();
@@ -56,11 +51,14 @@ bool FPCGExSearchOperationDijkstra::ResolveQuery(
 		const PCGExClusters::FNode& Current = NodesRef[CurrentNodeIndex];
 
 		if (Visited[CurrentNodeIndex]) { continue; }
-		Visited[CurrentNodeIndex] = true;
+		Visited.Set(CurrentNodeIndex);
 		VisitedNum++;
 
-		for (const PCGExGraphs::FLink Lk : Current.Links)
+		const double* StaticScores = Heuristics->GetStaticEdgeScores(Current.Index);
+		const TConstArrayView<PCGExGraphs::FLink> Links = AdjacencyRef.GetLinks(Current.Index);
+		for (int32 l = 0; l < Links.Num(); l++)
 		{
+			const PCGExGraphs::FLink Lk = Links[l];
 			const uint32 NeighborIndex = Lk.Node;
 			const uint32 EdgeIndex = Lk.Edge;
 
@@ -69,7 +67,7 @@ bool FPCGExSearchOperationDijkstra::ResolveQuery(
 			const PCGExClusters::FNode& AdjacentNode = NodesRef[NeighborIndex];
 			const PCGExGraphs::FEdge& Edge = EdgesRef[EdgeIndex];
 
-			const double AltScore = CurrentScore + Heuristics->GetEdgeScore(Current, AdjacentNode, Edge, SeedNode, GoalNode, Feedback, TravelStack);
+			const double AltScore = CurrentScore + (StaticScores ? StaticScores[l] : Heuristics->GetEdgeScore(Current, AdjacentNode, Edge, SeedNode, GoalNode, Feedback, TravelStack));
 			if (ScoredQueue->Enqueue(NeighborIndex, AltScore))
 			{
 				TravelStack->Set(NeighborIndex, PCGEx::NH64(CurrentNodeIndex, EdgeIndex));
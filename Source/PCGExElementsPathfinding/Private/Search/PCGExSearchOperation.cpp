@@ -3,11 +3,43 @@
 
 
 #include "Search/PCGExSearchOperation.h"
+#include "Clusters/PCGExCluster.h"
+#include "Core/PCGExCachedContractionHierarchy.h"
+#include "Core/PCGExCachedLandmarks.h"
+#include "Core/PCGExPathfinding.h"
+#include "Core/PCGExPathQuery.h"
 #include "Core/PCGExSearchAllocations.h"
+#include "Core/PCGExStaticEdgeCosts.h"
+#include "Utils/PCGExScoredQueue.h"
 
-void FPCGExSearchOperation::PrepareForCluster(PCGExClusters::FCluster* InCluster)
+namespace PCGExPathfinding
+{
+	// Below this many nodes everything fits in cache and the plain binary heap has the least overhead
+	constexpr int32 SmallClusterQueueThreshold = 1024;
+}
+
+void FPCGExSearchOperation::PrepareForCluster(PCGExClusters::FCluster* InCluster, const TSharedPtr<PCGExHeuristics::FHandler>& InHeuristics)
 {
 	Cluster = InCluster;
+	Adjacency = InCluster ? InCluster->GetAdjacency() : nullptr;
+	Landmarks.Reset();
+	Hierarchy.Reset();
+
+	if (!InCluster || !InHeuristics || !SupportsAcceleration(Acceleration)) { return; }
+
+	const TSharedPtr<PCGExPathfinding::FStaticEdgeCosts> Costs = PCGExPathfinding::FStaticEdgeCosts::Make(InCluster, *InHeuristics.Get());
+	if (!Costs) { return; }
+
+	switch (Acceleration)
+	{
+	case EPCGExSearchAcceleration::Landmarks:
+		Landmarks = PCGExPathfinding::LandmarkHelpers::GetOrBuildLandmarks(InCluster, *Costs.Get(), NumLandmarks);
+		break;
+	case EPCGExSearchAcceleration::ContractionHierarchy:
+		Hierarchy = PCGExPathfinding::ContractionHierarchyHelpers::GetOrBuildContractionHierarchy(InCluster, *Costs.Get());
+		break;
+	default: break;
+	}
 }
 
 bool FPCGExSearchOperation::ResolveQuery(
@@ -21,13 +53,77 @@ bool FPCGExSearchOperation::ResolveQuery(
 
 TSharedPtr<PCGExPathfinding::FSearchAllocations> FPCGExSearchOperation::NewAllocations() const
 {
+	if (Hierarchy)
+	{
+		// Hierarchy queries search both ways
+		TSharedPtr<PCGExPathfinding::FBidirectionalSearchAllocations> Allocations = MakeShared<PCGExPathfinding::FBidirectionalSearchAllocations>();
+		Allocations->Init(Cluster, GetQueueBackend(), QueueBucketWidth);
+		return Allocations;
+	}
+
 	TSharedPtr<PCGExPathfinding::FSearchAllocations> Allocations = MakeShared<PCGExPathfinding::FSearchAllocations>();
-	Allocations->Init(Cluster);
+	Allocations->Init(Cluster, GetQueueBackend(), QueueBucketWidth);
 	return Allocations;
 }
 
+bool FPCGExSearchOperation::ResolveQueryWithHierarchy(
+	const TSharedPtr<PCGExPathfinding::FPathQuery>& InQuery,
+	const TSharedPtr<PCGExPathfinding::FSearchAllocations>& Allocations) const
+{
+	check(Hierarchy)
+
+	TSharedPtr<PCGExPathfinding::FBidirectionalSearchAllocations> LocalAllocations;
+	if (Allocations)
+	{
+		LocalAllocations = StaticCastSharedPtr<PCGExPathfinding::FBidirectionalSearchAllocations>(Allocations);
+		LocalAllocations->Reset();
+	}
+	else
+	{
+		LocalAllocations = StaticCastSharedPtr<PCGExPathfinding::FBidirectionalSearchAllocations>(NewAllocations());
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExSearchOperation::ResolveQueryWithHierarchy);
+
+	TArray<int32> PathNodes;
+	TArray<int32> PathEdges;
+	if (!Hierarchy->FindPath(InQuery->Seed.Node->Index, InQuery->Goal.Node->Index, *LocalAllocations.Get(), PathNodes, PathEdges)) { return false; }
+
+	// Queries expect goal-to-seed order
+	for (int32 i = PathEdges.Num() - 1; i >= 0; i--) { InQuery->AddPathNode(PathNodes[i + 1], PathEdges[i]); }
+	InQuery->AddPathNode(PathNodes[0]);
+
+	return true;
+}
+
+PCGEx::EScoredQueueBackend FPCGExSearchOperation::GetQueueBackend() const
+{
+	switch (QueueType)
+	{
+	case EPCGExSearchQueueType::Auto:
+		if (!Cluster || Cluster->Nodes->Num() < PCGExPathfinding::SmallClusterQueueThreshold) { return PCGEx::EScoredQueueBackend::BinaryHeap; }
+		return HasMonotoneScores() ? PCGEx::EScoredQueueBackend::RadixHeap : PCGEx::EScoredQueueBackend::QuaternaryHeap;
+	default:
+	case EPCGExSearchQueueType::BinaryHeap: return PCGEx::EScoredQueueBackend::BinaryHeap;
+	case EPCGExSearchQueueType::QuaternaryHeap: return PCGEx::EScoredQueueBackend::QuaternaryHeap;
+	case EPCGExSearchQueueType::RadixHeap: return PCGEx::EScoredQueueBackend::RadixHeap;
+	case EPCGExSearchQueueType::BucketQueue: return PCGEx::EScoredQueueBackend::BucketQueue;
+	}
+}
+
 
 void UPCGExSearchInstancedFactory::CopySettingsFrom(const UPCGExInstancedFactory* Other)
 {
 	Super::CopySettingsFrom(Other);
+	if (const UPCGExSearchInstancedFactory* TypedOther = Cast<UPCGExSearchInstancedFactory>(Other))
+	{
+		QueueType = TypedOther->QueueType;
+		QueueBucketWidth = TypedOther->QueueBucketWidth;
+	}
+}
+
+void UPCGExSearchInstancedFactory::ForwardSettings(FPCGExSearchOperation* InOperation) const
+{
+	InOperation->QueueType = QueueType;
+	InOperation->QueueBucketWidth = QueueBucketWidth;
 }
@@ -0,0 +1,111 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Clusters/PCGExClusterCache.h"
+
+namespace PCGExClusters
+{
+	class FCluster;
+}
+
+namespace PCGExPathfinding
+{
+	class FStaticEdgeCosts;
+	class FBidirectionalSearchAllocations;
+
+	/**
+	 * Cached contraction hierarchy.
+	 * Nodes are ranked by contraction order; shortcuts preserve shortest distances between the remaining nodes as
+	 * lower-ranked ones are removed. A query is a bidirectional search that only ever climbs ranks, which settles
+	 * a tiny fraction of the nodes a plain search would, and returns exact shortest paths over the static costs.
+	 */
+	class PCGEXELEMENTSPATHFINDING_API FCachedContractionHierarchy : public PCGExClusters::ICachedClusterData
+	{
+	public:
+		struct FArc
+		{
+			int32 From = -1;
+			int32 To = -1;
+			double Cost = 0;
+			int32 Edge = -1;   // Cluster edge, -1 for shortcuts
+			int32 ChildA = -1; // Shortcuts only : From -> Via arc
+			int32 ChildB = -1; // Shortcuts only : Via -> To arc
+
+			FArc() = default;
+
+			FArc(const int32 InFrom, const int32 InTo, const double InCost, const int32 InEdge, const int32 InChildA = -1, const int32 InChildB = -1)
+				: From(InFrom), To(InTo), Cost(InCost), Edge(InEdge), ChildA(InChildA), ChildB(InChildB)
+			{
+			}
+
+			FORCEINLINE bool IsShortcut() const { return Edge == -1; }
+		};
+
+		TArray<int32> Rank;
+		TArray<FArc> Arcs;
+
+		// Arcs leaving a node toward higher ranks
+		TArray<int32> UpOffsets;
+		TArray<int32> UpArcs;
+
+		// Arcs entering a node from higher ranks
+		TArray<int32> DownOffsets;
+		TArray<int32> DownArcs;
+
+		int32 NumShortcuts = 0;
+
+		/**
+		 * Find the shortest path between two nodes.
+		 * @param Seed Seed node index
+		 * @param Goal Goal node index
+		 * @param Allocations Reset, ready to use bidirectional allocations
+		 * @param OutNodes Path nodes, from seed to goal
+		 * @param OutEdges Path edges; OutEdges[i] connects OutNodes[i] to OutNodes[i + 1]
+		 * @return Whether the goal could be reached
+		 */
+		bool FindPath(const int32 Seed, const int32 Goal, FBidirectionalSearchAllocations& Allocations, TArray<int32>& OutNodes, TArray<int32>& OutEdges) const;
+
+	protected:
+		/** Expand an arc into the cluster edges it stands for, appending nodes & edges */
+		void UnpackArc(const int32 ArcIndex, TArray<int32>& OutNodes, TArray<int32>& OutEdges) const;
+	};
+
+	/**
+	 * Factory for contraction hierarchies.
+	 * Opportunistic : the hierarchy depends on the heuristics used by the search, and is built by search operations on first use.
+	 */
+	class PCGEXELEMENTSPATHFINDING_API FContractionHierarchyCacheFactory : public PCGExClusters::IClusterCacheFactory
+	{
+	public:
+		static inline const FName CacheKey = FName("PathfindingContractionHierarchy");
+
+		virtual FName GetCacheKey() const override { return CacheKey; }
+		virtual FText GetDisplayName() const override;
+		virtual FText GetTooltip() const override;
+		virtual EClusterCacheType GetCacheType() const override { return EClusterCacheType::Opportunistic; }
+
+		virtual TSharedPtr<PCGExClusters::ICachedClusterData> Build(const PCGExClusters::FClusterCacheBuildContext& Context) const override { return nullptr; }
+	};
+
+	namespace ContractionHierarchyHelpers
+	{
+		/**
+		 * Get or build a contraction hierarchy for a cluster & a set of static costs.
+		 * A cached hierarchy is only reused if it was built from the same costs.
+		 *
+		 * @param Cluster - The cluster to get/build the hierarchy for
+		 * @param Costs - Static edge costs
+		 * @return Contraction hierarchy, or nullptr if none could be built
+		 */
+		PCGEXELEMENTSPATHFINDING_API TSharedPtr<FCachedContractionHierarchy> GetOrBuildContractionHierarchy(PCGExClusters::FCluster* Cluster, const FStaticEdgeCosts& Costs);
+
+		/**
+		 * Contract nodes by increasing edge difference, with lazy priority updates and bounded witness searches.
+		 * Bounded witness searches may add superfluous shortcuts, never miss required ones.
+		 */
+		PCGEXELEMENTSPATHFINDING_API TSharedPtr<FCachedContractionHierarchy> BuildContractionHierarchy(const PCGExClusters::FCluster* Cluster, const FStaticEdgeCosts& Costs);
+	}
+}
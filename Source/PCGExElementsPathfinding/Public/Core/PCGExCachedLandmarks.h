@@ -0,0 +1,98 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Clusters/PCGExClusterCache.h"
+
+namespace PCGExClusters
+{
+	class FCluster;
+}
+
+namespace PCGExPathfinding
+{
+	class FStaticEdgeCosts;
+
+	/**
+	 * Cached landmark distance tables (ALT).
+	 * Stores, for a handful of landmark nodes, the shortest distance from and to every node of the cluster.
+	 * The triangle inequality turns these into admissible & consistent lower bounds of the distance between any two nodes.
+	 */
+	class PCGEXELEMENTSPATHFINDING_API FCachedLandmarks : public PCGExClusters::ICachedClusterData
+	{
+	public:
+		int32 NumLandmarks = 0;
+		TArray<int32> Landmarks;
+
+		// Node-major tables, NumLandmarks entries per node. MAX_dbl when unreachable.
+		TArray<double> FromLandmark; // d(Landmark, Node)
+		TArray<double> ToLandmark;   // d(Node, Landmark)
+
+		/** Lower bound of the shortest distance from one node to another */
+		FORCEINLINE double LowerBound(const int32 From, const int32 To) const
+		{
+			const double* RESTRICT FromL = FromLandmark.GetData();
+			const double* RESTRICT ToL = ToLandmark.GetData();
+			const int32 A = From * NumLandmarks;
+			const int32 B = To * NumLandmarks;
+
+			double Bound = 0;
+			for (int32 i = 0; i < NumLandmarks; i++)
+			{
+				// d(L, To) <= d(L, From) + d(From, To)
+				const double LFrom = FromL[A + i];
+				const double LTo = FromL[B + i];
+				if (LFrom != MAX_dbl && LTo != MAX_dbl) { Bound = FMath::Max(Bound, LTo - LFrom); }
+
+				// d(From, L) <= d(From, To) + d(To, L)
+				const double FromLm = ToL[A + i];
+				const double ToLm = ToL[B + i];
+				if (FromLm != MAX_dbl && ToLm != MAX_dbl) { Bound = FMath::Max(Bound, FromLm - ToLm); }
+			}
+
+			return Bound;
+		}
+	};
+
+	/**
+	 * Factory for landmark distance tables.
+	 * Opportunistic : tables depend on the heuristics used by the search, and are built by search operations on first use.
+	 */
+	class PCGEXELEMENTSPATHFINDING_API FLandmarksCacheFactory : public PCGExClusters::IClusterCacheFactory
+	{
+	public:
+		static inline const FName CacheKey = FName("PathfindingLandmarks");
+
+		virtual FName GetCacheKey() const override { return CacheKey; }
+		virtual FText GetDisplayName() const override;
+		virtual FText GetTooltip() const override;
+		virtual EClusterCacheType GetCacheType() const override { return EClusterCacheType::Opportunistic; }
+
+		virtual TSharedPtr<PCGExClusters::ICachedClusterData> Build(const PCGExClusters::FClusterCacheBuildContext& Context) const override { return nullptr; }
+	};
+
+	namespace LandmarkHelpers
+	{
+		/**
+		 * Get or build landmark tables for a cluster & a set of static costs.
+		 * Cached tables are only reused if they were built from the same costs with the same number of landmarks.
+		 *
+		 * @param Cluster - The cluster to get/build landmarks for
+		 * @param Costs - Static edge costs the distances are measured with
+		 * @param NumLandmarks - Desired number of landmarks, fewer may be picked on tiny or disconnected clusters
+		 * @return Landmark tables, or nullptr if none could be built
+		 */
+		PCGEXELEMENTSPATHFINDING_API TSharedPtr<FCachedLandmarks> GetOrBuildLandmarks(PCGExClusters::FCluster* Cluster, const FStaticEdgeCosts& Costs, const int32 NumLandmarks);
+
+		/**
+		 * Pick landmarks using farthest-point selection and compute their distance tables.
+		 * Forward searches are sequential since each one drives the next pick, backward searches run in parallel.
+		 */
+		PCGEXELEMENTSPATHFINDING_API TSharedPtr<FCachedLandmarks> BuildLandmarks(const PCGExClusters::FCluster* Cluster, const FStaticEdgeCosts& Costs, const int32 NumLandmarks);
+
+		/** Single-source shortest distances over static costs. Reverse measures distances *to* the source instead. */
+		PCGEXELEMENTSPATHFINDING_API void ComputeDistances(const PCGExClusters::FCluster* Cluster, const FStaticEdgeCosts& Costs, const int32 Source, const bool bReverse, TArray<double>& OutDistances);
+	}
+}
@@ -4,6 +4,9 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/PCGExStampedArray.h"
+
+class FPCGExSearchOperation;
 
 namespace PCGExClusters
 {
@@ -12,6 +15,7 @@ namespace PCGExClusters
 
 namespace PCGEx
 {
+	enum class EScoredQueueBackend : uint8;
 	class FScoredQueue;
 	class FHashLookup;
 }
@@ -22,16 +26,64 @@ namespace PCGExPathfinding
 	{
 	protected:
 		int32 NumNodes = 0;
+		PCGEx::EScoredQueueBackend QueueBackend = {};
+		double QueueBucketWidth = 1;
 
 	public:
 		FSearchAllocations() = default;
 
-		TBitArray<> Visited;
-		TArray<double> GScore;
+		// Per-node state is epoch-stamped so Reset doesn't scale with the cluster size
+		PCGEx::FStampedFlags Visited;
+		PCGEx::TStampedArray<double> GScore;
 		TSharedPtr<PCGEx::FHashLookup> TravelStack;
 		TSharedPtr<PCGEx::FScoredQueue> ScoredQueue;
 
-		void Init(const PCGExClusters::FCluster* InCluster);
+		void Init(const PCGExClusters::FCluster* InCluster, const PCGEx::EScoredQueueBackend InQueueBackend, const double InQueueBucketWidth = 1);
 		void Reset();
+
+		FORCEINLINE int32 GetNumNodes() const { return NumNodes; }
+	};
+
+	/**
+	 * Extended allocations for bidirectional search.
+	 * Maintains separate data structures for forward and backward searches.
+	 */
+	class PCGEXELEMENTSPATHFINDING_API FBidirectionalSearchAllocations : public FSearchAllocations
+	{
+	public:
+		// Backward search structures
+		PCGEx::FStampedFlags VisitedBackward;
+		PCGEx::TStampedArray<double> GScoreBackward;
+		TSharedPtr<PCGEx::FHashLookup> TravelStackBackward;
+		TSharedPtr<PCGEx::FScoredQueue> ScoredQueueBackward;
+
+		void Init(const PCGExClusters::FCluster* InCluster, const PCGEx::EScoredQueueBackend InQueueBackend, const double InQueueBucketWidth = 1);
+		void Reset();
+	};
+
+	/**
+	 * Pool of search allocations for a single cluster & search operation.
+	 * Parallel scopes lease one allocation for their whole range and hand it back when done, so the number of
+	 * live allocations is bounded by the number of concurrently running scopes rather than by the number of queries.
+	 */
+	class PCGEXELEMENTSPATHFINDING_API FSearchAllocationsPool : public TSharedFromThis<FSearchAllocationsPool>
+	{
+	protected:
+		TSharedPtr<FPCGExSearchOperation> SearchOperation;
+		const PCGExClusters::FCluster* Cluster = nullptr;
+
+		FCriticalSection PoolLock;
+		TArray<TSharedPtr<FSearchAllocations>> Available;
+
+	public:
+		explicit FSearchAllocationsPool(const TSharedPtr<FPCGExSearchOperation>& InSearchOperation);
+
+		FORCEINLINE const PCGExClusters::FCluster* GetCluster() const { return Cluster; }
+
+		/** Get a ready-to-use allocation, either recycled or newly created */
+		TSharedPtr<FSearchAllocations> Acquire();
+
+		/** Hand an allocation back to the pool */
+		void Release(const TSharedPtr<FSearchAllocations>& InAllocations);
 	};
 }
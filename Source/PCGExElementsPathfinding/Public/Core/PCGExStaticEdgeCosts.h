@@ -0,0 +1,44 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGExClusters
+{
+	class FCluster;
+}
+
+namespace PCGExHeuristics
+{
+	class FHandler;
+	class FHeuristicScoreTable;
+}
+
+namespace PCGExPathfinding
+{
+	/**
+	 * Directed edge costs of a cluster, backed by the precompiled score table of a heuristics handler.
+	 * This is the common input of search acceleration caches (landmarks, contraction hierarchy); the hash identifies
+	 * a given set of costs so caches built from different heuristics don't get mixed up.
+	 */
+	class PCGEXELEMENTSPATHFINDING_API FStaticEdgeCosts : public TSharedFromThis<FStaticEdgeCosts>
+	{
+	public:
+		TSharedPtr<const PCGExHeuristics::FHeuristicScoreTable> Table;
+		TArray<int32> ReverseLinks; // Flat index of the same edge, seen from the other end
+		uint32 Hash = 0;            // Never 0 once built
+
+		int32 NumNodes() const;
+		int32 NumLinks() const;
+		double GetCost(const int32 NodeIndex, const int32 LinkIndex) const;
+		double GetReverseCost(const int32 NodeIndex, const int32 LinkIndex) const;
+
+		/**
+		 * Wrap the handler score table.
+		 * @return nullptr if the handler has no score table (edge scores aren't static), or if any score is negative or non-finite.
+		 */
+		static TSharedPtr<FStaticEdgeCosts> Make(const PCGExClusters::FCluster* InCluster, const PCGExHeuristics::FHandler& InHeuristics);
+	};
+}
@@ -14,6 +14,7 @@
 namespace PCGExPathfinding
 {
 	class FSearchAllocations;
+	class FSearchAllocationsPool;
 	class FPathQuery;
 }
 
@@ -158,6 +159,7 @@ namespace PCGExPathfindingEdges
 		TArray<TSharedPtr<PCGExPathfinding::FPathQuery>> Queries;
 		TArray<TSharedPtr<PCGExData::FPointIO>> QueriesIO;
 		TSharedPtr<PCGExPathfinding::FSearchAllocations> SearchAllocations;
+		TSharedPtr<PCGExPathfinding::FSearchAllocationsPool> AllocationsPool;
 
 	public:
 		FProcessor(const TSharedRef<PCGExData::FFacade>& InVtxDataFacade, const TSharedRef<PCGExData::FFacade>& InEdgeDataFacade)
@@ -16,6 +16,7 @@
 namespace PCGExPathfinding
 {
 	class FSearchAllocations;
+	class FSearchAllocationsPool;
 	class FPlotQuery;
 }
 
@@ -200,6 +201,7 @@ namespace PCGExPathfindingPlotEdges
 		TArray<TSharedPtr<PCGExPathfinding::FPlotQuery>> Queries;
 		TArray<TSharedPtr<PCGExData::FPointIO>> QueriesIO;
 		TSharedPtr<PCGExPathfinding::FSearchAllocations> SearchAllocations;
+		TSharedPtr<PCGExPathfinding::FSearchAllocationsPool> AllocationsPool;
 
 		TSharedPtr<PCGExClusters::FClusterDataForwardHandler> ClusterDataForwardHandler;
 
@@ -23,6 +23,8 @@ public:
 		const TSharedPtr<PCGExHeuristics::FLocalFeedbackHandler>& LocalFeedback = nullptr) const override;
 
 	virtual TSharedPtr<PCGExPathfinding::FSearchAllocations> NewAllocations() const override;
+
+	virtual bool SupportsAcceleration(const EPCGExSearchAcceleration InAcceleration) const override { return InAcceleration != EPCGExSearchAcceleration::None; }
 };
 
 /**
@@ -34,9 +36,22 @@ class UPCGExSearchAStar : public UPCGExSearchInstancedFactory
 	GENERATED_BODY()
 
 public:
+	virtual void CopySettingsFrom(const UPCGExInstancedFactory* Other) override;
+
 	virtual TSharedPtr<FPCGExSearchOperation> CreateOperation() const override
 	{
 		PCGEX_FACTORY_NEW_OPERATION(SearchOperationAStar)
+		ForwardSettings(NewOperation.Get());
+		NewOperation->Acceleration = Acceleration;
+		NewOperation->NumLandmarks = NumLandmarks;
 		return NewOperation;
 	}
+
+	/** Precomputed, cluster-cached data used to speed up queries. Only kicks in when all heuristics have static edge scores (no feedback, no travel-dependent or goal-dependent edge scores), otherwise the search runs as usual. Resulting paths are exact shortest paths over edge scores. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Performance", meta=(PCG_NotOverridable, AdvancedDisplay))
+	EPCGExSearchAcceleration Acceleration = EPCGExSearchAcceleration::None;
+
+	/** Number of landmarks. More landmarks give tighter bounds at the expense of memory & build time. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Performance", meta=(PCG_NotOverridable, AdvancedDisplay, EditCondition="Acceleration == EPCGExSearchAcceleration::Landmarks", ClampMin=1, ClampMax=32))
+	int32 NumLandmarks = 8;
 };
@@ -53,6 +53,7 @@ public:
 	virtual TSharedPtr<FPCGExSearchOperation> CreateOperation() const override
 	{
 		PCGEX_FACTORY_NEW_OPERATION(SearchOperationBellmanFord)
+		ForwardSettings(NewOperation.Get());
 		NewOperation->bDetectNegativeCycles = bDetectNegativeCycles;
 		return NewOperation;
 	}
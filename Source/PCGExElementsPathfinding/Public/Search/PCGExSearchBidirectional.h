@@ -19,26 +19,6 @@ namespace PCGEx
 
 class FPCGExHeuristicOperation;
 
-namespace PCGExPathfinding
-{
-	/**
-	 * Extended allocations for bidirectional search.
-	 * Maintains separate data structures for forward and backward searches.
-	 */
-	class PCGEXELEMENTSPATHFINDING_API FBidirectionalSearchAllocations : public FSearchAllocations
-	{
-	public:
-		// Backward search structures
-		TBitArray<> VisitedBackward;
-		TArray<double> GScoreBackward;
-		TSharedPtr<PCGEx::FHashLookup> TravelStackBackward;
-		TSharedPtr<PCGEx::FScoredQueue> ScoredQueueBackward;
-
-		void Init(const PCGExClusters::FCluster* InCluster);
-		void Reset();
-	};
-}
-
 /**
  * Bidirectional Search operation.
  * Searches from both seed and goal simultaneously, meeting in the middle.
@@ -52,6 +32,9 @@ public:
 		const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics,
 		const TSharedPtr<PCGExHeuristics::FLocalFeedbackHandler>& LocalFeedback = nullptr) const override;
 
+	virtual bool HasMonotoneScores() const override { return true; }
+	virtual bool SupportsAcceleration(const EPCGExSearchAcceleration InAcceleration) const override { return InAcceleration == EPCGExSearchAcceleration::ContractionHierarchy; }
+
 	virtual TSharedPtr<PCGExPathfinding::FSearchAllocations> NewAllocations() const override;
 
 protected:
@@ -77,9 +60,17 @@ class UPCGExSearchBidirectional : public UPCGExSearchInstancedFactory
 	GENERATED_BODY()
 
 public:
+	virtual void CopySettingsFrom(const UPCGExInstancedFactory* Other) override;
+
 	virtual TSharedPtr<FPCGExSearchOperation> CreateOperation() const override
 	{
 		PCGEX_FACTORY_NEW_OPERATION(SearchOperationBidirectional)
+		ForwardSettings(NewOperation.Get());
+		NewOperation->Acceleration = Acceleration;
 		return NewOperation;
 	}
+
+	/** Precomputed, cluster-cached contraction hierarchy used to speed up queries. Only kicks in when all heuristics have static edge scores (no feedback, no travel-dependent or goal-dependent edge scores), otherwise the search runs as usual. Resulting paths are exact shortest paths over edge scores. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Performance", meta=(PCG_NotOverridable, AdvancedDisplay, ValidEnumValues="None, ContractionHierarchy"))
+	EPCGExSearchAcceleration Acceleration = EPCGExSearchAcceleration::None;
 };
@@ -19,6 +19,8 @@ public:
 		const TSharedPtr<PCGExPathfinding::FSearchAllocations>& Allocations,
 		const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics,
 		const TSharedPtr<PCGExHeuristics::FLocalFeedbackHandler>& LocalFeedback = nullptr) const override;
+
+	virtual bool HasMonotoneScores() const override { return true; }
 };
 
 /**
@@ -33,6 +35,7 @@ public:
 	virtual TSharedPtr<FPCGExSearchOperation> CreateOperation() const override
 	{
 		PCGEX_FACTORY_NEW_OPERATION(SearchOperationDijkstra)
+		ForwardSettings(NewOperation.Get());
 		return NewOperation;
 	}
 };
@@ -12,6 +12,29 @@
 
 #include "PCGExSearchOperation.generated.h"
 
+namespace PCGEx
+{
+	enum class EScoredQueueBackend : uint8;
+}
+
+UENUM()
+enum class EPCGExSearchQueueType : uint8
+{
+	Auto           = 0 UMETA(DisplayName = "Auto", ToolTip="Pick the fastest queue for the search algorithm & cluster size."),
+	BinaryHeap     = 1 UMETA(DisplayName = "Binary Heap", ToolTip="General purpose binary heap. Works with any heuristic."),
+	QuaternaryHeap = 2 UMETA(DisplayName = "4-ary Heap", ToolTip="Shallower heap with a cache-friendly layout. Usually faster on large clusters."),
+	RadixHeap      = 3 UMETA(DisplayName = "Radix Heap", ToolTip="Monotone radix heap. Fastest for non-negative, monotone scores (Dijkstra, Bidirectional); ordering degrades if scores decrease."),
+	BucketQueue    = 4 UMETA(DisplayName = "Bucket Queue", ToolTip="Dial-style bucket queue over quantized scores. Fast when scores span a bounded range relative to the bucket width."),
+};
+
+UENUM()
+enum class EPCGExSearchAcceleration : uint8
+{
+	None                 = 0 UMETA(DisplayName = "None", ToolTip="Every query searches from scratch using live heuristics."),
+	Landmarks            = 1 UMETA(DisplayName = "Landmarks (ALT)", ToolTip="Precompute distances to a few landmark nodes and use them as exact A* lower bounds. A* only."),
+	ContractionHierarchy = 2 UMETA(DisplayName = "Contraction Hierarchy", ToolTip="Precompute a contraction hierarchy of the cluster and answer each query with a tiny upward search. Slower to build, fastest queries."),
+};
+
 namespace PCGExHeuristics
 {
 	class FLocalFeedbackHandler;
@@ -22,6 +45,8 @@ namespace PCGExPathfinding
 {
 	class FSearchAllocations;
 	class FPathQuery;
+	class FCachedLandmarks;
+	class FCachedContractionHierarchy;
 	struct FExtraWeights;
 }
 
@@ -30,15 +55,30 @@ class FPCGExHeuristicOperation;
 namespace PCGExClusters
 {
 	class FCluster;
+	class FClusterAdjacency;
 }
 
 class FPCGExSearchOperation : public FPCGExOperation
 {
 public:
 	bool bEarlyExit = true;
+	EPCGExSearchQueueType QueueType = EPCGExSearchQueueType::BinaryHeap;
+	double QueueBucketWidth = 0.01;
+	EPCGExSearchAcceleration Acceleration = EPCGExSearchAcceleration::None;
+	int32 NumLandmarks = 8;
 	PCGExClusters::FCluster* Cluster = nullptr;
+	TSharedPtr<const PCGExClusters::FClusterAdjacency> Adjacency; // Packed links of the current cluster, used by search loops
 
-	virtual void PrepareForCluster(PCGExClusters::FCluster* InCluster);
+	// Acceleration data for the current cluster; only set if the heuristics edge scores are static
+	TSharedPtr<PCGExPathfinding::FCachedLandmarks> Landmarks;
+	TSharedPtr<PCGExPathfinding::FCachedContractionHierarchy> Hierarchy;
+
+	/**
+	 * Prepare the operation for a given cluster.
+	 * When an acceleration is requested & supported, and the heuristics have static edge scores, this fetches
+	 * or builds the matching cluster cache.
+	 */
+	virtual void PrepareForCluster(PCGExClusters::FCluster* InCluster, const TSharedPtr<PCGExHeuristics::FHandler>& InHeuristics = nullptr);
 	virtual bool ResolveQuery(
 		const TSharedPtr<PCGExPathfinding::FPathQuery>& InQuery,
 		const TSharedPtr<PCGExPathfinding::FSearchAllocations>& Allocations,
@@ -46,6 +86,21 @@ public:
 		const TSharedPtr<PCGExHeuristics::FLocalFeedbackHandler>& LocalFeedback = nullptr) const;
 
 	virtual TSharedPtr<PCGExPathfinding::FSearchAllocations> NewAllocations() const;
+
+	/** Whether queued scores never go below the last dequeued one, given non-negative edge scores */
+	virtual bool HasMonotoneScores() const { return false; }
+
+	/** Whether this search can make use of a given acceleration structure */
+	virtual bool SupportsAcceleration(const EPCGExSearchAcceleration InAcceleration) const { return false; }
+
+	/** Resolve the queue backend to be used for the current cluster */
+	PCGEx::EScoredQueueBackend GetQueueBackend() const;
+
+protected:
+	/** Resolve a query through the cached contraction hierarchy. Requires allocations created while the hierarchy was set. */
+	bool ResolveQueryWithHierarchy(
+		const TSharedPtr<PCGExPathfinding::FPathQuery>& InQuery,
+		const TSharedPtr<PCGExPathfinding::FSearchAllocations>& Allocations) const;
 };
 
 /**
@@ -64,4 +119,15 @@ public:
 	/** Exit the search early once a valid path is found. Disabling explores all possible paths. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable))
 	bool bEarlyExit = true;
+
+	/** Priority queue used to order node expansion. Doesn't change the resulting paths, except when scores tie. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Performance", meta=(PCG_NotOverridable, AdvancedDisplay))
+	EPCGExSearchQueueType QueueType = EPCGExSearchQueueType::BinaryHeap;
+
+	/** Score range covered by a single bucket. Should be in the order of magnitude of the smallest score difference worth telling apart. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Performance", meta=(PCG_NotOverridable, AdvancedDisplay, EditCondition="QueueType == EPCGExSearchQueueType::BucketQueue", ClampMin=0.0001))
+	double QueueBucketWidth = 0.01;
+
+protected:
+	void ForwardSettings(FPCGExSearchOperation* InOperation) const;
 };
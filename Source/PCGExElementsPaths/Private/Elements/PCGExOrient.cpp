@@ -81,6 +81,7 @@ bool FPCGExOrientElement::AdvanceWork(FPCGExContext* InContext, const UPCGExSett
 				return true;
 			}, [&](const TSharedPtr<PCGExPointsMT::IBatch>& NewBatch)
 			{
+				NewBatch->bPipelinePhases = true;
 			}))
 		{
 			Context->CancelExecution(TEXT("Could not find any paths to orient."));
@@ -70,6 +70,7 @@ bool FPCGExResamplePathElement::AdvanceWork(FPCGExContext* InContext, const UPCG
 				return true;
 			}, [&](const TSharedPtr<PCGExPointsMT::IBatch>& NewBatch)
 			{
+				NewBatch->bPipelinePhases = true;
 			}))
 		{
 			return Context->CancelExecution(TEXT("Could not find any valid path."));
@@ -249,12 +250,18 @@ namespace PCGExResamplePath
 		}
 		else
 		{
-			TArray<PCGEx::FOpStats> Trackers;
-			MetadataBlender->InitTrackers(Trackers);
+			// Gather sources & weights for the whole scope, blend them in one go afterward
+			TArray<int32> SourcesA;
+			TArray<int32> SourcesB;
+			TArray<double> Weights;
+			SourcesA.SetNumUninitialized(Scope.Count);
+			SourcesB.SetNumUninitialized(Scope.Count);
+			Weights.SetNumUninitialized(Scope.Count);
 
 			PCGEX_SCOPE_LOOP(Index)
 			{
 				const FPointSample& Sample = Samples[Index];
+				const int32 i = Index - Scope.Start;
 
 				OutTransforms[Index].SetLocation(Sample.Location);
 
@@ -265,8 +272,9 @@ namespace PCGExResamplePath
 
 				//if (SourcesRange == 1)
 				//{
-				const double Weight = SampleBreadth > 0 ? FVector::Dist(Start, Sample.Location) / SampleBreadth : 0.5;
-				MetadataBlender->Blend(Sample.Start, Sample.End, Index, Weight);
+				SourcesA[i] = Sample.Start;
+				SourcesB[i] = Sample.End;
+				Weights[i] = SampleBreadth > 0 ? FVector::Dist(Start, Sample.Location) / SampleBreadth : 0.5;
 				//}
 
 				/*
@@ -288,6 +296,8 @@ namespace PCGExResamplePath
 				}
 				*/
 			}
+
+			MetadataBlender->BlendRange(SourcesA, SourcesB, Scope, Weights);
 		}
 	}
 
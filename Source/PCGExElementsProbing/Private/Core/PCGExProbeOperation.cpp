@@ -26,7 +26,7 @@ bool FPCGExProbeOperation::Prepare(FPCGExContext* InContext)
 	return true;
 }
 
-void FPCGExProbeOperation::ProcessCandidates(const int32 Index, TArray<PCGExProbing::FCandidate>& Candidates, TSet<uint64>* Coincidence, const FVector& ST, TSet<uint64>* OutEdges, PCGExMT::FScopedContainer* Container)
+void FPCGExProbeOperation::ProcessCandidates(const int32 Index, TArray<PCGExProbing::FCandidate>& Candidates, TSet<uint64>* Coincidence, const FVector& ST, TArray<uint64>* OutEdges, PCGExMT::FScopedContainer* Container)
 {
 }
 
@@ -40,6 +40,11 @@ bool FPCGExProbeOperation::WantsOctree() const
 	return false;
 }
 
+bool FPCGExProbeOperation::WantsKDTree() const
+{
+	return false;
+}
+
 void FPCGExProbeOperation::PrepareBestCandidate(const int32 Index, PCGExProbing::FBestCandidate& InBestCandidate, PCGExMT::FScopedContainer* Container)
 {
 }
@@ -48,15 +53,33 @@ void FPCGExProbeOperation::ProcessCandidateChained(const int32 Index, const int3
 {
 }
 
-void FPCGExProbeOperation::ProcessBestCandidate(const int32 Index, PCGExProbing::FBestCandidate& InBestCandidate, TArray<PCGExProbing::FCandidate>& Candidates, TSet<uint64>* Coincidence, const FVector& ST, TSet<uint64>* OutEdges, PCGExMT::FScopedContainer* Container)
+void FPCGExProbeOperation::ProcessBestCandidate(const int32 Index, PCGExProbing::FBestCandidate& InBestCandidate, TArray<PCGExProbing::FCandidate>& Candidates, TSet<uint64>* Coincidence, const FVector& ST, TArray<uint64>* OutEdges, PCGExMT::FScopedContainer* Container)
+{
+}
+
+void FPCGExProbeOperation::ProcessNode(const int32 Index, TSet<uint64>* Coincidence, const FVector& ST, TArray<uint64>* OutEdges, PCGExMT::FScopedContainer* Container)
+{
+}
+
+void FPCGExProbeOperation::ProcessAll(TArray<uint64>& OutEdges) const
+{
+}
+
+bool FPCGExProbeOperation::SupportsScopedProcessing() const
+{
+	return false;
+}
+
+int32 FPCGExProbeOperation::PrepareScopedProcessing()
 {
+	return 1;
 }
 
-void FPCGExProbeOperation::ProcessNode(const int32 Index, TSet<uint64>* Coincidence, const FVector& ST, TSet<uint64>* OutEdges, PCGExMT::FScopedContainer* Container)
+void FPCGExProbeOperation::ProcessScope(const int32 Pass, const PCGExMT::FScope& Scope, TArray<uint64>& OutEdges)
 {
 }
 
-void FPCGExProbeOperation::ProcessAll(TSet<uint64>& OutEdges) const
+void FPCGExProbeOperation::CompleteScopedProcessing()
 {
 }
 
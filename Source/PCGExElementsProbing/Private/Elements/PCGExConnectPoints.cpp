@@ -15,6 +15,7 @@
 #include "Core/PCGExProbingCandidates.h"
 #include "Graphs/PCGExGraphBuilder.h"
 #include "Helpers/PCGExArrayHelpers.h"
+#include "Sorting/PCGExSortingHelpers.h"
 
 #define LOCTEXT_NAMESPACE "PCGExConnectPointsElement"
 #define PCGEX_NAMESPACE BuildCustomGraph
@@ -99,11 +100,11 @@ namespace PCGExConnectPoints
 	{
 	}
 
-	void FProcessor::AppendEdges(const TSet<uint64>& InUniqueEdges)
+	void FProcessor::AppendEdges(TArray<uint64>&& InEdges)
 	{
-		FWriteScopeLock WriteScopeLock(UniqueEdgesLock);
-		UniqueEdges.Reserve(UniqueEdges.Num() + InUniqueEdges.Num());
-		UniqueEdges.Append(InUniqueEdges);
+		if (InEdges.IsEmpty()) { return; }
+		FWriteScopeLock WriteScopeLock(EdgeBatchesLock);
+		EdgeBatches.Add(MoveTemp(InEdges));
 	}
 
 	bool FProcessor::Process(const TSharedPtr<PCGExMT::FTaskManager>& InTaskManager)
@@ -150,10 +151,12 @@ namespace PCGExConnectPoints
 			AllOperations.Add(NewOperation);
 
 			if (NewOperation->WantsOctree()) { bWantsOctree = true; }
+			if (NewOperation->WantsKDTree()) { bWantsKDTree = true; }
 
 			if (NewOperation->IsGlobalProbe())
 			{
-				GlobalOperations.Add(NewOperation.Get());
+				if (NewOperation->SupportsScopedProcessing()) { ScopedGlobalOperations.Add(NewOperation.Get()); }
+				else { GlobalOperations.Add(NewOperation.Get()); }
 				continue;
 			}
 
@@ -176,13 +179,13 @@ namespace PCGExConnectPoints
 		NumChainedOps = ChainedOperations.Num();
 		NumSharedOps = SharedOperations.Num();
 		NumDirectOps = DirectOperations.Num();
-		NumGlobalOps = GlobalOperations.Num();
+		NumGlobalOps = GlobalOperations.Num() + ScopedGlobalOperations.Num();
 
 		if (!RadiusSources.IsEmpty()) { bWantsOctree = true; }
 
 		bOnlyGlobalOps = RadiusSources.IsEmpty() && DirectOperations.IsEmpty();
 
-		if (bOnlyGlobalOps && GlobalOperations.IsEmpty()) { return false; }
+		if (bOnlyGlobalOps && NumGlobalOps == 0) { return false; }
 
 		if (!PointDataFacade->Source->InitializeOutput<UPCGExClusterNodesData>(PCGExData::EIOInit::New)) { return false; }
 		GraphBuilder = MakeShared<PCGExGraphs::FGraphBuilder>(PointDataFacade, &Settings->GraphBuilderDetails);
@@ -278,14 +281,37 @@ namespace PCGExConnectPoints
 			for (const TSharedPtr<FPCGExProbeOperation>& Operation : AllOperations) { Operation->Octree = Octree.Get(); }
 		}
 
+		if (bWantsKDTree)
+		{
+			KDTree = MakeShared<PCGExKDTree::FKDTree>();
+			KDTree->Build(WorkingPositions, AcceptConnections);
+
+			for (const TSharedPtr<FPCGExProbeOperation>& Operation : AllOperations) { Operation->KDTree = KDTree.Get(); }
+		}
+
 		GeneratorsFilter.Reset();
 		ConnectableFilter.Reset();
 
-		NumCompletions = GlobalOperations.IsEmpty() ? 0 : 1;
-		if (!bOnlyGlobalOps)
+		// One completion for local probes, one for all legacy global probes, one per scoped global probe
+		NumCompletions = (GlobalOperations.IsEmpty() ? 0 : 1) + ScopedGlobalOperations.Num() + (bOnlyGlobalOps ? 0 : 1);
+
+		if (!bOnlyGlobalOps) { StartParallelLoopForPoints(PCGExData::EIOSide::In); }
+
+		if (!ScopedGlobalOperations.IsEmpty())
 		{
-			NumCompletions++;
-			StartParallelLoopForPoints(PCGExData::EIOSide::In);
+			PCGEX_ASYNC_GROUP_CHKD_VOID(TaskManager, ScopedGlobalOpsPrepTasks)
+
+			for (FPCGExProbeOperation* Operation : ScopedGlobalOperations)
+			{
+				ScopedGlobalOpsPrepTasks->AddSimpleCallback([PCGEX_ASYNC_THIS_CAPTURE, Op = Operation]()
+				{
+					PCGEX_ASYNC_THIS
+					const int32 NumPasses = Op->PrepareScopedProcessing();
+					This->StartScopedGlobalPass(Op, 0, NumPasses);
+				});
+			}
+
+			ScopedGlobalOpsPrepTasks->StartSimpleCallbacks();
 		}
 
 		if (!GlobalOperations.IsEmpty())
@@ -302,9 +328,9 @@ namespace PCGExConnectPoints
 				GlobalOpsTasks->AddSimpleCallback([PCGEX_ASYNC_THIS_CAPTURE, Op = Operation]()
 				{
 					PCGEX_ASYNC_THIS
-					TSet<uint64> LocalEdges;
+					TArray<uint64> LocalEdges;
 					Op->ProcessAll(LocalEdges);
-					if (!LocalEdges.IsEmpty()) { This->AppendEdges(LocalEdges); }
+					This->AppendEdges(MoveTemp(LocalEdges));
 				});
 			}
 
@@ -312,17 +338,52 @@ namespace PCGExConnectPoints
 		}
 	}
 
+	void FProcessor::StartScopedGlobalPass(FPCGExProbeOperation* Operation, const int32 Pass, const int32 NumPasses)
+	{
+		if (Pass >= NumPasses)
+		{
+			Operation->CompleteScopedProcessing();
+			AdvanceCompletion();
+			return;
+		}
+
+		PCGEX_ASYNC_GROUP_CHKD_VOID(TaskManager, ScopedGlobalOpTask)
+
+		// Each scope writes to its own edge list, no locking or hashing until the final merge
+		TSharedPtr<TArray<TArray<uint64>>> PassEdges = MakeShared<TArray<TArray<uint64>>>();
+
+		ScopedGlobalOpTask->OnPrepareSubLoopsCallback = [PassEdges](const TArray<PCGExMT::FScope>& Loops)
+		{
+			PassEdges->SetNum(Loops.Num());
+		};
+
+		ScopedGlobalOpTask->OnSubLoopStartCallback = [PCGEX_ASYNC_THIS_CAPTURE, Operation, Pass, PassEdges](const PCGExMT::FScope& Scope)
+		{
+			PCGEX_ASYNC_THIS
+			Operation->ProcessScope(Pass, Scope, (*PassEdges)[Scope.LoopIndex]);
+		};
+
+		ScopedGlobalOpTask->OnCompleteCallback = [PCGEX_ASYNC_THIS_CAPTURE, Operation, Pass, NumPasses, PassEdges]()
+		{
+			PCGEX_ASYNC_THIS
+			for (TArray<uint64>& ScopeEdges : *PassEdges) { This->AppendEdges(MoveTemp(ScopeEdges)); }
+			This->StartScopedGlobalPass(Operation, Pass + 1, NumPasses);
+		};
+
+		ScopedGlobalOpTask->StartSubLoops(PointDataFacade->GetNum(), PCGEX_CORE_SETTINGS.GetPointsBatchChunkSize());
+	}
+
 	void FProcessor::PrepareLoopScopesForPoints(const TArray<PCGExMT::FScope>& Loops)
 	{
 		IProcessor::PrepareLoopScopesForPoints(Loops);
-		ScopedEdges = MakeShared<PCGExMT::TScopedSet<uint64>>(Loops, 10);
+		ScopedEdges = MakeShared<PCGExMT::TScopedArray<uint64>>(Loops);
 	}
 
 	void FProcessor::ProcessPoints(const PCGExMT::FScope& Scope)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(PCGEx::ConnectPoints::ProcessPoints);
 
-		TSet<uint64>* LocalUniqueEdges = ScopedEdges->Get(Scope).Get();
+		TArray<uint64>* LocalEdges = ScopedEdges->Get(Scope).Get();
 		TUniquePtr<TSet<uint64>> LocalCoincidence;
 		if (bPreventCoincidence) { LocalCoincidence = MakeUnique<TSet<uint64>>(); }
 
@@ -401,29 +462,25 @@ namespace PCGExConnectPoints
 
 				for (int i = 0; i < NumChainedOps; i++)
 				{
-					ChainedOperations[i]->ProcessBestCandidate(Index, BestCandidates[i], Candidates, LocalCoincidence.Get(), CWCoincidenceTolerance, LocalUniqueEdges, ChainedOpsContainers[i].Get());
+					ChainedOperations[i]->ProcessBestCandidate(Index, BestCandidates[i], Candidates, LocalCoincidence.Get(), CWCoincidenceTolerance, LocalEdges, ChainedOpsContainers[i].Get());
 				}
 
 				for (int i = 0; i < NumSharedOps; i++)
 				{
-					SharedOperations[i]->ProcessCandidates(Index, Candidates, LocalCoincidence.Get(), CWCoincidenceTolerance, LocalUniqueEdges, SharedOpsContainers[i].Get());
+					SharedOperations[i]->ProcessCandidates(Index, Candidates, LocalCoincidence.Get(), CWCoincidenceTolerance, LocalEdges, SharedOpsContainers[i].Get());
 				}
 			}
 
 			for (int i = 0; i < NumDirectOps; i++)
 			{
-				DirectOperations[i]->ProcessNode(Index, LocalCoincidence.Get(), CWCoincidenceTolerance, LocalUniqueEdges, DirectOpsContainers[i].Get());
+				DirectOperations[i]->ProcessNode(Index, LocalCoincidence.Get(), CWCoincidenceTolerance, LocalEdges, DirectOpsContainers[i].Get());
 			}
 		}
 	}
 
 	void FProcessor::OnPointsProcessingComplete()
 	{
-		{
-			FWriteScopeLock WriteScopeLock(UniqueEdgesLock);
-			ScopedEdges->Collapse(UniqueEdges);
-		}
-
+		ScopedEdges->ForEach([&](TArray<uint64>& ScopeEdges) { AppendEdges(MoveTemp(ScopeEdges)); });
 		ScopedEdges.Reset();
 
 		AdvanceCompletion();
@@ -433,7 +490,35 @@ namespace PCGExConnectPoints
 	{
 		if (FPlatformAtomics::InterlockedDecrement(&NumCompletions)) { return; }
 
-		GraphBuilder->Graph->InsertEdges_Unsafe(UniqueEdges, -1);
+		// Flatten all edge batches, then radix sort & dedupe into the final unique edge list
+		TArray<uint64> UniqueEdges;
+
+		{
+			FWriteScopeLock WriteScopeLock(EdgeBatchesLock);
+
+			const int32 NumBatches = EdgeBatches.Num();
+			TArray<int32> Offsets;
+			Offsets.SetNumUninitialized(NumBatches);
+
+			int32 NumEdges = 0;
+			for (int32 i = 0; i < NumBatches; i++)
+			{
+				Offsets[i] = NumEdges;
+				NumEdges += EdgeBatches[i].Num();
+			}
+
+			UniqueEdges.SetNumUninitialized(NumEdges);
+			PCGEX_PARALLEL_FOR_THRESHOLD(
+				NumBatches, 2,
+				FMemory::Memcpy(UniqueEdges.GetData() + Offsets[i], EdgeBatches[i].GetData(), EdgeBatches[i].Num() * sizeof(uint64));
+			)
+
+			EdgeBatches.Empty();
+		}
+
+		PCGExSortingHelpers::SortUnique(UniqueEdges);
+
+		GraphBuilder->Graph->InsertSortedUniqueEdges(UniqueEdges, -1);
 		GraphBuilder->CompileAsync(TaskManager, true);
 	}
 
@@ -454,6 +539,7 @@ namespace PCGExConnectPoints
 	{
 		TProcessor<FPCGExConnectPointsContext, UPCGExConnectPointsSettings>::Cleanup();
 		AllOperations.Empty();
+		KDTree.Reset();
 	}
 }
 
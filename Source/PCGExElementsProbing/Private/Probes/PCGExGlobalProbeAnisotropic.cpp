@@ -39,7 +39,7 @@ double FPCGExProbeGlobalAnisotropic::ComputeGlobalAnisotropicDistSq(const FVecto
 	return Transformed.SizeSquared();
 }
 
-void FPCGExProbeGlobalAnisotropic::ProcessAll(TSet<uint64>& OutEdges) const
+void FPCGExProbeGlobalAnisotropic::ProcessAll(TArray<uint64>& OutEdges) const
 {
 	const TArray<FVector>& Positions = *WorkingPositions;
 	const int32 NumPoints = Positions.Num();
@@ -106,7 +106,7 @@ void FPCGExProbeChain::ComputeGreedyTSPOrder(TArray<int32>& OutOrder) const
 	}
 }
 
-void FPCGExProbeChain::ProcessAll(TSet<uint64>& OutEdges) const
+void FPCGExProbeChain::ProcessAll(TArray<uint64>& OutEdges) const
 {
 	const TArray<FVector>& Positions = *WorkingPositions;
 	const int32 NumPoints = Positions.Num();
@@ -14,7 +14,7 @@ bool FPCGExProbeDBSCAN::Prepare(FPCGExContext* InContext)
 	return FPCGExProbeOperation::Prepare(InContext);
 }
 
-void FPCGExProbeDBSCAN::ProcessAll(TSet<uint64>& OutEdges) const
+void FPCGExProbeDBSCAN::ProcessAll(TArray<uint64>& OutEdges) const
 {
 	const TArray<FVector>& Positions = *WorkingPositions;
 	const int32 NumPoints = Positions.Num();
@@ -22,7 +22,7 @@ bool FPCGExProbeGradientFlow::Prepare(FPCGExContext* InContext)
 	return true;
 }
 
-void FPCGExProbeGradientFlow::ProcessAll(TSet<uint64>& OutEdges) const
+void FPCGExProbeGradientFlow::ProcessAll(TArray<uint64>& OutEdges) const
 {
 	const TArray<FVector>& Positions = *WorkingPositions;
 	const int32 NumPoints = Positions.Num();
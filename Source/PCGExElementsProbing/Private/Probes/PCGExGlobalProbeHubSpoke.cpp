@@ -4,10 +4,13 @@
 #include "Probes/PCGExGlobalProbeHubSpoke.h"
 #include "Data/PCGExData.h"
 #include "Data/PCGExPointIO.h"
+#include "PCGExCoreSettingsCache.h"
+#include "Core/PCGExMT.h"
 
 PCGEX_CREATE_PROBE_FACTORY(HubSpoke, {}, {})
 
 bool FPCGExProbeHubSpoke::IsGlobalProbe() const { return true; }
+bool FPCGExProbeHubSpoke::SupportsScopedProcessing() const { return true; }
 
 bool FPCGExProbeHubSpoke::Prepare(FPCGExContext* InContext)
 {
@@ -22,7 +25,7 @@ bool FPCGExProbeHubSpoke::Prepare(FPCGExContext* InContext)
 	return true;
 }
 
-void FPCGExProbeHubSpoke::SelectHubsByDensity(TArray<int32>& OutHubs) const
+void FPCGExProbeHubSpoke::SelectHubsByDensity(const PCGExKDTree::FKDTree& PointsTree, TArray<int32>& OutHubs) const
 {
 	const TArray<FVector>& Positions = *WorkingPositions;
 	const int32 NumPoints = Positions.Num();
@@ -30,36 +33,40 @@ void FPCGExProbeHubSpoke::SelectHubsByDensity(TArray<int32>& OutHubs) const
 
 	// Compute local density (inverse of average distance to K nearest neighbors)
 	constexpr int32 DensityK = 5;
-	TArray<TPair<double, int32>> DensityScores;
-	DensityScores.Reserve(NumPoints);
+	const int32 K = FMath::Min(DensityK, NumPoints - 1);
 
-	TArray<double> Distances;
-	Distances.SetNum(NumPoints);
+	TArray<double> Densities;
+	Densities.Init(-1, NumPoints);
 
-	for (int32 i = 0; i < NumPoints; ++i)
-	{
-		if (!CanGenerateRef[i]) { continue; }
+	TArray<PCGExMT::FScope> Scopes;
+	const int32 NumScopes = PCGExMT::SubLoopScopes(Scopes, NumPoints, PCGEX_CORE_SETTINGS.GetPointsBatchChunkSize());
 
-		for (int32 j = 0; j < NumPoints; ++j)
-		{
-			Distances[j] = (j != i) ? FVector::DistSquared(Positions[i], Positions[j]) : MAX_dbl;
-		}
+	PCGEX_PARALLEL_FOR_THRESHOLD(
+		NumScopes, 2,
 
-		Algo::Sort(Distances);
+		const PCGExMT::FScope& Scope = Scopes[i];
+		TArray<PCGExKDTree::FNeighbor> Nearest;
 
-		double AvgDist = 0;
-		const int32 K = FMath::Min(DensityK, NumPoints - 1);
-		for (int32 k = 0; k < K; ++k)
+		PCGEX_SCOPE_LOOP(Index)
 		{
-			AvgDist += FMath::Sqrt(Distances[k]);
+			if (!CanGenerateRef[Index]) { continue; }
+
+			PointsTree.FindKNearest(Positions[Index], K, Nearest, [Index](const int32 Other) { return Other != Index; });
+
+			double AvgDist = 0;
+			for (const PCGExKDTree::FNeighbor& Neighbor : Nearest) { AvgDist += FMath::Sqrt(Neighbor.DistSquared); }
+			AvgDist /= K;
+
+			Densities[Index] = 1.0 / FMath::Max(AvgDist, SMALL_NUMBER);
 		}
-		AvgDist /= K;
+	)
 
-		DensityScores.Add({1.0 / FMath::Max(AvgDist, SMALL_NUMBER), i});
-	}
+	TArray<TPair<double, int32>> DensityScores;
+	DensityScores.Reserve(NumPoints);
+	for (int32 i = 0; i < NumPoints; ++i) { if (CanGenerateRef[i]) { DensityScores.Add({Densities[i], i}); } }
 
 	// Sort by density (highest first)
-	Algo::Sort(DensityScores, [](const auto& A, const auto& B) { return A.Key > B.Key; });
+	Algo::Sort(DensityScores, [](const auto& A, const auto& B) { return A.Key > B.Key || (A.Key == B.Key && A.Value < B.Value); });
 
 	// Take top N as hubs
 	const int32 NumHubs = FMath::Min(Config.NumHubs, DensityScores.Num());
@@ -92,43 +99,49 @@ void FPCGExProbeHubSpoke::SelectHubsByAttribute(TArray<int32>& OutHubs) const
 	}
 }
 
-void FPCGExProbeHubSpoke::SelectHubsByCentrality(TArray<int32>& OutHubs) const
+void FPCGExProbeHubSpoke::SelectHubsByCentrality(const PCGExKDTree::FKDTree& PointsTree, TArray<int32>& OutHubs) const
 {
 	const TArray<FVector>& Positions = *WorkingPositions;
 	const int32 NumPoints = Positions.Num();
 	const TArray<int8>& CanGenerateRef = *CanGenerate;
 
 	// Compute centrality: points closest to local centroid of neighborhood
-	TArray<TPair<double, int32>> CentralityScores;
-	CentralityScores.Reserve(NumPoints);
+	TArray<double> Centralities;
+	Centralities.Init(-1, NumPoints);
 
-	for (int32 i = 0; i < NumPoints; ++i)
-	{
-		if (!CanGenerateRef[i]) { continue; }
+	TArray<PCGExMT::FScope> Scopes;
+	const int32 NumScopes = PCGExMT::SubLoopScopes(Scopes, NumPoints, PCGEX_CORE_SETTINGS.GetPointsBatchChunkSize());
 
-		// Compute centroid of points within radius
-		const double Radius = GetSearchRadius(i);
-		FVector Centroid = FVector::ZeroVector;
-		int32 Count = 0;
+	PCGEX_PARALLEL_FOR_THRESHOLD(
+		NumScopes, 2,
 
-		for (int32 j = 0; j < NumPoints; ++j)
-		{
-			if (FVector::DistSquared(Positions[i], Positions[j]) <= Radius)
-			{
-				Centroid += Positions[j];
-				Count++;
-			}
-		}
+		const PCGExMT::FScope& Scope = Scopes[i];
+		TArray<int32> InRadius;
 
-		if (Count > 0)
+		PCGEX_SCOPE_LOOP(Index)
 		{
-			Centroid /= Count;
-			const double DistToCentroid = FVector::Dist(Positions[i], Centroid);
-			CentralityScores.Add({DistToCentroid, i}); // Lower is more central
+			if (!CanGenerateRef[Index]) { continue; }
+
+			// Compute centroid of points within radius, accumulated in index order
+			InRadius.Reset();
+			PointsTree.FindInRadius(Positions[Index], GetSearchRadius(Index), [&](const int32 Other, const double) { InRadius.Add(Other); });
+			if (InRadius.IsEmpty()) { continue; }
+
+			InRadius.Sort();
+
+			FVector Centroid = FVector::ZeroVector;
+			for (const int32 Other : InRadius) { Centroid += Positions[Other]; }
+			Centroid /= InRadius.Num();
+
+			Centralities[Index] = FVector::Dist(Positions[Index], Centroid); // Lower is more central
 		}
-	}
+	)
+
+	TArray<TPair<double, int32>> CentralityScores;
+	CentralityScores.Reserve(NumPoints);
+	for (int32 i = 0; i < NumPoints; ++i) { if (Centralities[i] >= 0) { CentralityScores.Add({Centralities[i], i}); } }
 
-	Algo::Sort(CentralityScores, [](const auto& A, const auto& B) { return A.Key < B.Key; });
+	Algo::Sort(CentralityScores, [](const auto& A, const auto& B) { return A.Key < B.Key || (A.Key == B.Key && A.Value < B.Value); });
 
 	const int32 NumHubs = FMath::Min(Config.NumHubs, CentralityScores.Num());
 	for (int32 i = 0; i < NumHubs; ++i)
@@ -137,7 +150,7 @@ void FPCGExProbeHubSpoke::SelectHubsByCentrality(TArray<int32>& OutHubs) const
 	}
 }
 
-void FPCGExProbeHubSpoke::SelectHubsByKMeans(TArray<int32>& OutHubs) const
+void FPCGExProbeHubSpoke::SelectHubsByKMeans(const PCGExKDTree::FKDTree& PointsTree, TArray<int32>& OutHubs) const
 {
 	const TArray<FVector>& Positions = *WorkingPositions;
 	const int32 NumPoints = Positions.Num();
@@ -177,9 +190,10 @@ void FPCGExProbeHubSpoke::SelectHubsByKMeans(TArray<int32>& OutHubs) const
 	for (int32 Iter = 0; Iter < Config.KMeansIterations; ++Iter)
 	{
 		// Assignment step
-		for (int32 i = 0; i < NumPoints; ++i)
-		{
-			if (!CanGenerateRef[i]) { continue; }
+		PCGEX_PARALLEL_FOR(
+			NumPoints,
+
+			if (!CanGenerateRef[i]) { return; }
 
 			double BestDist = MAX_dbl;
 			int32 BestCluster = 0;
@@ -194,7 +208,7 @@ void FPCGExProbeHubSpoke::SelectHubsByKMeans(TArray<int32>& OutHubs) const
 				}
 			}
 			Assignments[i] = BestCluster;
-		}
+		)
 
 		// Update step
 		TArray<FVector> NewCentroids;
@@ -222,19 +236,7 @@ void FPCGExProbeHubSpoke::SelectHubsByKMeans(TArray<int32>& OutHubs) const
 	for (int32 c = 0; c < K; ++c)
 	{
 		double BestDist = MAX_dbl;
-		int32 BestPoint = INDEX_NONE;
-
-		for (int32 i = 0; i < NumPoints; ++i)
-		{
-			if (!CanGenerateRef[i]) { continue; }
-
-			const double Dist = FVector::DistSquared(Positions[i], Centroids[c]);
-			if (Dist < BestDist)
-			{
-				BestDist = Dist;
-				BestPoint = i;
-			}
-		}
+		const int32 BestPoint = PointsTree.FindNearest(Centroids[c], BestDist, [&](const int32 Other) { return CanGenerateRef[Other] != 0; });
 
 		if (BestPoint != INDEX_NONE)
 		{
@@ -243,95 +245,123 @@ void FPCGExProbeHubSpoke::SelectHubsByKMeans(TArray<int32>& OutHubs) const
 	}
 }
 
-void FPCGExProbeHubSpoke::ProcessAll(TSet<uint64>& OutEdges) const
+int32 FPCGExProbeHubSpoke::PrepareScopedProcessing()
 {
 	const TArray<FVector>& Positions = *WorkingPositions;
 	const int32 NumPoints = Positions.Num();
-	if (NumPoints < 2) { return; }
 
-	const TArray<int8>& CanGenerateRef = *CanGenerate;
-	const TArray<int8>& AcceptConnectionsRef = *AcceptConnections;
+	Hubs.Reset();
+
+	if (NumPoints < 2) { return 0; }
+
+	// Spatial index over all points, used by spatial hub selection modes
+	PCGExKDTree::FKDTree PointsTree;
+	if (Config.HubSelectionMode != EPCGExHubSelectionMode::ByAttribute) { PointsTree.Build(Positions); }
 
 	// Select hubs
-	TArray<int32> Hubs;
 	switch (Config.HubSelectionMode)
 	{
 	case EPCGExHubSelectionMode::ByDensity:
-		SelectHubsByDensity(Hubs);
+		SelectHubsByDensity(PointsTree, Hubs);
 		break;
 	case EPCGExHubSelectionMode::ByAttribute:
 		SelectHubsByAttribute(Hubs);
 		break;
 	case EPCGExHubSelectionMode::ByCentrality:
-		SelectHubsByCentrality(Hubs);
+		SelectHubsByCentrality(PointsTree, Hubs);
 		break;
 	case EPCGExHubSelectionMode::KMeansCentroids:
-		SelectHubsByKMeans(Hubs);
+		SelectHubsByKMeans(PointsTree, Hubs);
 		break;
 	}
 
-	if (Hubs.Num() == 0) { return; }
+	const int32 NumHubs = Hubs.Num();
+
+	HubOrder.Init(-1, NumPoints);
+	for (int32 h = 0; h < NumHubs; ++h) { HubOrder[Hubs[h]] = h; }
+
+	// Hub-only index; item index is the hub order so nearest-hub ties resolve like a linear scan over hubs would
+	TArray<FVector> HubPositions;
+	TArray<int32> HubIndices;
+	HubPositions.SetNumUninitialized(NumHubs);
+	HubIndices.SetNumUninitialized(NumHubs);
+	for (int32 h = 0; h < NumHubs; ++h)
+	{
+		HubPositions[h] = Positions[Hubs[h]];
+		HubIndices[h] = h;
+	}
+
+	HubsTree.Build(HubPositions, HubIndices);
+
+	return 1;
+}
+
+void FPCGExProbeHubSpoke::ProcessScope(const int32 Pass, const PCGExMT::FScope& Scope, TArray<uint64>& OutEdges)
+{
+	if (Hubs.IsEmpty()) { return; }
+
+	const TArray<FVector>& Positions = *WorkingPositions;
+	const TArray<int8>& CanGenerateRef = *CanGenerate;
+	const TArray<int8>& AcceptConnectionsRef = *AcceptConnections;
 
-	TSet<int32> HubSet(Hubs);
+	const int32 NumHubs = Hubs.Num();
 
-	// Connect hubs to each other
-	if (Config.bConnectHubs)
+	PCGEX_SCOPE_LOOP(Index)
 	{
-		for (int32 i = 0; i < Hubs.Num(); ++i)
+		if (const int32 Order = HubOrder[Index]; Order != -1)
 		{
-			for (int32 j = i + 1; j < Hubs.Num(); ++j)
+			// Connect hubs to each other, each hub owning the pairs with hubs that come after it
+			if (!Config.bConnectHubs) { continue; }
+
+			for (int32 j = Order + 1; j < NumHubs; ++j)
 			{
-				const double MaxDistSq = FMath::Max(GetSearchRadius(Hubs[i]), GetSearchRadius(Hubs[j]));
-				if (FVector::DistSquared(Positions[Hubs[i]], Positions[Hubs[j]]) <= MaxDistSq)
+				const double MaxDistSq = FMath::Max(GetSearchRadius(Index), GetSearchRadius(Hubs[j]));
+				if (FVector::DistSquared(Positions[Index], Positions[Hubs[j]]) <= MaxDistSq)
 				{
-					OutEdges.Add(PCGEx::H64U(Hubs[i], Hubs[j]));
+					OutEdges.Add(PCGEx::H64U(Index, Hubs[j]));
 				}
 			}
+
+			continue;
 		}
-	}
 
-	// Connect spokes to hubs
-	for (int32 i = 0; i < NumPoints; ++i)
-	{
-		if (HubSet.Contains(i)) { continue; }
-		if (!CanGenerateRef[i] && !AcceptConnectionsRef[i]) { continue; }
+		// Connect spokes to hubs
+		if (!CanGenerateRef[Index] && !AcceptConnectionsRef[Index]) { continue; }
 
-		const double MaxDistSq = GetSearchRadius(i);
+		const double MaxDistSq = GetSearchRadius(Index);
 
 		if (Config.bNearestHubOnly)
 		{
 			// Find nearest hub
 			double BestDist = MAX_dbl;
-			int32 BestHub = INDEX_NONE;
+			const int32 BestHubOrder = HubsTree.FindNearest(Positions[Index], BestDist, MaxDistSq);
+			if (BestHubOrder == INDEX_NONE) { continue; }
 
-			for (const int32 Hub : Hubs)
+			const int32 BestHub = Hubs[BestHubOrder];
+			if (CanGenerateRef[Index] || CanGenerateRef[BestHub])
 			{
-				const double Dist = FVector::DistSquared(Positions[i], Positions[Hub]);
-				if (Dist < BestDist && Dist <= MaxDistSq)
-				{
-					BestDist = Dist;
-					BestHub = Hub;
-				}
-			}
-
-			if (BestHub != INDEX_NONE && (CanGenerateRef[i] || CanGenerateRef[BestHub]))
-			{
-				OutEdges.Add(PCGEx::H64U(i, BestHub));
+				OutEdges.Add(PCGEx::H64U(Index, BestHub));
 			}
 		}
 		else
 		{
 			// Connect to all hubs within radius
-			for (const int32 Hub : Hubs)
-			{
-				if (FVector::DistSquared(Positions[i], Positions[Hub]) <= MaxDistSq)
+			HubsTree.FindInRadius(
+				Positions[Index], MaxDistSq, [&](const int32 HubIndex, const double)
 				{
-					if (CanGenerateRef[i] || CanGenerateRef[Hub])
+					const int32 Hub = Hubs[HubIndex];
+					if (CanGenerateRef[Index] || CanGenerateRef[Hub])
 					{
-						OutEdges.Add(PCGEx::H64U(i, Hub));
+						OutEdges.Add(PCGEx::H64U(Index, Hub));
 					}
-				}
-			}
+				});
 		}
 	}
 }
+
+void FPCGExProbeHubSpoke::CompleteScopedProcessing()
+{
+	Hubs.Empty();
+	HubOrder.Empty();
+	HubsTree.Reset();
+}
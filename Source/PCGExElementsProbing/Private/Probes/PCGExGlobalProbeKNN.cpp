@@ -4,11 +4,14 @@
 #include "Probes/PCGExGlobalProbeKNN.h"
 
 #include "Data/PCGExPointIO.h"
+#include "Core/PCGExMTCommon.h"
 #include "Details/PCGExSettingsDetails.h"
 
 PCGEX_CREATE_PROBE_FACTORY(KNN, {}, {})
 
 bool FPCGExProbeKNN::IsGlobalProbe() const { return true; }
+bool FPCGExProbeKNN::WantsKDTree() const { return true; }
+bool FPCGExProbeKNN::SupportsScopedProcessing() const { return true; }
 
 bool FPCGExProbeKNN::Prepare(FPCGExContext* InContext)
 {
@@ -20,65 +23,70 @@ bool FPCGExProbeKNN::Prepare(FPCGExContext* InContext)
 	return true;
 }
 
-void FPCGExProbeKNN::ProcessAll(TSet<uint64>& OutEdges) const
+int32 FPCGExProbeKNN::PrepareScopedProcessing()
 {
-	const TArray<FVector>& Positions = *WorkingPositions;
-	const int32 NumPoints = Positions.Num();
-	if (NumPoints < 2) { return; }
+	const int32 NumPoints = WorkingPositions->Num();
+	const TArray<int8>& CanGenerateRef = *CanGenerate;
 
-	const TArray<int8> CanGenerateRef = *CanGenerate;
-	const TArray<int8> AcceptConnectionsRef = *AcceptConnections;
+	bMutual = Config.Mode == EPCGExProbeKNNMode::Mutual;
+	const int32 NumCandidates = KDTree ? KDTree->Num() : 0;
 
-	// TODO : Use octree for faster queries, this is crude
+	Offsets.SetNumUninitialized(NumPoints + 1);
+	Offsets[0] = 0;
 
-	// For each point, find K nearest neighbors
-	TArray<TPair<float, int32>> Distances;
-	Distances.SetNum(NumPoints);
+	for (int32 i = 0; i < NumPoints; ++i)
+	{
+		Offsets[i + 1] = Offsets[i] + (CanGenerateRef[i] ? FMath::Clamp(K->Read(i), 0, NumCandidates) : 0);
+	}
 
-	const bool bMutual = Config.Mode == EPCGExProbeKNNMode::Mutual;
+	Neighbors.Init(-1, Offsets[NumPoints]);
 
-	// Build neighbor sets for each point
-	TArray<TSet<int32>> NeighborSets;
-	if (bMutual) { NeighborSets.SetNum(NumPoints); }
+	// Mutual mode needs every neighbor list before it can check reciprocity
+	return bMutual ? 2 : 1;
+}
 
-	for (int32 i = 0; i < NumPoints; ++i)
+void FPCGExProbeKNN::ProcessScope(const int32 Pass, const PCGExMT::FScope& Scope, TArray<uint64>& OutEdges)
+{
+	if (Pass == 0)
 	{
-		if (!CanGenerateRef[i]) { continue; }
+		const TArray<FVector>& Positions = *WorkingPositions;
+		TArray<PCGExKDTree::FNeighbor> Found;
 
-		const int32 ActualK = FMath::Min(K->Read(i), NumPoints - 1);
-
-		// Compute distances to all other points
-		for (int32 j = 0; j < NumPoints; ++j)
+		PCGEX_SCOPE_LOOP(Index)
 		{
-			Distances[j] = {(AcceptConnectionsRef[j] && j != i) ? FVector::DistSquared(Positions[i], Positions[j]) : MAX_dbl, j};
-		}
+			const int32 Start = Offsets[Index];
+			const int32 Count = Offsets[Index + 1] - Start;
+			if (!Count) { continue; }
 
-		// Partial sort to get K smallest
-		Algo::Sort(Distances, [](const auto& A, const auto& B) { return A.Key < B.Key; });
+			KDTree->FindKNearest(Positions[Index], Count, Found, [Index](const int32 Other) { return Other != Index; });
+			for (int32 k = 0; k < Found.Num(); ++k) { Neighbors[Start + k] = Found[k].Index; }
 
-		if (bMutual)
-		{
-			for (int32 k = 0; k < ActualK; ++k) { NeighborSets[i].Add(Distances[k].Value); }
-		}
-		else
-		{
-			// Add edges to K nearest
-			for (int32 k = 0; k < ActualK; ++k) { OutEdges.Add(PCGEx::H64U(i, Distances[k].Value)); }
+			if (!bMutual) { for (const PCGExKDTree::FNeighbor& Neighbor : Found) { OutEdges.Add(PCGEx::H64U(Index, Neighbor.Index)); } }
 		}
+
+		return;
 	}
 
-	if (bMutual)
+	// Only keep edges where each end is among the other's nearest neighbors
+	PCGEX_SCOPE_LOOP(Index)
 	{
-		// Only add edge if mutual
-		for (int32 i = 0; i < NumPoints; ++i)
+		for (int32 k = Offsets[Index]; k < Offsets[Index + 1]; ++k)
 		{
-			for (const int32 j : NeighborSets[i])
+			const int32 j = Neighbors[k];
+			if (j <= Index) { continue; }
+
+			for (int32 l = Offsets[j]; l < Offsets[j + 1]; ++l)
 			{
-				if (j > i && NeighborSets[j].Contains(i))
-				{
-					OutEdges.Add(PCGEx::H64U(i, j));
-				}
+				if (Neighbors[l] != Index) { continue; }
+				OutEdges.Add(PCGEx::H64U(Index, j));
+				break;
 			}
 		}
 	}
 }
+
+void FPCGExProbeKNN::CompleteScopedProcessing()
+{
+	Offsets.Empty();
+	Neighbors.Empty();
+}
@@ -34,7 +34,7 @@ bool FPCGExProbeLevelSet::Prepare(FPCGExContext* InContext)
 	return true;
 }
 
-void FPCGExProbeLevelSet::ProcessAll(TSet<uint64>& OutEdges) const
+void FPCGExProbeLevelSet::ProcessAll(TArray<uint64>& OutEdges) const
 {
 	const TArray<FVector>& Positions = *WorkingPositions;
 	const int32 NumPoints = Positions.Num();
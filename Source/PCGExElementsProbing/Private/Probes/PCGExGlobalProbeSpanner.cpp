@@ -3,63 +3,204 @@
 
 #include "Probes/PCGExGlobalProbeSpanner.h"
 #include "Data/PCGExPointIO.h"
+#include "PCGExCoreSettingsCache.h"
+#include "Core/PCGExMT.h"
+#include "Math/PCGExBestFitPlane.h"
+#include "Math/PCGExProjectionDetails.h"
+#include "Math/Geo/PCGExDelaunay.h"
 
 PCGEX_CREATE_PROBE_FACTORY(Spanner, {}, {})
 
 bool FPCGExProbeSpanner::IsGlobalProbe() const { return true; }
+bool FPCGExProbeSpanner::WantsKDTree() const { return Config.Candidates == EPCGExSpannerCandidates::KNearest; }
 
 bool FPCGExProbeSpanner::Prepare(FPCGExContext* InContext)
 {
 	return FPCGExProbeOperation::Prepare(InContext);
 }
 
-double FPCGExProbeSpanner::GetGraphDistance(int32 From, int32 To,
-                                            const TArray<TSet<int32>>& Adjacency, const TArray<FVector>& Positions) const
+bool FPCGExProbeSpanner::HasPathWithin(const int32 From, const int32 To, const double MaxDist, const TArray<TArray<int32>>& Adjacency, const TArray<FVector>& Positions, FPathScratch& Scratch) const
 {
-	if (From == To) { return 0.0; }
+	if (From == To) { return true; }
+
+	auto HeapPredicate = [](const TPair<double, int32>& A, const TPair<double, int32>& B) { return A.Key < B.Key; };
+
+	TArray<double>& Dist = Scratch.Dist;
+	TArray<TPair<double, int32>>& PQ = Scratch.Heap;
 
-	const int32 NumPoints = Positions.Num();
-	TArray<double> Dist;
-	Dist.Init(MAX_dbl, NumPoints);
 	Dist[From] = 0.0;
+	Scratch.Touched.Add(From);
+	PQ.HeapPush({0.0, From}, HeapPredicate);
 
-	// Simple Dijkstra with priority queue
-	TArray<TPair<double, int32>> PQ;
-	PQ.HeapPush({0.0, From}, [](const auto& A, const auto& B) { return A.Key < B.Key; });
+	bool bFound = false;
 
 	while (PQ.Num() > 0)
 	{
 		TPair<double, int32> Current;
-		PQ.HeapPop(Current, [](const auto& A, const auto& B) { return A.Key < B.Key; });
+		PQ.HeapPop(Current, HeapPredicate, EAllowShrinking::No);
+
+		if (Current.Value == To)
+		{
+			bFound = true;
+			break;
+		}
 
-		if (Current.Value == To) { return Current.Key; }
 		if (Current.Key > Dist[Current.Value]) { continue; }
 
 		for (const int32 Neighbor : Adjacency[Current.Value])
 		{
-			const double EdgeDist = FVector::Dist(Positions[Current.Value], Positions[Neighbor]);
-			const double NewDist = Dist[Current.Value] + EdgeDist;
+			const double NewDist = Current.Key + FVector::Dist(Positions[Current.Value], Positions[Neighbor]);
 
-			if (NewDist < Dist[Neighbor])
-			{
-				Dist[Neighbor] = NewDist;
-				PQ.HeapPush({NewDist, Neighbor}, [](const auto& A, const auto& B) { return A.Key < B.Key; });
-			}
+			// Paths longer than the bound can't prevent the edge, don't explore them
+			if (NewDist > MaxDist || NewDist >= Dist[Neighbor]) { continue; }
+
+			if (Dist[Neighbor] == MAX_dbl) { Scratch.Touched.Add(Neighbor); }
+			Dist[Neighbor] = NewDist;
+			PQ.HeapPush({NewDist, Neighbor}, HeapPredicate);
 		}
 	}
 
-	return MAX_dbl; // Not reachable
+	// Sparse reset, only what this query touched
+	for (const int32 Index : Scratch.Touched) { Dist[Index] = MAX_dbl; }
+	Scratch.Touched.Reset();
+	PQ.Reset();
+
+	return bFound;
 }
 
-void FPCGExProbeSpanner::ProcessAll(TSet<uint64>& OutEdges) const
+void FPCGExProbeSpanner::GatherCandidates(TArray<uint64>& OutCandidates) const
 {
 	const TArray<FVector>& Positions = *WorkingPositions;
 	const int32 NumPoints = Positions.Num();
-	if (NumPoints < 2) { return; }
 
 	const TArray<int8>& CanGenerateRef = *CanGenerate;
 	const TArray<int8>& AcceptConnectionsRef = *AcceptConnections;
 
+	auto IsValidPair = [&](const int32 A, const int32 B)
+	{
+		return A != B && (CanGenerateRef[A] || CanGenerateRef[B]);
+	};
+
+	TArray<int32> Eligible;
+	Eligible.Reserve(NumPoints);
+	for (int32 i = 0; i < NumPoints; ++i) { if (CanGenerateRef[i] || AcceptConnectionsRef[i]) { Eligible.Add(i); } }
+
+	if (Config.Candidates == EPCGExSpannerCandidates::AllPairs)
+	{
+		OutCandidates.Reserve(static_cast<int32>(FMath::Min<int64>(Config.MaxEdgeCandidates, static_cast<int64>(Eligible.Num()) * (Eligible.Num() - 1) / 2)));
+
+		for (int32 i = 0; i < Eligible.Num() && OutCandidates.Num() < Config.MaxEdgeCandidates; ++i)
+		{
+			for (int32 j = i + 1; j < Eligible.Num() && OutCandidates.Num() < Config.MaxEdgeCandidates; ++j)
+			{
+				if (!IsValidPair(Eligible[i], Eligible[j])) { continue; }
+				OutCandidates.Add(PCGEx::H64U(Eligible[i], Eligible[j]));
+			}
+		}
+
+		return;
+	}
+
+	if (Config.Candidates == EPCGExSpannerCandidates::Delaunay)
+	{
+		GatherDelaunayCandidates(Eligible, OutCandidates);
+	}
+	else if (KDTree)
+	{
+		// Generators query connectable points; connectable-only points can only be reached by generators
+		const int32 K = FMath::Max(1, Config.CandidateK);
+
+		TArray<PCGExMT::FScope> Scopes;
+		const int32 NumScopes = PCGExMT::SubLoopScopes(Scopes, NumPoints, PCGEX_CORE_SETTINGS.GetPointsBatchChunkSize());
+
+		TArray<TArray<uint64>> ScopedCandidates;
+		ScopedCandidates.SetNum(NumScopes);
+
+		PCGEX_PARALLEL_FOR_THRESHOLD(
+			NumScopes, 2,
+
+			const PCGExMT::FScope& Scope = Scopes[i];
+			TArray<uint64>& LocalCandidates = ScopedCandidates[i];
+			TArray<PCGExKDTree::FNeighbor> Nearest;
+
+			PCGEX_SCOPE_LOOP(Index)
+			{
+				if (!CanGenerateRef[Index]) { continue; }
+
+				KDTree->FindKNearest(Positions[Index], K, Nearest, [Index](const int32 Other) { return Other != Index; });
+				for (const PCGExKDTree::FNeighbor& Neighbor : Nearest) { LocalCandidates.Add(PCGEx::H64U(Index, Neighbor.Index)); }
+			}
+		)
+
+		for (const TArray<uint64>& LocalCandidates : ScopedCandidates) { OutCandidates.Append(LocalCandidates); }
+	}
+
+	// Deduplicate & drop pairs that can't form an edge
+	OutCandidates.Sort();
+	int32 WriteIndex = 0;
+	for (int32 i = 0; i < OutCandidates.Num(); ++i)
+	{
+		const uint64 Candidate = OutCandidates[i];
+		if (WriteIndex > 0 && OutCandidates[WriteIndex - 1] == Candidate) { continue; }
+
+		uint32 A, B;
+		PCGEx::H64(Candidate, A, B);
+		if (!IsValidPair(A, B)) { continue; }
+
+		OutCandidates[WriteIndex++] = Candidate;
+	}
+
+	OutCandidates.SetNum(WriteIndex);
+}
+
+void FPCGExProbeSpanner::GatherDelaunayCandidates(const TArray<int32>& Eligible, TArray<uint64>& OutCandidates) const
+{
+	const TArray<FVector>& Positions = *WorkingPositions;
+
+	TArray<FVector> EligiblePositions;
+	EligiblePositions.SetNumUninitialized(Eligible.Num());
+	for (int32 i = 0; i < Eligible.Num(); ++i) { EligiblePositions[i] = Positions[Eligible[i]]; }
+
+	auto AppendEdges = [&](const TSet<uint64>& InEdges)
+	{
+		OutCandidates.Reserve(OutCandidates.Num() + InEdges.Num());
+		for (const uint64 Edge : InEdges)
+		{
+			uint32 A, B;
+			PCGEx::H64(Edge, A, B);
+			OutCandidates.Add(PCGEx::H64U(Eligible[A], Eligible[B]));
+		}
+	};
+
+	if (EligiblePositions.Num() == 2)
+	{
+		OutCandidates.Add(PCGEx::H64U(Eligible[0], Eligible[1]));
+		return;
+	}
+
+	{
+		const TUniquePtr<PCGExMath::Geo::TDelaunay3> Delaunay = MakeUnique<PCGExMath::Geo::TDelaunay3>();
+		if (Delaunay->Process<false, false>(EligiblePositions))
+		{
+			AppendEdges(Delaunay->DelaunayEdges);
+			return;
+		}
+	}
+
+	// Coplanar points; triangulate on their best-fit plane instead
+	FPCGExGeo2DProjectionDetails ProjectionDetails;
+	ProjectionDetails.Init(PCGExMath::FBestFitPlane(EligiblePositions));
+
+	const TUniquePtr<PCGExMath::Geo::TDelaunay2> Delaunay = MakeUnique<PCGExMath::Geo::TDelaunay2>();
+	if (Delaunay->Process(EligiblePositions, ProjectionDetails)) { AppendEdges(Delaunay->DelaunayEdges); }
+}
+
+void FPCGExProbeSpanner::ProcessAll(TArray<uint64>& OutEdges) const
+{
+	const TArray<FVector>& Positions = *WorkingPositions;
+	const int32 NumPoints = Positions.Num();
+	if (NumPoints < 2) { return; }
+
 	// Build sorted list of all candidate edges
 	struct FEdgeCandidate
 	{
@@ -68,40 +209,43 @@ void FPCGExProbeSpanner::ProcessAll(TSet<uint64>& OutEdges) const
 	};
 
 	TArray<FEdgeCandidate> Candidates;
-	Candidates.Reserve(FMath::Min(Config.MaxEdgeCandidates, NumPoints * (NumPoints - 1) / 2));
 
-	for (int32 i = 0; i < NumPoints && Candidates.Num() < Config.MaxEdgeCandidates; ++i)
 	{
-		if (!CanGenerateRef[i] && !AcceptConnectionsRef[i]) { continue; }
+		TArray<uint64> CandidateHashes;
+		GatherCandidates(CandidateHashes);
 
-		for (int32 j = i + 1; j < NumPoints && Candidates.Num() < Config.MaxEdgeCandidates; ++j)
-		{
-			if (!CanGenerateRef[j] && !AcceptConnectionsRef[j]) { continue; }
-			if (!CanGenerateRef[i] && !CanGenerateRef[j]) { continue; }
+		Candidates.SetNumUninitialized(CandidateHashes.Num());
+		PCGEX_PARALLEL_FOR(
+			CandidateHashes.Num(),
 
-			Candidates.Add({i, j, FVector::Dist(Positions[i], Positions[j])});
-		}
+			uint32 A, B;
+			PCGEx::H64(CandidateHashes[i], A, B);
+			Candidates[i] = FEdgeCandidate{static_cast<int32>(A), static_cast<int32>(B), FVector::Dist(Positions[A], Positions[B])};
+		)
 	}
 
 	// Sort by distance (greedy processes shortest first)
-	Algo::Sort(Candidates, [](const FEdgeCandidate& A, const FEdgeCandidate& B) { return A.Dist < B.Dist; });
+	Algo::Sort(Candidates, [](const FEdgeCandidate& A, const FEdgeCandidate& B)
+	{
+		if (A.Dist != B.Dist) { return A.Dist < B.Dist; }
+		return A.A < B.A || (A.A == B.A && A.B < B.B);
+	});
 
 	// Build adjacency list for path queries
-	TArray<TSet<int32>> Adjacency;
+	TArray<TArray<int32>> Adjacency;
 	Adjacency.SetNum(NumPoints);
 
+	FPathScratch Scratch(NumPoints);
+
 	// Greedy spanner construction
 	for (const FEdgeCandidate& Edge : Candidates)
 	{
 		// Check if current graph distance exceeds t * Euclidean distance
-		const double GraphDist = GetGraphDistance(Edge.A, Edge.B, Adjacency, Positions);
+		if (HasPathWithin(Edge.A, Edge.B, Config.StretchFactor * Edge.Dist, Adjacency, Positions, Scratch)) { continue; }
 
-		if (GraphDist > Config.StretchFactor * Edge.Dist)
-		{
-			// Add edge
-			OutEdges.Add(PCGEx::H64U(Edge.A, Edge.B));
-			Adjacency[Edge.A].Add(Edge.B);
-			Adjacency[Edge.B].Add(Edge.A);
-		}
+		// Add edge
+		OutEdges.Add(PCGEx::H64U(Edge.A, Edge.B));
+		Adjacency[Edge.A].Add(Edge.B);
+		Adjacency[Edge.B].Add(Edge.A);
 	}
 }
@@ -2,12 +2,14 @@
 // Released under the MIT license https://opensource.org/license/MIT/
 
 #include "Probes/PCGExGlobalProbeTheta.h"
+#include "Core/PCGExMTCommon.h"
 #include "Data/PCGExPointIO.h"
 
 PCGEX_CREATE_PROBE_FACTORY(Theta, {}, {})
 
 bool FPCGExProbeTheta::IsGlobalProbe() const { return true; }
 bool FPCGExProbeTheta::WantsOctree() const { return true; }
+bool FPCGExProbeTheta::SupportsScopedProcessing() const { return true; }
 
 bool FPCGExProbeTheta::Prepare(FPCGExContext* InContext)
 {
@@ -30,18 +32,20 @@ bool FPCGExProbeTheta::Prepare(FPCGExContext* InContext)
 	return true;
 }
 
-void FPCGExProbeTheta::ProcessAll(TSet<uint64>& OutEdges) const
+void FPCGExProbeTheta::ProcessScope(const int32 Pass, const PCGExMT::FScope& Scope, TArray<uint64>& OutEdges)
 {
 	const TArray<FVector>& Positions = *WorkingPositions;
-	const int32 NumPoints = Positions.Num();
-	if (NumPoints < 2) { return; }
 
 	const TArray<int8>& CanGenerateRef = *CanGenerate;
 	const TArray<int8>& AcceptConnectionsRef = *AcceptConnections;
 
 	const float CosConeHalf = FMath::Cos(ConeHalfAngle);
 
-	for (int32 i = 0; i < NumPoints; ++i)
+	// Track best candidate per cone
+	TArray<int32> BestPerCone;
+	TArray<double> BestDistPerCone;
+
+	PCGEX_SCOPE_LOOP(i)
 	{
 		if (!CanGenerateRef[i]) { continue; }
 
@@ -49,9 +53,6 @@ void FPCGExProbeTheta::ProcessAll(TSet<uint64>& OutEdges) const
 		const double MaxDistSq = GetSearchRadius(i);
 		const double MaxDist = FMath::Sqrt(MaxDistSq);
 
-		// Track best candidate per cone
-		TArray<int32> BestPerCone;
-		TArray<double> BestDistPerCone;
 		BestPerCone.Init(INDEX_NONE, Config.NumCones);
 		BestDistPerCone.Init(MAX_dbl, Config.NumCones);
 
@@ -18,7 +18,7 @@ bool FPCGExProbeAnisotropic::Prepare(FPCGExContext* InContext)
 	return true;
 }
 
-void FPCGExProbeAnisotropic::ProcessCandidates(const int32 Index, TArray<PCGExProbing::FCandidate>& Candidates, TSet<uint64>* Coincidence, const FVector& ST, TSet<uint64>* OutEdges, PCGExMT::FScopedContainer* Container)
+void FPCGExProbeAnisotropic::ProcessCandidates(const int32 Index, TArray<PCGExProbing::FCandidate>& Candidates, TSet<uint64>* Coincidence, const FVector& ST, TArray<uint64>* OutEdges, PCGExMT::FScopedContainer* Container)
 {
 	bool bIsAlreadyConnected;
 	const double R = GetSearchRadius(Index);
@@ -72,7 +72,7 @@ bool FPCGExProbeBitmasks::Prepare(FPCGExContext* InContext)
 
 #define PCGEX_GET_DIRECTION (Direction->Read(Index) * DirectionMultiplier).GetSafeNormal()
 
-void FPCGExProbeBitmasks::ProcessCandidates(const int32 Index, TArray<PCGExProbing::FCandidate>& Candidates, TSet<uint64>* Coincidence, const FVector& ST, TSet<uint64>* OutEdges, PCGExMT::FScopedContainer* Container)
+void FPCGExProbeBitmasks::ProcessCandidates(const int32 Index, TArray<PCGExProbing::FCandidate>& Candidates, TSet<uint64>* Coincidence, const FVector& ST, TArray<uint64>* OutEdges, PCGExMT::FScopedContainer* Container)
 {
 	const int32 DirCount = BitmaskData->Directions.Num();
 	if (DirCount == 0) { return; }
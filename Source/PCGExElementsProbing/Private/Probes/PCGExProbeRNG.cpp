@@ -17,7 +17,7 @@ bool FPCGExProbeRNG::Prepare(FPCGExContext* InContext)
 	return true;
 }
 
-void FPCGExProbeRNG::ProcessCandidates(const int32 Index, TArray<PCGExProbing::FCandidate>& Candidates, TSet<uint64>* Coincidence, const FVector& ST, TSet<uint64>* OutEdges, PCGExMT::FScopedContainer* Container)
+void FPCGExProbeRNG::ProcessCandidates(const int32 Index, TArray<PCGExProbing::FCandidate>& Candidates, TSet<uint64>* Coincidence, const FVector& ST, TArray<uint64>* OutEdges, PCGExMT::FScopedContainer* Container)
 {
 	const double R = GetSearchRadius(Index);
 	const TArray<FVector>& Positions = *WorkingPositions;
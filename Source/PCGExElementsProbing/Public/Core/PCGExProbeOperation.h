@@ -5,6 +5,7 @@
 
 #include "CoreMinimal.h"
 #include "PCGExOctree.h"
+#include "PCGExKDTree.h"
 #include "Data/PCGExDataHelpers.h"
 #include "Factories/PCGExOperation.h"
 #include "Details/PCGExSettingsMacros.h"
@@ -15,6 +16,7 @@
 
 namespace PCGExMT
 {
+	struct FScope;
 	class FScopedContainer;
 }
 
@@ -76,21 +78,39 @@ public:
 	virtual bool Prepare(FPCGExContext* InContext);
 	virtual bool IsDirectProbe() const;
 	virtual bool RequiresChainProcessing() const;
-	virtual void ProcessCandidates(const int32 Index, TArray<PCGExProbing::FCandidate>& Candidates, TSet<uint64>* Coincidence, const FVector& ST, TSet<uint64>* OutEdges, PCGExMT::FScopedContainer* Container);
+	virtual void ProcessCandidates(const int32 Index, TArray<PCGExProbing::FCandidate>& Candidates, TSet<uint64>* Coincidence, const FVector& ST, TArray<uint64>* OutEdges, PCGExMT::FScopedContainer* Container);
 
 	virtual bool IsGlobalProbe() const;
 	virtual bool WantsOctree() const;
+	virtual bool WantsKDTree() const;
 
 	virtual void PrepareBestCandidate(const int32 Index, PCGExProbing::FBestCandidate& InBestCandidate, PCGExMT::FScopedContainer* Container);
 	virtual void ProcessCandidateChained(const int32 Index, const int32 CandidateIndex, PCGExProbing::FCandidate& Candidate, PCGExProbing::FBestCandidate& InBestCandidate, PCGExMT::FScopedContainer* Container);
-	virtual void ProcessBestCandidate(const int32 Index, PCGExProbing::FBestCandidate& InBestCandidate, TArray<PCGExProbing::FCandidate>& Candidates, TSet<uint64>* Coincidence, const FVector& ST, TSet<uint64>* OutEdges, PCGExMT::FScopedContainer* Container);
+	virtual void ProcessBestCandidate(const int32 Index, PCGExProbing::FBestCandidate& InBestCandidate, TArray<PCGExProbing::FCandidate>& Candidates, TSet<uint64>* Coincidence, const FVector& ST, TArray<uint64>* OutEdges, PCGExMT::FScopedContainer* Container);
 
-	virtual void ProcessNode(const int32 Index, TSet<uint64>* Coincidence, const FVector& ST, TSet<uint64>* OutEdges, PCGExMT::FScopedContainer* Container);
+	virtual void ProcessNode(const int32 Index, TSet<uint64>* Coincidence, const FVector& ST, TArray<uint64>* OutEdges, PCGExMT::FScopedContainer* Container);
 
-	virtual void ProcessAll(TSet<uint64>& OutEdges) const;
+	/** Emitted edges don't need to be unique; Connect Points sorts & dedupes all edges once, before inserting them in the graph. */
+	virtual void ProcessAll(TArray<uint64>& OutEdges) const;
+
+	/** Whether this global probe processes point scopes in parallel instead of a single ProcessAll call. */
+	virtual bool SupportsScopedProcessing() const;
+
+	/**
+	 * Called once before scoped processing starts.
+	 * @return Number of sequential passes over all point scopes. Scopes of a single pass run in parallel.
+	 */
+	virtual int32 PrepareScopedProcessing();
+
+	/** Process a range of points for a given pass, writing edges to a list owned by that scope. */
+	virtual void ProcessScope(const int32 Pass, const PCGExMT::FScope& Scope, TArray<uint64>& OutEdges);
+
+	/** Called once all passes are complete. */
+	virtual void CompleteScopedProcessing();
 
 	FPCGExProbeConfigBase* BaseConfig = nullptr;
 	const PCGExOctree::FItemOctree* Octree = nullptr;
+	const PCGExKDTree::FKDTree* KDTree = nullptr; // Built over points that accept connections
 	const TArray<FTransform>* WorkingTransforms = nullptr;
 	const TArray<FVector>* WorkingPositions = nullptr;
 	const TArray<int8>* CanGenerate = nullptr;
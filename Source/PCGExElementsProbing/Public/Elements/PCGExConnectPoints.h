@@ -5,6 +5,7 @@
 
 #include "CoreMinimal.h"
 #include "PCGExOctree.h"
+#include "PCGExKDTree.h"
 #include "Clusters/PCGExClusterCommon.h"
 #include "Core/PCGExPointsProcessor.h"
 #include "Graphs/PCGExGraphDetails.h"
@@ -110,6 +111,7 @@ namespace PCGExConnectPoints
 		TArray<FPCGExProbeOperation*> ChainedOperations;
 		TArray<FPCGExProbeOperation*> SharedOperations;
 		TArray<FPCGExProbeOperation*> GlobalOperations;
+		TArray<FPCGExProbeOperation*> ScopedGlobalOperations;
 
 		int32 NumRadiusSources = 0;
 		int32 NumDirectOps = 0;
@@ -119,8 +121,9 @@ namespace PCGExConnectPoints
 
 		bool bOnlyGlobalOps = false;
 		bool bWantsOctree = false;
+		bool bWantsKDTree = false;
 
-		int8 NumCompletions = 2;
+		int32 NumCompletions = 0;
 
 		bool bUseVariableRadius = false;
 		double SharedSearchRadius = 0;
@@ -128,13 +131,14 @@ namespace PCGExConnectPoints
 		TArray<int8> CanGenerate;
 		TArray<int8> AcceptConnections;
 		TUniquePtr<PCGExOctree::FItemOctree> Octree;
+		TSharedPtr<PCGExKDTree::FKDTree> KDTree;
 
 		TArray<FTransform> WorkingTransforms;
 		TArray<FVector> WorkingPositions;
 
-		mutable FRWLock UniqueEdgesLock;
-		TSharedPtr<PCGExMT::TScopedSet<uint64>> ScopedEdges;
-		TSet<uint64> UniqueEdges;
+		mutable FRWLock EdgeBatchesLock;
+		TSharedPtr<PCGExMT::TScopedArray<uint64>> ScopedEdges;
+		TArray<TArray<uint64>> EdgeBatches;
 
 		FPCGExGeo2DProjectionDetails ProjectionDetails;
 
@@ -150,10 +154,11 @@ namespace PCGExConnectPoints
 
 		virtual ~FProcessor() override;
 
-		void AppendEdges(const TSet<uint64>& InUniqueEdges);
+		void AppendEdges(TArray<uint64>&& InEdges);
 
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InTaskManager) override;
 		void OnPreparationComplete();
+		void StartScopedGlobalPass(FPCGExProbeOperation* Operation, const int32 Pass, const int32 NumPasses);
 		virtual void PrepareLoopScopesForPoints(const TArray<PCGExMT::FScope>& Loops) override;
 		virtual void ProcessPoints(const PCGExMT::FScope& Scope) override;
 		virtual void OnPointsProcessingComplete() override;
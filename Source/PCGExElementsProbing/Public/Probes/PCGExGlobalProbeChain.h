@@ -50,7 +50,7 @@ class FPCGExProbeChain : public FPCGExProbeOperation
 public:
 	virtual bool IsGlobalProbe() const override;
 	virtual bool Prepare(FPCGExContext* InContext) override;
-	virtual void ProcessAll(TSet<uint64>& OutEdges) const override;
+	virtual void ProcessAll(TArray<uint64>& OutEdges) const override;
 
 	FPCGExProbeConfigChain Config;
 	TSharedPtr<PCGExData::TBuffer<double>> SortBuffer;
@@ -61,7 +61,7 @@ public:
 	virtual bool WantsOctree() const override;
 
 	virtual bool Prepare(FPCGExContext* InContext) override;
-	virtual void ProcessAll(TSet<uint64>& OutEdges) const override;
+	virtual void ProcessAll(TArray<uint64>& OutEdges) const override;
 
 	FPCGExProbeConfigGradientFlow Config;
 	TSharedPtr<PCGExData::TBuffer<double>> FlowBuffer;
@@ -58,16 +58,24 @@ class FPCGExProbeHubSpoke : public FPCGExProbeOperation
 public:
 	virtual bool IsGlobalProbe() const override;
 	virtual bool Prepare(FPCGExContext* InContext) override;
-	virtual void ProcessAll(TSet<uint64>& OutEdges) const override;
+
+	virtual bool SupportsScopedProcessing() const override;
+	virtual int32 PrepareScopedProcessing() override;
+	virtual void ProcessScope(const int32 Pass, const PCGExMT::FScope& Scope, TArray<uint64>& OutEdges) override;
+	virtual void CompleteScopedProcessing() override;
 
 	FPCGExProbeConfigHubSpoke Config;
 	TSharedPtr<PCGExData::TBuffer<double>> HubAttributeBuffer;
 
 protected:
-	void SelectHubsByDensity(TArray<int32>& OutHubs) const;
+	TArray<int32> Hubs;
+	TArray<int32> HubOrder; // Per point, index in Hubs or -1 if not a hub
+	PCGExKDTree::FKDTree HubsTree;
+
+	void SelectHubsByDensity(const PCGExKDTree::FKDTree& PointsTree, TArray<int32>& OutHubs) const;
 	void SelectHubsByAttribute(TArray<int32>& OutHubs) const;
-	void SelectHubsByCentrality(TArray<int32>& OutHubs) const;
-	void SelectHubsByKMeans(TArray<int32>& OutHubs) const;
+	void SelectHubsByCentrality(const PCGExKDTree::FKDTree& PointsTree, TArray<int32>& OutHubs) const;
+	void SelectHubsByKMeans(const PCGExKDTree::FKDTree& PointsTree, TArray<int32>& OutHubs) const;
 };
 
 // Factory classes...
@@ -51,12 +51,24 @@ class FPCGExProbeKNN : public FPCGExProbeOperation
 {
 public:
 	virtual bool IsGlobalProbe() const override;
+	virtual bool WantsKDTree() const override;
 
 	virtual bool Prepare(FPCGExContext* InContext) override;
-	virtual void ProcessAll(TSet<uint64>& OutEdges) const override;
+
+	virtual bool SupportsScopedProcessing() const override;
+	virtual int32 PrepareScopedProcessing() override;
+	virtual void ProcessScope(const int32 Pass, const PCGExMT::FScope& Scope, TArray<uint64>& OutEdges) override;
+	virtual void CompleteScopedProcessing() override;
 
 	FPCGExProbeConfigKNN Config;
 	TSharedPtr<PCGExDetails::TSettingValue<int32>> K;
+
+protected:
+	bool bMutual = false;
+
+	// Flat neighbor storage : neighbors of point i live in [Offsets[i], Offsets[i+1])
+	TArray<int32> Offsets;
+	TArray<int32> Neighbors;
 };
 
 ////
@@ -43,7 +43,7 @@ public:
 	virtual bool IsGlobalProbe() const override;
 	virtual bool WantsOctree() const override;
 	virtual bool Prepare(FPCGExContext* InContext) override;
-	virtual void ProcessAll(TSet<uint64>& OutEdges) const override;
+	virtual void ProcessAll(TArray<uint64>& OutEdges) const override;
 
 	FPCGExProbeConfigLevelSet Config;
 	TSharedPtr<PCGExData::TBuffer<double>> LevelBuffer;
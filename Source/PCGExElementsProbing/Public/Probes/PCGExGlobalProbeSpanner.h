@@ -9,6 +9,14 @@
 
 #include "PCGExGlobalProbeSpanner.generated.h"
 
+UENUM()
+enum class EPCGExSpannerCandidates : uint8
+{
+	AllPairs = 0 UMETA(DisplayName = "All Pairs", ToolTip="Consider every pair of points, up to Max Edge Candidates. Exact greedy spanner on small inputs, truncated on large ones."),
+	Delaunay = 1 UMETA(DisplayName = "Delaunay", ToolTip="Only consider Delaunay edges. Falls back to a best-fit 2D triangulation when points are coplanar."),
+	KNearest = 2 UMETA(DisplayName = "K-Nearest", ToolTip="Only consider edges to each point's K nearest neighbors."),
+};
+
 USTRUCT(BlueprintType)
 struct FPCGExProbeConfigSpanner : public FPCGExProbeConfigBase
 {
@@ -23,24 +31,45 @@ struct FPCGExProbeConfigSpanner : public FPCGExProbeConfigBase
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Settings, meta=(PCG_Overridable, ClampMin="1.0", ClampMax="10.0"))
 	double StretchFactor = 2.0;
 
+	/** Which edges are considered by the greedy pass. Delaunay and K-Nearest scale to large inputs. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Settings, meta=(PCG_Overridable))
+	EPCGExSpannerCandidates Candidates = EPCGExSpannerCandidates::AllPairs;
+
 	/** Max edges to consider (performance limit) */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Settings, meta=(PCG_Overridable, ClampMin="100"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Settings, meta=(PCG_Overridable, ClampMin="100", EditCondition="Candidates == EPCGExSpannerCandidates::AllPairs", EditConditionHides))
 	int32 MaxEdgeCandidates = 50000;
+
+	/** Number of nearest neighbors each point contributes as candidates */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Settings, meta=(PCG_Overridable, ClampMin="1", EditCondition="Candidates == EPCGExSpannerCandidates::KNearest", EditConditionHides))
+	int32 CandidateK = 12;
 };
 
 class FPCGExProbeSpanner : public FPCGExProbeOperation
 {
 public:
 	virtual bool IsGlobalProbe() const override;
+	virtual bool WantsKDTree() const override;
 	virtual bool Prepare(FPCGExContext* InContext) override;
-	virtual void ProcessAll(TSet<uint64>& OutEdges) const override;
+	virtual void ProcessAll(TArray<uint64>& OutEdges) const override;
 
 	FPCGExProbeConfigSpanner Config;
 
 protected:
-	// Dijkstra helper - returns shortest path distance between two nodes in current graph
-	double GetGraphDistance(int32 From, int32 To, const TArray<TSet<int32>>& Adjacency,
-	                        const TArray<FVector>& Positions) const;
+	// Dijkstra scratch buffers, reused across candidate checks
+	struct FPathScratch
+	{
+		TArray<double> Dist;
+		TArray<int32> Touched;
+		TArray<TPair<double, int32>> Heap;
+
+		explicit FPathScratch(const int32 NumNodes) { Dist.Init(MAX_dbl, NumNodes); }
+	};
+
+	void GatherCandidates(TArray<uint64>& OutCandidates) const;
+	void GatherDelaunayCandidates(const TArray<int32>& Eligible, TArray<uint64>& OutCandidates) const;
+
+	// Bounded Dijkstra - returns true if there is a path between From and To no longer than MaxDist in current graph
+	bool HasPathWithin(const int32 From, const int32 To, const double MaxDist, const TArray<TArray<int32>>& Adjacency, const TArray<FVector>& Positions, FPathScratch& Scratch) const;
 };
 
 // Factory classes...
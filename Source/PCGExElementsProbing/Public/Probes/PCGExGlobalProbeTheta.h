@@ -38,7 +38,9 @@ public:
 	virtual bool IsGlobalProbe() const override;
 	virtual bool WantsOctree() const override;
 	virtual bool Prepare(FPCGExContext* InContext) override;
-	virtual void ProcessAll(TSet<uint64>& OutEdges) const override;
+
+	virtual bool SupportsScopedProcessing() const override;
+	virtual void ProcessScope(const int32 Pass, const PCGExMT::FScope& Scope, TArray<uint64>& OutEdges) override;
 
 	FPCGExProbeConfigTheta Config;
 
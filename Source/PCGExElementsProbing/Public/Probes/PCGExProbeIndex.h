@@ -66,7 +66,7 @@ public:
 	virtual bool IsDirectProbe() const override;
 	virtual bool Prepare(FPCGExContext* InContext) override;
 
-	virtual void ProcessNode(const int32 Index, TSet<uint64>* Coincidence, const FVector& ST, TSet<uint64>* OutEdges, PCGExMT::FScopedContainer* Container) override
+	virtual void ProcessNode(const int32 Index, TSet<uint64>* Coincidence, const FVector& ST, TArray<uint64>* OutEdges, PCGExMT::FScopedContainer* Container) override
 	{
 		TryCreateEdge(Index, OutEdges, *AcceptConnections);
 	}
@@ -74,7 +74,7 @@ public:
 	FPCGExProbeConfigIndex Config;
 	TSharedPtr<PCGExDetails::TSettingValue<int32>> TargetCache;
 
-	using TryCreateEdgeCallback = std::function<void(const int32, TSet<uint64>*, const TArray<int8>&)>;
+	using TryCreateEdgeCallback = std::function<void(const int32, TArray<uint64>*, const TArray<int8>&)>;
 	TryCreateEdgeCallback TryCreateEdge;
 
 protected:
@@ -394,6 +394,11 @@ namespace PCGExSampleNearestPath
 		const TSharedPtr<PCGExSampling::FSampingUnionData> Union = MakeShared<PCGExSampling::FSampingUnionData>();
 		Union->Reserve(Context->TargetsHandler->Num());
 
+		TArray<double> RangeMinScratch;
+		TArray<double> RangeMaxScratch;
+		const TConstArrayView<double> RangeMins = RangeMinGetter->ReadSpan(Scope, RangeMinScratch);
+		const TConstArrayView<double> RangeMaxs = RangeMaxGetter->ReadSpan(Scope, RangeMaxScratch);
+
 		PCGEX_SCOPE_LOOP(Index)
 		{
 			Union->Reset();
@@ -409,8 +414,8 @@ namespace PCGExSampleNearestPath
 
 			bool bSampledClosedLoop = false;
 
-			double RangeMin = RangeMinGetter->Read(Index);
-			double RangeMax = RangeMaxGetter->Read(Index);
+			double RangeMin = RangeMins[Index - Scope.Start];
+			double RangeMax = RangeMaxs[Index - Scope.Start];
 
 			if (RangeMin > RangeMax) { std::swap(RangeMin, RangeMax); }
 
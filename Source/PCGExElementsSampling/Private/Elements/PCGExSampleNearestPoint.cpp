@@ -366,6 +366,11 @@ namespace PCGExSampleNearestPoint
 		const bool bProcessFilteredOutAsFails = Settings->bProcessFilteredOutAsFails;
 		const double DefaultDet = Settings->SampleMethod == EPCGExSampleMethod::ClosestTarget ? MAX_dbl : MIN_dbl;
 
+		TArray<double> RangeMinScratch;
+		TArray<double> RangeMaxScratch;
+		const TConstArrayView<double> RangeMins = RangeMinGetter->ReadSpan(Scope, RangeMinScratch);
+		const TConstArrayView<double> RangeMaxs = RangeMaxGetter->ReadSpan(Scope, RangeMaxScratch);
+
 		PCGEX_SCOPE_LOOP(Index)
 		{
 			if (!PointFilterCache[Index])
@@ -374,8 +379,8 @@ namespace PCGExSampleNearestPoint
 				continue;
 			}
 
-			double RangeMin = FMath::Square(RangeMinGetter->Read(Index));
-			double RangeMax = FMath::Square(RangeMaxGetter->Read(Index));
+			double RangeMin = FMath::Square(RangeMins[Index - Scope.Start]);
+			double RangeMax = FMath::Square(RangeMaxs[Index - Scope.Start]);
 
 			if (RangeMin > RangeMax) { std::swap(RangeMin, RangeMax); }
 
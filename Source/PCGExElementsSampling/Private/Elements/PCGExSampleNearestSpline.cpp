@@ -9,6 +9,7 @@
 #include "Data/PCGExPointIO.h"
 #include "Details/PCGExSettingsDetails.h"
 #include "Math/PCGExMathDistances.h"
+#include "Paths/PCGExSplineSegmentBVH.h"
 #include "Sampling/PCGExSamplingHelpers.h"
 #include "Types/PCGExTypes.h"
 
@@ -133,6 +134,17 @@ bool FPCGExSampleNearestSplineElement::Boot(FPCGExContext* InContext) const
 	Context->Splines.Reserve(Context->NumTargets);
 	for (const UPCGSplineData* SplineData : Context->Targets) { Context->Splines.Add(SplineData->SplineStruct); }
 
+	if (!Settings->bSampleSpecificAlpha)
+	{
+		// Built once and shared by all processors; closest key queries are otherwise a full search over every spline segment
+		Context->SplineBVHs.SetNum(Context->NumTargets);
+		PCGEX_PARALLEL_FOR_THRESHOLD(
+			Context->NumTargets, 2,
+			Context->SplineBVHs[i] = MakeShared<PCGExPaths::FSplineSegmentBVH>();
+			Context->SplineBVHs[i]->Build(Context->Splines[i]);
+		)
+	}
+
 	TArray<FBox> SplineBounds;
 
 	SplineBounds.Reserve(Context->NumTargets);
@@ -318,6 +330,11 @@ namespace PCGExSampleNearestSpline
 
 		const PCGExMath::IDistances* Distances = PCGExMath::GetDistances(Settings->DistanceSettings, Settings->DistanceSettings);
 
+		TArray<double> RangeMinScratch;
+		TArray<double> RangeMaxScratch;
+		const TConstArrayView<double> RangeMins = RangeMinGetter->ReadSpan(Scope, RangeMinScratch);
+		const TConstArrayView<double> RangeMaxs = RangeMaxGetter->ReadSpan(Scope, RangeMaxScratch);
+
 		PCGEX_SCOPE_LOOP(Index)
 		{
 			if (!PointFilterCache[Index])
@@ -332,8 +349,8 @@ namespace PCGExSampleNearestSpline
 
 			bool bSampledClosedLoop = false;
 
-			double BaseRangeMin = RangeMinGetter->Read(Index);
-			double BaseRangeMax = RangeMaxGetter->Read(Index);
+			double BaseRangeMin = RangeMins[Index - Scope.Start];
+			double BaseRangeMax = RangeMaxs[Index - Scope.Start];
 			if (BaseRangeMin > BaseRangeMax) { std::swap(BaseRangeMin, BaseRangeMax); }
 
 			double MinSampledRange = BaseRangeMin;
@@ -446,7 +463,8 @@ namespace PCGExSampleNearestSpline
 				auto ProcessClosestAlpha = [&](const int32 TargetIndex)
 				{
 					const FPCGSplineStruct& Line = Context->Splines[TargetIndex];
-					const double Time = Line.FindInputKeyClosestToWorldLocation(Origin);
+					const PCGExPaths::FSplineSegmentBVH* BVH = Context->SplineBVHs[TargetIndex].Get();
+					const double Time = BVH->IsValid() ? BVH->FindClosestKey(Origin) : Line.FindInputKeyClosestToWorldLocation(Origin);
 					ProcessTarget(Line.GetTransformAtSplineInputKey
 					              (static_cast<float>(Time), ESplineCoordinateSpace::World, Settings->bSplineScalesRanges),
 					              Time, Context->SegmentCounts[TargetIndex], Line);
@@ -232,9 +232,12 @@ namespace PCGExSampleNearestSurface
 		};
 
 
+		TArray<double> DistanceScratch;
+		const TConstArrayView<double> MaxDistances = DistanceGetter->ReadSpan(Scope, DistanceScratch);
+
 		PCGEX_SCOPE_LOOP(Index)
 		{
-			const double MaxDistance = DistanceGetter->Read(Index);
+			const double MaxDistance = MaxDistances[Index - Scope.Start];
 
 			if (!PointFilterCache[Index])
 			{
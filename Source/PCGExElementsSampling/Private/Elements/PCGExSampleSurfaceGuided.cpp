@@ -350,11 +350,19 @@ namespace PCGExSampleSurfaceGuided
 
 		double DirMult = Settings->bInvertDirection ? -1 : 1;
 
+		TArray<FVector> DirectionScratch;
+		TArray<FVector> OriginScratch;
+		TArray<double> DistanceScratch;
+		const TConstArrayView<FVector> Directions = DirectionGetter->ReadSpan(Scope, DirectionScratch);
+		const TConstArrayView<FVector> Origins = OriginGetter->ReadSpan(Scope, OriginScratch);
+		const TConstArrayView<double> MaxDistances = DistanceGetter->ReadSpan(Scope, DistanceScratch);
+
 		PCGEX_SCOPE_LOOP(Index)
 		{
-			const FVector Direction = DirectionGetter->Read(Index).GetSafeNormal() * DirMult;
-			const FVector Origin = OriginGetter->Read(Index);
-			const double MaxDistance = DistanceGetter->Read(Index);
+			const int32 i = Index - Scope.Start;
+			const FVector Direction = Directions[i].GetSafeNormal() * DirMult;
+			const FVector Origin = Origins[i];
+			const double MaxDistance = MaxDistances[i];
 
 			PCGExData::FMutablePoint MutablePoint = PointDataFacade->GetOutPoint(Index);
 
@@ -131,7 +131,7 @@ namespace PCGExSelfPruning
 			{
 				if (TSharedPtr<PCGExSorting::FSortCache> Cache = Sorter->BuildCache(NumPoints))
 				{
-					Order.Sort([&](const int32 A, const int32 B) { return Cache->Compare(A, B); });
+					Cache->SortIndices(Order);
 				}
 				else
 				{
@@ -177,13 +177,20 @@ namespace PCGExSelfPruning
 		}
 
 		// Build BoxSecondary (world AABBs for octree pre-filtering)
+		TArray<double> ExpansionScratch;
 		switch (Settings->SecondaryMode)
 		{
 		case EPCGExSelfPruningExpandOrder::Before:
-			PCGEX_SCOPE_LOOP(Index) { BoxSecondary[Index] = InData->GetLocalBounds(Index).ExpandBy(SecondaryExpansion->Read(Index)).TransformBy(Transforms[Index]); }
+			{
+				const TConstArrayView<double> Expansions = SecondaryExpansion->ReadSpan(Scope, ExpansionScratch);
+				PCGEX_SCOPE_LOOP(Index) { BoxSecondary[Index] = InData->GetLocalBounds(Index).ExpandBy(Expansions[Index - Scope.Start]).TransformBy(Transforms[Index]); }
+			}
 			break;
 		case EPCGExSelfPruningExpandOrder::After:
-			PCGEX_SCOPE_LOOP(Index) { BoxSecondary[Index] = InData->GetLocalBounds(Index).TransformBy(Transforms[Index]).ExpandBy(SecondaryExpansion->Read(Index)); }
+			{
+				const TConstArrayView<double> Expansions = SecondaryExpansion->ReadSpan(Scope, ExpansionScratch);
+				PCGEX_SCOPE_LOOP(Index) { BoxSecondary[Index] = InData->GetLocalBounds(Index).TransformBy(Transforms[Index]).ExpandBy(Expansions[Index - Scope.Start]); }
+			}
 			break;
 		default:
 		case EPCGExSelfPruningExpandOrder::None:
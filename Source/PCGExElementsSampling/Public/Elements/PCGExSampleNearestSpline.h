@@ -21,6 +21,11 @@
 
 #include "PCGExSampleNearestSpline.generated.h"
 
+namespace PCGExPaths
+{
+	class FSplineSegmentBVH;
+}
+
 #define PCGEX_FOREACH_FIELD_NEARESTPOLYLINE(MACRO)\
 MACRO(Success, bool, false)\
 MACRO(Transform, FTransform, FTransform::Identity)\
@@ -468,6 +473,7 @@ struct FPCGExSampleNearestSplineContext final : FPCGExPointsProcessorContext
 
 	TArray<const UPCGSplineData*> Targets;
 	TArray<FPCGSplineStruct> Splines;
+	TArray<TSharedPtr<PCGExPaths::FSplineSegmentBVH>> SplineBVHs; // Closest key lookups, one per spline
 	TArray<double> SegmentCounts;
 	TArray<double> Lengths;
 
@@ -1098,7 +1098,7 @@ namespace PCGExBinPacking3D
 		{
 			if (TSharedPtr<PCGExSorting::FSortCache> Cache = Sorter->BuildCache(NumPoints))
 			{
-				ProcessingOrder.Sort([&](const int32 A, const int32 B) { return Cache->Compare(A, B); });
+				Cache->SortIndices(ProcessingOrder);
 			}
 			else
 			{
@@ -103,7 +103,8 @@ namespace PCGExFusePoints
 
 		PointDataFacade->CreateReadables(SourceAttributes);
 
-		bForceSingleThreadedProcessPoints = true; // Sequential insertion for deterministic node ordering
+		// Sequential insertion for deterministic node ordering; deferred insertion is sorted on resolve
+		bForceSingleThreadedProcessPoints = !UnionGraph->IsDeferred();
 		StartParallelLoopForPoints(PCGExData::EIOSide::In);
 
 		return true;
@@ -132,7 +133,7 @@ namespace PCGExFusePoints
 		for (int i = 0; i < Scope.Count; ++i)
 		{
 			const int32 Idx = Scope.Start + i;
-			ReadIndices[i] = UnionGraph->Nodes[Idx]->Point.Index;
+			ReadIndices[i] = UnionGraph->Nodes.Seeds[Idx].Index;
 			WriteIndices[i] = Idx;
 		}
 
@@ -148,7 +149,7 @@ namespace PCGExFusePoints
 
 		PCGEX_SCOPE_LOOP(Index)
 		{
-			const FVector Center = UnionGraph->Nodes[Index]->GetCenter();
+			const FVector Center = UnionGraph->Nodes.GetCenter(Index);
 
 			if (bUpdateCenter) { Transforms[Index].SetLocation(Center); }
 
@@ -248,6 +249,8 @@ namespace PCGExFusePoints
 
 	void FProcessor::CompleteWork()
 	{
+		UnionGraph->ResolvePending();
+
 		const int32 NumUnionNodes = UnionGraph->Nodes.Num();
 
 		UPCGBasePointData* OutData = PointDataFacade->GetOut();
@@ -266,7 +269,7 @@ namespace PCGExFusePoints
 			PCGEX_PARALLEL_FOR(
 				NumUnionNodes,
 
-				const FVector Center = UnionGraph->Nodes[i]->GetCenter();
+				const FVector Center = UnionGraph->Nodes.GetCenter(i);
 				double BestDist = MAX_dbl;
 				int32 BestIndex = -1;
 
@@ -280,7 +283,7 @@ namespace PCGExFusePoints
 					}
 					});
 
-				if (BestIndex == -1) { BestIndex = UnionGraph->Nodes[i]->Point.Index; }
+				if (BestIndex == -1) { BestIndex = UnionGraph->Nodes.Seeds[i].Index; }
 				IdxMapping[i] = BestIndex;
 			);
 
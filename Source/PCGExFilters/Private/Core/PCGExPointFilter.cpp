@@ -8,6 +8,8 @@
 #include "Data/PCGExPointIO.h"
 #include "Clusters/PCGExCluster.h"
 #include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Misc/ScopeRWLock.h"
 
 PCG_DEFINE_TYPE_INFO(FPCGExDataTypeInfoFilter, UPCGExFilterFactoryData)
 PCG_DEFINE_TYPE_INFO(FPCGExDataTypeInfoFilterPoint, UPCGExPointFilterFactoryData)
@@ -41,6 +43,26 @@ bool UPCGExFilterFactoryData::Init(FPCGExContext* InContext)
 
 namespace PCGExPointFilter
 {
+	namespace
+	{
+		// Upper bound on items per column-at-a-time batch; selection vector lives on the stack
+		constexpr int32 MaxBatchSize = 1024;
+
+		// Lower bound, below which per-batch overhead outweighs the column pass
+		constexpr int32 MinBatchSize = 64;
+
+		// Split the scope so every worker gets a few batches, instead of running mid-sized scopes on a single thread
+		int32 GetBatchSize(const int32 Count, const bool bParallel)
+		{
+			if (!bParallel) { return MaxBatchSize; }
+			const int32 NumWorkers = FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads());
+			return FMath::Clamp(FMath::DivideAndRoundUp(Count, NumWorkers * 4), MinBatchSize, MaxBatchSize);
+		}
+
+		// Number of evaluated batches between two re-rankings of the filter order
+		constexpr int32 ReorderInterval = 8;
+	}
+
 	bool IFilter::Init(FPCGExContext* InContext, const TSharedPtr<PCGExData::FFacade>& InPointDataFacade)
 	{
 		PointDataFacade = InPointDataFacade;
@@ -63,6 +85,11 @@ namespace PCGExPointFilter
 
 	bool IFilter::Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const { return bCollectionTestResult; }
 
+	int32 IFilter::TestSelection(const PCGExMT::FScope& Scope, const TArrayView<int32> InOutSelection) const
+	{
+		return CompactSelection(InOutSelection, [&](const int32 Index) { return Test(Index); });
+	}
+
 	bool ISimpleFilter::Test(const int32 Index) const PCGEX_NOT_IMPLEMENTED_RET(FSimpleFilter::Test(const PCGExClusters::FNode& Node), false)
 
 	bool ISimpleFilter::Test(const PCGExData::FProxyPoint& Point) const PCGEX_NOT_IMPLEMENTED_RET(FSimpleFilter::TestRoamingPoint(const PCGExClusters::PCGExData::FProxyPoint& Point), false)
@@ -89,6 +116,11 @@ namespace PCGExPointFilter
 
 	bool ICollectionFilter::Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const PCGEX_NOT_IMPLEMENTED_RET(FCollectionFilter::Test(FPCGExContext* InContext, const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection), false)
 
+	int32 ICollectionFilter::TestSelection(const PCGExMT::FScope& Scope, const TArrayView<int32> InOutSelection) const
+	{
+		return bCollectionTestResult ? InOutSelection.Num() : 0;
+	}
+
 	FManager::FManager(const TSharedRef<PCGExData::FFacade>& InPointDataFacade)
 		: PointDataFacade(InPointDataFacade)
 	{
@@ -209,138 +241,164 @@ namespace PCGExPointFilter
 		return true;
 	}
 
-#define PCGEX_TEST_STACK(_ITEM, _INDEX) bool bResult = true; for (const IFilter* Filter : Stack){if (!Filter->Test(_ITEM)){ bResult = false; break; }} OutResults[_INDEX] = bResult;
-
-	int32 FManager::Test(const PCGExMT::FScope Scope, TArray<int8>& OutResults, const bool bParallel)
+	template <typename FilterFunc, typename WriteFunc>
+	int32 FManager::TestBatched(const PCGExMT::FScope& Scope, const bool bParallel, FilterFunc&& TestFilter, WriteFunc&& Write)
 	{
+		const int32 BatchSize = GetBatchSize(Scope.Count, bParallel);
+		const int32 NumBatchesInScope = FMath::DivideAndRoundUp(FMath::Max(0, Scope.Count), BatchSize);
 		int32 NumPass = 0;
 
-		if (bParallel)
+		auto TestBatch = [&](const int32 BatchIndex)
 		{
-			ParallelFor(Scope.Count, [&](const int32 i)
+			const int32 Start = Scope.Start + BatchIndex * BatchSize;
+			const PCGExMT::FScope Batch(Start, FMath::Min(BatchSize, Scope.End - Start));
+
+			TArray<int32, TInlineAllocator<MaxBatchSize>> Selection;
+			Selection.SetNumUninitialized(Batch.Count);
+			for (int32 i = 0; i < Batch.Count; i++) { Selection[i] = Batch.Start + i; }
+
+			TArray<int32, TInlineAllocator<16>> LocalOrder;
+			GetOrder(LocalOrder);
+
+			int32 NumSelected = Batch.Count;
+			for (const int32 StackIndex : LocalOrder)
 			{
-				const int32 Index = Scope.Start + i;
-				PCGEX_TEST_STACK(Index, Index)
-				if (bResult) { FPlatformAtomics::InterlockedIncrement(&NumPass); }
-			});
-		}
-		else
-		{
-			PCGEX_SCOPE_LOOP(Index)
+				const uint64 StartCycles = FPlatformTime::Cycles64();
+				const int32 NumPassed = TestFilter(Stack[StackIndex], Batch, TArrayView<int32>(Selection.GetData(), NumSelected));
+				RecordBatch(StackIndex, NumSelected, NumPassed, FPlatformTime::Cycles64() - StartCycles);
+
+				NumSelected = NumPassed;
+				if (!NumSelected) { break; }
+			}
+
+			// Selection is still sorted, merge it against the batch range
+			int32 Cursor = 0;
+			for (int32 Index = Batch.Start; Index < Batch.End; Index++)
 			{
-				PCGEX_TEST_STACK(Index, Index)
-				NumPass += bResult;
+				const bool bPass = Cursor < NumSelected && Selection[Cursor] == Index;
+				Cursor += bPass;
+				Write(Index, bPass);
 			}
-		}
 
-		return NumPass;
-	}
+			if (bAdaptiveOrder && LocalOrder.Num() > 1 && FPlatformAtomics::InterlockedIncrement(&NumBatches) % ReorderInterval == 0) { UpdateOrder(); }
 
-	int32 FManager::Test(const PCGExMT::FScope Scope, TBitArray<>& OutResults, const bool bParallel)
-	{
-		int32 NumPass = 0;
+			return NumSelected;
+		};
 
-		if (bParallel)
+		if (bParallel && NumBatchesInScope > 1)
 		{
-			ParallelFor(Scope.Count, [&](const int32 i)
-			{
-				const int32 Index = Scope.Start + i;
-				PCGEX_TEST_STACK(Index, Index)
-				if (bResult) { FPlatformAtomics::InterlockedIncrement(&NumPass); }
-			});
+			ParallelFor(NumBatchesInScope, [&](const int32 i) { FPlatformAtomics::InterlockedAdd(&NumPass, TestBatch(i)); });
 		}
 		else
 		{
-			PCGEX_SCOPE_LOOP(Index)
-			{
-				PCGEX_TEST_STACK(Index, Index)
-				NumPass += bResult;
-			}
+			for (int32 i = 0; i < NumBatchesInScope; i++) { NumPass += TestBatch(i); }
 		}
 
 		return NumPass;
 	}
 
-	int32 FManager::Test(const TArrayView<PCGExClusters::FNode> Items, const TArrayView<int8> OutResults, const bool bParallel)
+	int32 FManager::Test(const PCGExMT::FScope Scope, TArray<int8>& OutResults, const bool bParallel)
 	{
-		const int32 NumItems = Items.Num();
-		check(NumItems == OutResults.Num());
+		return TestBatched(
+			Scope, bParallel,
+			[](const IFilter* Filter, const PCGExMT::FScope& Batch, const TArrayView<int32> Selection) { return Filter->TestSelection(Batch, Selection); },
+			[&](const int32 Index, const bool bPass) { OutResults[Index] = bPass; });
+	}
 
-		int32 NumPass = 0;
+	int32 FManager::Test(const PCGExMT::FScope Scope, TBitArray<>& OutResults, const bool bParallel)
+	{
+		return TestBatched(
+			Scope, bParallel,
+			[](const IFilter* Filter, const PCGExMT::FScope& Batch, const TArrayView<int32> Selection) { return Filter->TestSelection(Batch, Selection); },
+			[&](const int32 Index, const bool bPass) { OutResults[Index] = bPass; });
+	}
 
-		if (bParallel)
-		{
-			ParallelFor(NumItems, [&](const int32 i)
-			{
-				const PCGExClusters::FNode& Node = Items[i];
-				PCGEX_TEST_STACK(Node, Node.PointIndex)
-				if (bResult) { FPlatformAtomics::InterlockedIncrement(&NumPass); }
-			});
-		}
-		else
-		{
-			for (int i = 0; i < NumItems; i++)
-			{
-				const PCGExClusters::FNode& Node = Items[i];
-				PCGEX_TEST_STACK(Node, Node.PointIndex)
-				NumPass += bResult;
-			}
-		}
+	int32 FManager::Test(const TArrayView<PCGExClusters::FNode> Items, const TArrayView<int8> OutResults, const bool bParallel)
+	{
+		check(Items.Num() == OutResults.Num());
 
-		return NumPass;
+		return TestBatched(
+			PCGExMT::FScope(0, Items.Num()), bParallel,
+			[&](const IFilter* Filter, const PCGExMT::FScope& Batch, const TArrayView<int32> Selection)
+			{
+				return CompactSelection(Selection, [&](const int32 i) { return Filter->Test(Items[i]); });
+			},
+			[&](const int32 i, const bool bPass) { OutResults[Items[i].PointIndex] = bPass; });
 	}
 
 	int32 FManager::Test(const TArrayView<PCGExClusters::FNode> Items, const TSharedPtr<TArray<int8>>& OutResultsPtr, const bool bParallel)
 	{
-		int32 NumPass = 0;
 		TArray<int8>& OutResults = *OutResultsPtr.Get();
 
-		if (bParallel)
-		{
-			ParallelFor(Items.Num(), [&](const int32 i)
-			{
-				const PCGExClusters::FNode& Node = Items[i];
-				PCGEX_TEST_STACK(Node, Node.PointIndex)
-				if (bResult) { FPlatformAtomics::InterlockedIncrement(&NumPass); }
-			});
-		}
-		else
-		{
-			for (const PCGExClusters::FNode& Node : Items)
+		return TestBatched(
+			PCGExMT::FScope(0, Items.Num()), bParallel,
+			[&](const IFilter* Filter, const PCGExMT::FScope& Batch, const TArrayView<int32> Selection)
 			{
-				PCGEX_TEST_STACK(Node, Node.PointIndex)
-				NumPass += bResult;
-			}
-		}
-
-		return NumPass;
+				return CompactSelection(Selection, [&](const int32 i) { return Filter->Test(Items[i]); });
+			},
+			[&](const int32 i, const bool bPass) { OutResults[Items[i].PointIndex] = bPass; });
 	}
 
 	int32 FManager::Test(const TArrayView<PCGExGraphs::FEdge> Items, const TArrayView<int8> OutResults, const bool bParallel)
 	{
-		const int32 NumItems = Items.Num();
-		check(NumItems == OutResults.Num());
-		int32 NumPass = 0;
-		if (bParallel)
-		{
-			ParallelFor(NumItems, [&](const int32 i)
+		check(Items.Num() == OutResults.Num());
+
+		return TestBatched(
+			PCGExMT::FScope(0, Items.Num()), bParallel,
+			[&](const IFilter* Filter, const PCGExMT::FScope& Batch, const TArrayView<int32> Selection)
 			{
-				const PCGExGraphs::FEdge& Edge = Items[i];
-				PCGEX_TEST_STACK(Edge, i)
-				if (bResult) { FPlatformAtomics::InterlockedIncrement(&NumPass); }
-			});
-		}
-		else
+				return CompactSelection(Selection, [&](const int32 i) { return Filter->Test(Items[i]); });
+			},
+			[&](const int32 i, const bool bPass) { OutResults[i] = bPass; });
+	}
+
+	void FManager::GetOrder(TArray<int32, TInlineAllocator<16>>& OutOrder) const
+	{
+		FReadScopeLock ReadScopeLock(OrderLock);
+		OutOrder.Append(Order);
+	}
+
+	void FManager::RecordBatch(const int32 StackIndex, const int32 NumTested, const int32 NumPassed, const uint64 Cycles)
+	{
+		if (!bAdaptiveOrder) { return; }
+
+		FFilterStats& S = Stats[StackIndex];
+		FPlatformAtomics::InterlockedAdd(&S.NumTested, static_cast<int64>(NumTested));
+		FPlatformAtomics::InterlockedAdd(&S.NumPassed, static_cast<int64>(NumPassed));
+		FPlatformAtomics::InterlockedAdd(&S.Cycles, static_cast<int64>(Cycles));
+	}
+
+	// Ranks filters by cost per rejected item, ascending -- the optimal ordering for independent conjunctive predicates.
+	// Filters that were never reached have no stats and keep their priority order at the back of the stack.
+	void FManager::UpdateOrder()
+	{
+		const int32 NumFilters = Stack.Num();
+
+		TArray<double> Ranks;
+		Ranks.SetNumUninitialized(NumFilters);
+
+		for (int32 i = 0; i < NumFilters; i++)
 		{
-			for (int i = 0; i < NumItems; i++)
+			const FFilterStats& S = Stats[i];
+			const int64 NumTested = FPlatformAtomics::AtomicRead(&S.NumTested);
+			if (!NumTested)
 			{
-				const PCGExClusters::FEdge& Edge = Items[i];
-				PCGEX_TEST_STACK(Edge, i)
-				NumPass += bResult;
+				Ranks[i] = MAX_dbl;
+				continue;
 			}
+
+			const double CostPerItem = static_cast<double>(FPlatformAtomics::AtomicRead(&S.Cycles)) / NumTested;
+			const double RejectionRate = 1 - static_cast<double>(FPlatformAtomics::AtomicRead(&S.NumPassed)) / NumTested;
+			Ranks[i] = CostPerItem / FMath::Max(RejectionRate, UE_KINDA_SMALL_NUMBER);
 		}
 
-		return NumPass;
+		TArray<int32> NewOrder;
+		NewOrder.SetNumUninitialized(NumFilters);
+		for (int32 i = 0; i < NumFilters; i++) { NewOrder[i] = i; }
+		NewOrder.StableSort([&](const int32 A, const int32 B) { return Ranks[A] < Ranks[B]; });
+
+		FWriteScopeLock WriteScopeLock(OrderLock);
+		Order = MoveTemp(NewOrder);
 	}
 
 	void FManager::SetSupportedTypes(const TSet<PCGExFactories::EType>* InTypes)
@@ -380,6 +438,11 @@ namespace PCGExPointFilter
 			Stack.Add(Filter.Get());
 		}
 
+		// Batch evaluation starts in priority order, and is re-ranked as stats come in
+		Stats.Init(FFilterStats(), Stack.Num());
+		Order.SetNumUninitialized(Stack.Num());
+		for (int i = 0; i < Order.Num(); i++) { Order[i] = i; }
+
 		if (bCacheResults) { InitCache(); }
 
 		return true;
@@ -69,7 +69,9 @@ void FPCGExFilterResultDetails::Init(const TSharedPtr<PCGExData::FFacade>& InDat
 		break;
 	case EPCGExResultWriteAction::Counter: IncrementBuffer = InDataFacade->GetWritable<double>(ResultAttributeName, 0, true, PCGExData::EBufferInit::Inherit);
 		break;
-	case EPCGExResultWriteAction::Bitmask: BitmaskBuffer = InDataFacade->GetWritable<int64>(ResultAttributeName, 0, true, PCGExData::EBufferInit::Inherit);
+	case EPCGExResultWriteAction::Bitmask:
+		// Pass-only or fail-only ops leave the other points untouched, only write back what changed
+		BitmaskBuffer = InDataFacade->GetWritable<int64>(ResultAttributeName, 0, true, PCGExData::EBufferInit::Inherit, bDoBitmaskOpOnPass != bDoBitmaskOpOnFail);
 		break;
 	}
 }
@@ -80,6 +80,23 @@ bool PCGExPointFilter::FBooleanCompareFilter::Test(const TSharedPtr<PCGExData::F
 	return TypedFilterFactory->Config.Comparison == EPCGExEquality::Equal ? A == B : A != B;
 }
 
+int32 PCGExPointFilter::FBooleanCompareFilter::TestSelection(const PCGExMT::FScope& Scope, const TArrayView<int32> InOutSelection) const
+{
+	static thread_local TArray<bool> ScratchA;
+	static thread_local TArray<bool> ScratchB;
+	const TConstArrayView<bool> A = OperandA->ReadSpan(Scope, ScratchA);
+	const TConstArrayView<bool> B = OperandB->ReadSpan(Scope, ScratchB);
+
+	const bool bEqual = TypedFilterFactory->Config.Comparison == EPCGExEquality::Equal;
+
+	return CompactSelection(
+		InOutSelection, [&](const int32 Index)
+		{
+			const int32 i = Index - Scope.Start;
+			return (A[i] == B[i]) == bEqual;
+		});
+}
+
 PCGEX_CREATE_FILTER_FACTORY(BooleanCompare)
 
 #if WITH_EDITOR
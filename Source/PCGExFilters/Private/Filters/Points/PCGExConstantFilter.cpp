@@ -41,6 +41,11 @@ bool PCGExPointFilter::FConstantFilter::Test(const PCGExData::FProxyPoint& Point
 	return ConstantValue;
 }
 
+int32 PCGExPointFilter::FConstantFilter::TestSelection(const PCGExMT::FScope& Scope, const TArrayView<int32> InOutSelection) const
+{
+	return ConstantValue ? InOutSelection.Num() : 0;
+}
+
 PCGEX_CREATE_FILTER_FACTORY(Constant)
 
 #if WITH_EDITOR
@@ -193,6 +193,21 @@ namespace PCGExFilterGroup
 		return !bInvert;
 	}
 
+	// Chains the managed filters over the shrinking selection, column-at-a-time
+	int32 FFilterGroupAND::TestSelection(const PCGExMT::FScope& Scope, const TArrayView<int32> InOutSelection) const
+	{
+		if (bInvert) { return FFilterGroup::TestSelection(Scope, InOutSelection); }
+
+		int32 NumSelected = InOutSelection.Num();
+		for (const PCGExPointFilter::IFilter* Filter : Stack)
+		{
+			NumSelected = Filter->TestSelection(Scope, InOutSelection.Left(NumSelected));
+			if (!NumSelected) { break; }
+		}
+
+		return NumSelected;
+	}
+
 	bool FFilterGroupOR::Test(const int32 Index) const
 	{
 		for (const PCGExPointFilter::IFilter* Filter : Stack) { if (Filter->Test(Index)) { return !bInvert; } }
@@ -222,6 +237,33 @@ namespace PCGExFilterGroup
 		for (const PCGExPointFilter::IFilter* Filter : Stack) { if (Filter->Test(IO, ParentCollection)) { return !bInvert; } }
 		return bInvert;
 	}
+
+	// Each managed filter only tests the indices that haven't been accepted yet, column-at-a-time
+	int32 FFilterGroupOR::TestSelection(const PCGExMT::FScope& Scope, const TArrayView<int32> InOutSelection) const
+	{
+		if (bInvert) { return FFilterGroup::TestSelection(Scope, InOutSelection); }
+
+		TArray<int8, TInlineAllocator<1024>> Accepted;
+		Accepted.SetNumZeroed(Scope.Count);
+
+		TArray<int32, TInlineAllocator<1024>> Pending(InOutSelection.GetData(), InOutSelection.Num());
+		TArray<int32, TInlineAllocator<1024>> Candidates;
+
+		int32 NumPending = Pending.Num();
+		for (const PCGExPointFilter::IFilter* Filter : Stack)
+		{
+			Candidates.Reset();
+			Candidates.Append(Pending.GetData(), NumPending);
+
+			const int32 NumPassed = Filter->TestSelection(Scope, Candidates);
+			for (int32 i = 0; i < NumPassed; i++) { Accepted[Candidates[i] - Scope.Start] = 1; }
+
+			NumPending = PCGExPointFilter::CompactSelection(TArrayView<int32>(Pending.GetData(), NumPending), [&](const int32 Index) { return !Accepted[Index - Scope.Start]; });
+			if (!NumPending) { break; }
+		}
+
+		return PCGExPointFilter::CompactSelection(InOutSelection, [&](const int32 Index) { return Accepted[Index - Scope.Start]; });
+	}
 }
 
 #define PCGEX_FILTERGROUP_FOREACH(_BODY) for (const TObjectPtr<const UPCGExPointFilterFactoryData>& SubFilter : FilterFactories) { if (!IsValid(SubFilter)) { continue; } _BODY }
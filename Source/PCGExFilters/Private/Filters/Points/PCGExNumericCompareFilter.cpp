@@ -79,6 +79,26 @@ bool PCGExPointFilter::FNumericCompareFilter::Test(const TSharedPtr<PCGExData::F
 	return PCGExCompare::Compare(TypedFilterFactory->Config.Comparison, A, B, TypedFilterFactory->Config.Tolerance);
 }
 
+int32 PCGExPointFilter::FNumericCompareFilter::TestSelection(const PCGExMT::FScope& Scope, const TArrayView<int32> InOutSelection) const
+{
+	// Fetch both operands once for the whole scope, then compare the selection against the spans.
+	// Scratch is kept per thread so batches don't reallocate it every call.
+	static thread_local TArray<double> ScratchA;
+	static thread_local TArray<double> ScratchB;
+	const TConstArrayView<double> A = OperandA->ReadSpan(Scope, ScratchA);
+	const TConstArrayView<double> B = OperandB->ReadSpan(Scope, ScratchB);
+
+	const EPCGExComparison Comparison = TypedFilterFactory->Config.Comparison;
+	const double Tolerance = TypedFilterFactory->Config.Tolerance;
+
+	return CompactSelection(
+		InOutSelection, [&](const int32 Index)
+		{
+			const int32 i = Index - Scope.Start;
+			return PCGExCompare::Compare(Comparison, A[i], B[i], Tolerance);
+		});
+}
+
 PCGEX_CREATE_FILTER_FACTORY(NumericCompare)
 
 #if WITH_EDITOR
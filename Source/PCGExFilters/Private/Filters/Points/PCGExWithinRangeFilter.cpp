@@ -82,6 +82,25 @@ bool PCGExPointFilter::FWithinRangeFilter::Test(const int32 PointIndex) const
 	return bInvert;
 }
 
+int32 PCGExPointFilter::FWithinRangeFilter::TestSelection(const PCGExMT::FScope& Scope, const TArrayView<int32> InOutSelection) const
+{
+	static thread_local TArray<double> Scratch;
+	const TConstArrayView<double> Values = OperandA->ReadSpan(Scope, Scratch);
+
+	return CompactSelection(
+		InOutSelection, [&](const int32 Index)
+		{
+			const double A = Values[Index - Scope.Start];
+			if (bInclusive)
+			{
+				for (const FPCGExPickerConstantRangeConfig& Range : Ranges) { if (Range.IsWithinInclusive(A)) { return !bInvert; } }
+				return bInvert;
+			}
+			for (const FPCGExPickerConstantRangeConfig& Range : Ranges) { if (Range.IsWithin(A)) { return !bInvert; } }
+			return bInvert;
+		});
+}
+
 bool PCGExPointFilter::FWithinRangeFilter::Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const
 {
 	double A = 0;
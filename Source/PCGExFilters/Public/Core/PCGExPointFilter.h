@@ -127,6 +127,7 @@ namespace PCGExPointFilter
 	 * - Test(FPointIO, FPointIOCollection) is for collection-level evaluation only
 	 *
 	 * The FManager calls Test() in an AND-stack: all filters must pass for a point to pass.
+	 * Batch evaluation goes through TestSelection(), which filters can override to read attribute spans once per scope.
 	 * Results can be cached in the Results array when bCacheResults is true.
 	 */
 	class PCGEXFILTERS_API IFilter : public TSharedFromThis<IFilter>
@@ -163,6 +164,13 @@ namespace PCGExPointFilter
 
 		virtual bool Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const; // destined for collection only, is expected to test internal PointDataFacade directly.
 
+		/**
+		 * Column-at-a-time evaluation of a selection of point indices, all within Scope.
+		 * Compacts InOutSelection in place so it only holds passing indices, preserving order, and returns how many passed.
+		 * Default routes through Test(int32).
+		 */
+		virtual int32 TestSelection(const PCGExMT::FScope& Scope, const TArrayView<int32> InOutSelection) const;
+
 		virtual void SetSupportedTypes(const TSet<PCGExFactories::EType>* InTypes)
 		{
 		}
@@ -217,8 +225,32 @@ namespace PCGExPointFilter
 		virtual bool Test(const PCGExClusters::FNode& Node) const override final;
 		virtual bool Test(const PCGExGraphs::FEdge& Edge) const override final;
 		virtual bool Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const override;
+
+		virtual int32 TestSelection(const PCGExMT::FScope& Scope, const TArrayView<int32> InOutSelection) const override;
 	};
 
+	/**
+	 * Stable in-place compaction of a selection, keeping only the indices that pass the predicate.
+	 * Branchless, so unpredictable selectivity doesn't cost a mispredict per item.
+	 * @return Number of surviving indices, at the front of InOutSelection
+	 */
+	template <typename PredicateFunc>
+	FORCEINLINE int32 CompactSelection(const TArrayView<int32> InOutSelection, PredicateFunc&& Predicate)
+	{
+		int32* RESTRICT Data = InOutSelection.GetData();
+		const int32 Num = InOutSelection.Num();
+
+		int32 WriteIndex = 0;
+		for (int32 i = 0; i < Num; i++)
+		{
+			const int32 Index = Data[i];
+			Data[WriteIndex] = Index;
+			WriteIndex += static_cast<bool>(Predicate(Index));
+		}
+
+		return WriteIndex;
+	}
+
 	/**
 	 * Aggregates multiple IFilter instances into an AND-stack and provides batch evaluation.
 	 *
@@ -228,7 +260,10 @@ namespace PCGExPointFilter
 	 * 3. Test() evaluates the stack -- all filters must pass (short-circuit on first failure)
 	 *
 	 * Batch Test() overloads accept a scope/range and optionally run in parallel via ParallelFor.
-	 * They return the number of passing items. Parallel paths use InterlockedIncrement for the count.
+	 * They return the number of passing items. Items are processed in fixed-size batches, column-at-a-time:
+	 * each filter tests the whole batch before the next one runs, and only sees the indices that survived so far.
+	 * Per-filter cost and selectivity are recorded along the way, and the batch evaluation order is periodically
+	 * re-ranked so cheap, highly selective filters run first. Since the stack is a pure AND, order never changes results.
 	 *
 	 * Extension points:
 	 * - Override InitFilter() to customize how filters are initialized (see PCGExClusterFilter::FManager)
@@ -249,6 +284,9 @@ namespace PCGExPointFilter
 
 		bool bValid = false;
 
+		/** If enabled, batch Test() re-ranks the filter order from observed cost & selectivity. Otherwise, priority order is kept. */
+		bool bAdaptiveOrder = true;
+
 		TSharedRef<PCGExData::FFacade> PointDataFacade;
 
 		bool Init(FPCGExContext* InContext, const TArray<TObjectPtr<const UPCGExPointFilterFactoryData>>& InFactories);
@@ -278,6 +316,30 @@ namespace PCGExPointFilter
 		TArray<TSharedPtr<IFilter>> ManagedFilters; // Owns the filter instances
 		TArray<const IFilter*> Stack;               // Raw pointers for cache-friendly iteration in Test()
 
+		struct FFilterStats
+		{
+			int64 NumTested = 0;
+			int64 NumPassed = 0;
+			int64 Cycles = 0;
+		};
+
+		TArray<FFilterStats> Stats; // Per Stack entry, accumulated by batch Test()
+		TArray<int32> Order;        // Stack indices, in batch evaluation order
+		mutable FRWLock OrderLock;
+		int32 NumBatches = 0;
+
+		void GetOrder(TArray<int32, TInlineAllocator<16>>& OutOrder) const;
+		void RecordBatch(const int32 StackIndex, const int32 NumTested, const int32 NumPassed, const uint64 Cycles);
+		void UpdateOrder();
+
+		/**
+		 * Column-at-a-time evaluation of a scope of items, split into batches.
+		 * @param TestFilter (const IFilter*, const FScope& Batch, TArrayView<int32> Selection) -> int32; compacts the selection, returns survivors
+		 * @param Write (int32 Item, bool bPass); called once per item of the scope
+		 */
+		template <typename FilterFunc, typename WriteFunc>
+		int32 TestBatched(const PCGExMT::FScope& Scope, const bool bParallel, FilterFunc&& TestFilter, WriteFunc&& Write);
+
 		virtual bool InitFilter(FPCGExContext* InContext, const TSharedPtr<IFilter>& Filter);
 		virtual bool PostInit(FPCGExContext* InContext);
 		virtual void PostInitFilter(FPCGExContext* InContext, const TSharedPtr<IFilter>& InFilter);
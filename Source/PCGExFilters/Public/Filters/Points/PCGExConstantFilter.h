@@ -66,6 +66,7 @@ namespace PCGExPointFilter
 		virtual bool Test(const int32 PointIndex) const override;
 		virtual bool Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const override;
 		virtual bool Test(const PCGExData::FProxyPoint& Point) const override;
+		virtual int32 TestSelection(const PCGExMT::FScope& Scope, const TArrayView<int32> InOutSelection) const override;
 
 		virtual ~FConstantFilter() override
 		{
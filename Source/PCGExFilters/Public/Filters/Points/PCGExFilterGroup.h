@@ -126,6 +126,8 @@ namespace PCGExFilterGroup
 		virtual bool Test(const PCGExGraphs::FEdge& Edge) const override;
 		virtual bool Test(const PCGExData::FProxyPoint& Point) const override;
 		virtual bool Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const override;
+
+		virtual int32 TestSelection(const PCGExMT::FScope& Scope, const TArrayView<int32> InOutSelection) const override;
 	};
 
 	class PCGEXFILTERS_API FFilterGroupOR final : public FFilterGroup
@@ -141,6 +143,8 @@ namespace PCGExFilterGroup
 		virtual bool Test(const PCGExGraphs::FEdge& Edge) const override;
 		virtual bool Test(const PCGExData::FProxyPoint& Point) const override;
 		virtual bool Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const override;
+
+		virtual int32 TestSelection(const PCGExMT::FScope& Scope, const TArrayView<int32> InOutSelection) const override;
 	};
 }
 
@@ -87,6 +87,7 @@ namespace PCGExPointFilter
 
 		virtual bool Test(const int32 PointIndex) const override;
 		virtual bool Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const override;
+		virtual int32 TestSelection(const PCGExMT::FScope& Scope, const TArrayView<int32> InOutSelection) const override;
 
 		virtual ~FNumericCompareFilter() override
 		{
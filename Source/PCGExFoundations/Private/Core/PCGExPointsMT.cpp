@@ -247,6 +247,8 @@ namespace PCGExPointsMT
 			return;
 		}
 
+		BuildProcessorBundles(Processors, BundledProcessors, ProcessorBundles);
+
 		if (bPrefetchData)
 		{
 			PCGEX_ASYNC_GROUP_CHKD_VOID(TaskManager, ParallelAttributeRead)
@@ -257,13 +259,14 @@ namespace PCGExPointsMT
 				This->OnProcessingPreparationComplete();
 			};
 
-			ParallelAttributeRead->OnIterationCallback = [PCGEX_ASYNC_THIS_CAPTURE, ParallelAttributeRead](const int32 Index, const PCGExMT::FScope& Scope)
+			ParallelAttributeRead->OnIterationCallback = [PCGEX_ASYNC_THIS_CAPTURE, ParallelAttributeRead](const int32 BundleIndex, const PCGExMT::FScope& Scope)
 			{
 				PCGEX_ASYNC_THIS
-				This->Processors[Index]->PrefetchData(This->TaskManager, ParallelAttributeRead);
+				const PCGExMT::FScope& Bundle = This->ProcessorBundles[BundleIndex];
+				for (int32 b = Bundle.Start; b < Bundle.End; b++) { This->Processors[This->BundledProcessors[b]]->PrefetchData(This->TaskManager, ParallelAttributeRead); }
 			};
 
-			ParallelAttributeRead->StartIterations(Processors.Num(), 1);
+			ParallelAttributeRead->StartIterations(ProcessorBundles.Num(), 1);
 		}
 		else
 		{
@@ -303,6 +306,8 @@ namespace PCGExPointsMT
 	void IBatch::Cleanup()
 	{
 		ProcessorFacades.Empty();
+		BundledProcessors.Empty();
+		ProcessorBundles.Empty();
 
 		for (const TSharedRef<IProcessor>& P : Processors) { P->Cleanup(); }
 		Processors.Empty();
@@ -310,9 +315,59 @@ namespace PCGExPointsMT
 
 	void IBatch::OnProcessingPreparationComplete()
 	{
+		if (bPipelinePhases)
+		{
+			PCGEX_ASYNC_MT_LOOP_TPL(Process, bForceSingleThreadedProcessing, { This->RunProcessorPhase(Processor, EProcessorPhase::Process); }, {})
+			return;
+		}
+
 		PCGEX_ASYNC_MT_LOOP_TPL(Process, bForceSingleThreadedProcessing, { Processor->bIsProcessorValid = Processor->Process(This->TaskManager); }, { Process->OnCompleteCallback = [PCGEX_ASYNC_THIS_CAPTURE](){ PCGEX_ASYNC_THIS This->OnInitialPostProcess(); };})
 	}
 
+	void IBatch::RunProcessorPhase(const TSharedRef<IProcessor>& InProcessor, const EProcessorPhase InPhase)
+	{
+		PCGEX_ASYNC_GROUP_CHKD_VOID(TaskManager, ProcessorPhase)
+
+		ProcessorPhase->OnCompleteCallback = [PCGEX_ASYNC_THIS_CAPTURE, WeakProcessor = TWeakPtr<IProcessor>(InProcessor), InPhase]()
+		{
+			PCGEX_ASYNC_THIS
+			const TSharedPtr<IProcessor> Processor = WeakProcessor.Pin();
+			if (!Processor) { return; }
+
+			Processor->PhaseGroup.Reset();
+			This->OnProcessorPhaseComplete(Processor.ToSharedRef(), InPhase);
+		};
+
+		InProcessor->PhaseGroup = ProcessorPhase;
+
+		// Hold the phase open while its entry point runs, so it can't end before the work it starts is registered
+		const TSharedPtr<PCGExMT::FAsyncToken> EntryToken = ProcessorPhase->TryCreateToken(FName("PhaseEntry")).Pin();
+		if (!EntryToken) { return; }
+
+		switch (InPhase)
+		{
+		case EProcessorPhase::Process:
+			InProcessor->bIsProcessorValid = InProcessor->Process(TaskManager);
+			break;
+		case EProcessorPhase::CompleteWork:
+			InProcessor->CompleteWork();
+			break;
+		case EProcessorPhase::Write:
+			InProcessor->Write();
+			break;
+		}
+
+		EntryToken->Release();
+	}
+
+	void IBatch::OnProcessorPhaseComplete(const TSharedRef<IProcessor>& InProcessor, const EProcessorPhase InPhase)
+	{
+		if (!InProcessor->bIsProcessorValid) { return; }
+
+		if (InPhase == EProcessorPhase::Process && !bSkipCompletion) { RunProcessorPhase(InProcessor, EProcessorPhase::CompleteWork); }
+		else if (InPhase != EProcessorPhase::Write && bRequiresWriteStep) { RunProcessorPhase(InProcessor, EProcessorPhase::Write); }
+	}
+
 	void ScheduleBatch(const TSharedPtr<PCGExMT::FTaskManager>& TaskManager, const TSharedPtr<IBatch>& Batch)
 	{
 		PCGEX_LAUNCH(FStartBatchProcessing<IBatch>, Batch)
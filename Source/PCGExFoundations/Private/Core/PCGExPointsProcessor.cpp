@@ -118,6 +118,18 @@ bool FPCGExPointsProcessorContext::ProcessPointsBatch(const PCGExCommon::Context
 		TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExPointsProcessorContext::ProcessPointsBatch::InitialProcessingDone);
 		BatchProcessing_InitialProcessingDone();
 
+		if (MainBatch->bPipelinePhases)
+		{
+			// Processors went through all their phases on their own already
+			if (!MainBatch->bSkipCompletion) { BatchProcessing_WorkComplete(); }
+			if (MainBatch->bRequiresWriteStep) { BatchProcessing_WritingDone(); }
+
+			bBatchProcessingEnabled = false;
+			if (NextStateId == PCGExCommon::States::State_Done) { Done(); }
+			SetState(NextStateId);
+			return true;
+		}
+
 		SetState(PCGExPointsMT::MTState_PointsCompletingWork);
 		if (!MainBatch->bSkipCompletion)
 		{
@@ -95,10 +95,19 @@ namespace PCGExBitwiseOperation
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(PCGEx::BitwiseOperation::ProcessPoints);
 
+		TArray<int64> MaskScratch;
+		const TConstArrayView<int64> Masks = Mask->ReadSpan(Scope, MaskScratch);
+
+		if (const TArrayView<int64> OutValues = Writer->GetOutSpan(Scope); !OutValues.IsEmpty())
+		{
+			for (int32 i = 0; i < Scope.Count; i++) { PCGExBitmask::Do(Op, OutValues[i], Masks[i]); }
+			return;
+		}
+
 		PCGEX_SCOPE_LOOP(Index)
 		{
 			int64 OutValue = Writer->GetValue(Index);
-			PCGExBitmask::Do(Op, OutValue, Mask->Read(Index));
+			PCGExBitmask::Do(Op, OutValue, Masks[Index - Scope.Start]);
 			Writer->SetValue(Index, OutValue);
 		}
 	}
@@ -6,6 +6,8 @@
 #include "CoreMinimal.h"
 #include "PCGExCommon.h"
 #include "Core/PCGExContext.h"
+#include "PCGExCoreSettingsCache.h"
+#include "Core/PCGExMTCommon.h"
 
 #define PCGEX_TYPED_PROCESSOR_NREF(_NAME) const TSharedRef<FProcessor> _NAME = StaticCastSharedRef<FProcessor>(InProcessor);
 #define PCGEX_TYPED_PROCESSOR_REF PCGEX_TYPED_PROCESSOR_NREF(TypedProcessor)
@@ -46,36 +48,71 @@ namespace PCGExPointsMT
 	PCGEX_CTX_STATE(MTState_PointsCompletingWork)
 	PCGEX_CTX_STATE(MTState_PointsWriting)
 
+// Iterates over processor bundles (see BuildProcessorBundles); each bundle runs its processors back-to-back in a single task
 #define PCGEX_ASYNC_MT_LOOP_TPL(_ID, _INLINE_CONDITION, _BODY, _JIT)\
 	PCGEX_CHECK_WORK_HANDLE_VOID\
-	if (_INLINE_CONDITION)  { \
-		PCGEX_ASYNC_GROUP_CHKD_VOID(TaskManager, _ID) \
-		_ID->OnIterationCallback = [PCGEX_ASYNC_THIS_CAPTURE](const int32 Index, const PCGExMT::FScope& Scope) { PCGEX_ASYNC_THIS const TSharedRef<IProcessor>& Processor = This->Processors[Index]; _BODY }; \
-		_JIT\
-		_ID->StartIterations( Processors.Num(), 1, true);\
-	} else {\
-		PCGEX_ASYNC_GROUP_CHKD_VOID(TaskManager, _ID)\
-		_ID->OnIterationCallback = [PCGEX_ASYNC_THIS_CAPTURE](const int32 Index, const PCGExMT::FScope& Scope) { PCGEX_ASYNC_THIS \
-		const TSharedRef<IProcessor>& Processor = This->Processors[Index]; _BODY }; \
-		_JIT\
-		_ID->StartIterations(Processors.Num(), 1, false);\
-	}
-
-#define PCGEX_ASYNC_PROCESSOR_LOOP(_NAME, _NUM, _PREPARE, _PROCESS, _COMPLETE, _INLINE, _PLI) \
+	PCGEX_ASYNC_GROUP_CHKD_VOID(TaskManager, _ID) \
+	_ID->OnIterationCallback = [PCGEX_ASYNC_THIS_CAPTURE](const int32 BundleIndex, const PCGExMT::FScope& Scope) { PCGEX_ASYNC_THIS \
+		const PCGExMT::FScope& Bundle = This->ProcessorBundles[BundleIndex]; \
+		for (int32 b = Bundle.Start; b < Bundle.End; b++) { const TSharedRef<IProcessor>& Processor = This->Processors[This->BundledProcessors[b]]; _BODY } }; \
+	_JIT\
+	_ID->StartIterations(ProcessorBundles.Num(), 1, _INLINE_CONDITION);
+
+#define PCGEX_ASYNC_PROCESSOR_LOOP(_NAME, _NUM, _PREPARE, _PROCESS, _COMPLETE, _INLINE, _PLI, _PARENT) \
 	PCGEX_CHECK_WORK_HANDLE_VOID\
 	if (IsTrivial()){ TRACE_CPUPROFILER_EVENT_SCOPE(StartParallelLoopFor##_NAME##_Trivial) PCGExMT::FScope TrivialScope = PCGExMT::FScope(0, _NUM, 0); _PREPARE({TrivialScope}); _PROCESS(TrivialScope); _COMPLETE(); }else{\
 	TRACE_CPUPROFILER_EVENT_SCOPE(StartParallelLoopFor##_NAME)\
 	const int32 PLI = PCGEX_CORE_SETTINGS._PLI(PerLoopIterations); \
-	PCGEX_ASYNC_GROUP_CHKD_VOID(TaskManager, ParallelLoopFor##_NAME) \
+	PCGEX_ASYNC_SUBGROUP_CHKD_RET(TaskManager, _PARENT, ParallelLoopFor##_NAME, ) \
 	ParallelLoopFor##_NAME->OnCompleteCallback = [PCGEX_ASYNC_THIS_CAPTURE]() { PCGEX_ASYNC_THIS This->_COMPLETE(); }; \
 	ParallelLoopFor##_NAME->OnPrepareSubLoopsCallback = [PCGEX_ASYNC_THIS_CAPTURE](const TArray<PCGExMT::FScope>& Loops) { PCGEX_ASYNC_THIS This->_PREPARE(Loops); }; \
 	ParallelLoopFor##_NAME->OnSubLoopStartCallback =[PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope) { PCGEX_ASYNC_THIS This->_PROCESS(Scope); }; \
     ParallelLoopFor##_NAME->StartSubLoops(_NUM, PLI, _INLINE);}
 
-#define PCGEX_ASYNC_POINT_PROCESSOR_LOOP(_NAME, _NUM, _PREPARE, _PROCESS, _COMPLETE, _INLINE) PCGEX_ASYNC_PROCESSOR_LOOP(_NAME, _NUM, _PREPARE, _PROCESS, _COMPLETE, _INLINE, GetPointsBatchChunkSize)
+#define PCGEX_ASYNC_POINT_PROCESSOR_LOOP(_NAME, _NUM, _PREPARE, _PROCESS, _COMPLETE, _INLINE) PCGEX_ASYNC_PROCESSOR_LOOP(_NAME, _NUM, _PREPARE, _PROCESS, _COMPLETE, _INLINE, GetPointsBatchChunkSize, PhaseGroup)
 
 #define PCGEX_ASYNC_MT_LOOP_VALID_PROCESSORS(_ID, _INLINE_CONDITION, _BODY, _JIT) PCGEX_ASYNC_MT_LOOP_TPL(_ID, _INLINE_CONDITION, if(Processor->bIsProcessorValid){ _BODY }, _JIT)
 
+	/**
+	 * Pack processors into execution bundles. Non-trivial processors get a bundle of their own, trivial ones are
+	 * grouped by up to TrivialProcessorsBundleSize so tiny inputs don't each pay for their own task launches.
+	 * @param InProcessors Processors to bundle
+	 * @param OutOrder Processor indices, in bundle order
+	 * @param OutBundles Bundles, as scopes over OutOrder
+	 */
+	template <typename T>
+	void BuildProcessorBundles(const TArray<TSharedRef<T>>& InProcessors, TArray<int32>& OutOrder, TArray<PCGExMT::FScope>& OutBundles)
+	{
+		const int32 NumProcessors = InProcessors.Num();
+		const int32 MaxBundleSize = FMath::Max(1, PCGEX_CORE_SETTINGS.TrivialProcessorsBundleSize);
+
+		OutOrder.Reset(NumProcessors);
+		OutBundles.Reset();
+
+		// Heavier processors first so they start as early as possible
+		for (int32 i = 0; i < NumProcessors; i++)
+		{
+			if (InProcessors[i]->IsTrivial()) { continue; }
+			OutBundles.Emplace(OutOrder.Num(), 1, OutBundles.Num());
+			OutOrder.Add(i);
+		}
+
+		int32 BundleStart = OutOrder.Num();
+		for (int32 i = 0; i < NumProcessors; i++)
+		{
+			if (!InProcessors[i]->IsTrivial()) { continue; }
+
+			OutOrder.Add(i);
+			if (OutOrder.Num() - BundleStart == MaxBundleSize)
+			{
+				OutBundles.Emplace(BundleStart, MaxBundleSize, OutBundles.Num());
+				BundleStart = OutOrder.Num();
+			}
+		}
+
+		if (OutOrder.Num() > BundleStart) { OutBundles.Emplace(BundleStart, OutOrder.Num() - BundleStart, OutBundles.Num()); }
+	}
+
 	class IBatch;
 
 	class PCGEXFOUNDATIONS_API IProcessor : public TSharedFromThis<IProcessor>
@@ -97,6 +134,10 @@ namespace PCGExPointsMT
 
 		int32 LocalPointProcessingChunkSize = -1;
 
+		// Only set while a pipelined batch runs one of this processor phases (see IBatch::bPipelinePhases).
+		// Parallel loops started by the processor are parented to it, so the phase ends once they are done.
+		TSharedPtr<PCGExMT::FTaskGroup> PhaseGroup;
+
 	public:
 		TWeakPtr<IBatch> ParentBatch;
 		TSharedPtr<PCGExMT::FTaskManager> GetTaskManager() { return TaskManager; }
@@ -204,6 +245,16 @@ namespace PCGExPointsMT
 		bool bForceSingleThreadedCompletion = false;
 		bool bForceSingleThreadedWrite = false;
 		bool bRequiresWriteStep = false;
+
+		/**
+		 * Move each processor through Process -> CompleteWork -> Write as soon as its own work is done, instead of waiting
+		 * for every processor at each phase. Only the end of the batch is synchronized.
+		 * OnInitialPostProcess is not called, and context BatchProcessing_* hooks all run once the batch is done, so only
+		 * enable this if processors don't depend on each other between phases and only start async phase work through
+		 * the processor parallel loops or PhaseGroup.
+		 */
+		bool bPipelinePhases = false;
+
 		PCGExData::EIOInit DataInitializationPolicy = PCGExData::EIOInit::NoInit;
 		TArray<TSharedRef<PCGExData::FFacade>> ProcessorFacades;
 		TMap<PCGExData::FPointIO*, TSharedRef<IProcessor>>* SubProcessorMap = nullptr;
@@ -222,6 +273,9 @@ namespace PCGExPointsMT
 		TArray<TSharedRef<IProcessor>> Processors;
 		int32 GetNumProcessors() const { return Processors.Num(); }
 
+		TArray<int32> BundledProcessors;
+		TArray<PCGExMT::FScope> ProcessorBundles;
+
 		IBatch(FPCGExContext* InContext, const TArray<TWeakPtr<PCGExData::FPointIO>>& InPointsCollection);
 		virtual ~IBatch() = default;
 
@@ -253,6 +307,16 @@ namespace PCGExPointsMT
 
 	protected:
 		virtual void OnProcessingPreparationComplete();
+
+		enum class EProcessorPhase : uint8
+		{
+			Process = 0,
+			CompleteWork,
+			Write
+		};
+
+		void RunProcessorPhase(const TSharedRef<IProcessor>& InProcessor, const EProcessorPhase InPhase);
+		void OnProcessorPhaseComplete(const TSharedRef<IProcessor>& InProcessor, const EProcessorPhase InPhase);
 	};
 
 	template <typename T>
@@ -24,7 +24,7 @@ namespace PCGExClusterMT
 
 #pragma region Tasks
 
-#define PCGEX_ASYNC_CLUSTER_PROCESSOR_LOOP(_NAME, _NUM, _PREPARE, _PROCESS, _COMPLETE, _INLINE) PCGEX_ASYNC_PROCESSOR_LOOP(_NAME, _NUM, _PREPARE, _PROCESS, _COMPLETE, _INLINE, GetClusterBatchChunkSize)
+#define PCGEX_ASYNC_CLUSTER_PROCESSOR_LOOP(_NAME, _NUM, _PREPARE, _PROCESS, _COMPLETE, _INLINE) PCGEX_ASYNC_PROCESSOR_LOOP(_NAME, _NUM, _PREPARE, _PROCESS, _COMPLETE, _INLINE, GetClusterBatchChunkSize, nullptr)
 
 	template <typename T>
 	class FStartClusterBatchProcessing final : public PCGExMT::FTask
@@ -58,6 +58,11 @@ namespace PCGExClusterMT
 		if (UPCGExClusterEdgesData* EdgesData = Cast<UPCGExClusterEdgesData>(EdgeDataFacade->GetOut()))
 		{
 			EdgesData->SetBoundCluster(Cluster);
+			// A rehydrated cluster already matches the payload carried over from the input edges; only write missing or stale ones
+			if (Cluster && PCGEX_CORE_SETTINGS.bPersistClusterTopology && !(Cluster->bBuiltFromTopology && !EdgesData->GetPersistedTopology().IsEmpty()))
+			{
+				EdgesData->PersistTopology(*Cluster);
+			}
 		}
 	}
 
@@ -123,7 +128,8 @@ namespace PCGExClusterMT
 			Cluster = MakeShared<PCGExClusters::FCluster>(VtxDataFacade->Source, EdgeDataFacade->Source, NodeIndexLookup);
 			Cluster->bIsOneToOne = bIsOneToOne;
 
-			if (!Cluster->BuildFrom(*EndpointsLookup, ExpectedAdjacency))
+			if (!Cluster->BuildFromTopology(PCGExClusters::Helpers::GetPersistedTopology(EdgeDataFacade->Source), ExpectedAdjacency) &&
+				!Cluster->BuildFrom(*EndpointsLookup, ExpectedAdjacency))
 			{
 				PCGE_LOG_C(Error, GraphAndLog, ExecutionContext, FTEXT("A cluster could not be rebuilt correctly. If you did change the content of vtx/edges collections using non cluster-friendly nodes, make sure to use a 'Sanitize Cluster' to ensure clusters are validated."));
 				Cluster.Reset();
@@ -624,6 +630,8 @@ namespace PCGExClusterMT
 			NewProcessor->bIsTrivial = IO->GetNum() < PCGEX_CORE_SETTINGS.SmallClusterSize;
 		}
 
+		PCGExPointsMT::BuildProcessorBundles(Processors, BundledProcessors, ProcessorBundles);
+
 		StartProcessing();
 	}
 
@@ -717,6 +725,8 @@ namespace PCGExClusterMT
 	{
 		for (const TSharedRef<IProcessor>& P : Processors) { P->Cleanup(); }
 		Processors.Empty();
+		BundledProcessors.Empty();
+		ProcessorBundles.Empty();
 	}
 
 	void IBatch::AllocateVtxPoints()
@@ -97,7 +97,7 @@ namespace PCGExGraphs
 		uint32 A;
 		uint32 B;
 
-		UniqueEdges.Reserve(UniqueEdges.Num() + UniqueEdges.Num());
+		UniqueEdges.Reserve(UniqueEdges.Num() + InEdges.Num());
 		Edges.Reserve(Edges.Num() + InEdges.Num());
 
 		for (const uint64 E : InEdges)
@@ -118,6 +118,49 @@ namespace PCGExGraphs
 		UniqueEdges.Shrink();
 	}
 
+	void FGraph::InsertSortedUniqueEdges(const TArray<uint64>& InEdges, const int32 InIOIndex)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FGraph::InsertSortedUniqueEdges)
+
+		FWriteScopeLock WriteLock(GraphLock);
+
+		if (!Edges.IsEmpty())
+		{
+			// Existing edges may overlap, go through per-edge hash checks
+			FEdge OutEdge;
+			for (const uint64 E : InEdges)
+			{
+				uint32 A;
+				uint32 B;
+				PCGEx::H64(E, A, B);
+				InsertEdge_Unsafe(A, B, OutEdge, InIOIndex);
+			}
+			return;
+		}
+
+		const int32 NumEdges = InEdges.Num();
+		Edges.SetNumUninitialized(NumEdges);
+
+		PCGEX_PARALLEL_FOR(
+			NumEdges,
+			uint32 A;
+			uint32 B;
+			PCGEx::H64(InEdges[i], A, B);
+			check(A != B)
+			Edges[i] = FEdge(i, A, B, -1, InIOIndex);
+		)
+
+		UniqueEdges.Reserve(NumEdges);
+		for (int32 i = 0; i < NumEdges; i++)
+		{
+			UniqueEdges.Add(InEdges[i], i);
+
+			const FEdge& Edge = Edges[i];
+			Nodes[Edge.Start].LinkEdge(i);
+			Nodes[Edge.End].LinkEdge(i);
+		}
+	}
+
 	int32 FGraph::InsertEdges(const TArray<FEdge>& InEdges)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FGraph::InsertEdges)
@@ -257,85 +300,152 @@ namespace PCGExGraphs
 		const int32 NumNodes = Nodes.Num();
 		const int32 NumEdges = Edges.Num();
 
-		TArray<bool> VisitedNodes;
-		VisitedNodes.Init(false, NumNodes);
-		TArray<bool> VisitedEdges;
-		VisitedEdges.Init(false, NumEdges);
+		OutValidNodes.Reserve(NumNodes);
 
-		int32 VisitedNodesNum = 0;
-		int32 VisitedEdgesNum = 0;
+		// Connected components through a concurrent union-find.
+		// Roots are always linked under the smaller index, so each component ends up rooted at its lowest node index,
+		// regardless of the order in which edges are processed.
 
-		TArray<int32> Stack;
-		Stack.Reserve(NumNodes);
-		OutValidNodes.Reserve(NumNodes);
+		TArray<int32> Parent;
+		Parent.SetNumUninitialized(NumNodes);
+		PCGEX_PARALLEL_FOR(
+			NumNodes,
+			Parent[i] = i;
+			if (Nodes[i].IsEmpty()) { Nodes[i].bValid = false; }
+		)
 
-		for (int32 i = 0; i < NumNodes; i++)
+		int32* ParentData = Parent.GetData();
+
+		auto FindRoot = [ParentData](int32 Index)
 		{
-			FNode& CurrentNode = Nodes[i];
-			if (VisitedNodes[i])
+			while (true)
 			{
-				continue;
+				const int32 P = FPlatformAtomics::AtomicRead(&ParentData[Index]);
+				if (P == Index) { return Index; }
+
+				// Path halving; losing the race only means a longer path next time
+				const int32 GP = FPlatformAtomics::AtomicRead(&ParentData[P]);
+				if (GP != P) { FPlatformAtomics::InterlockedCompareExchange(&ParentData[Index], GP, P); }
+				Index = P;
 			}
+		};
+
+		TArray<int8> EdgeIsLinked;
+		EdgeIsLinked.SetNumUninitialized(NumEdges);
+
+		PCGEX_PARALLEL_FOR(
+			NumEdges,
+
+			const FEdge& Edge = Edges[i];
+			EdgeIsLinked[i] = Edge.bValid && Nodes[Edge.Start].bValid && Nodes[Edge.End].bValid;
+			if (!EdgeIsLinked[i]) { return; }
 
-			if (!CurrentNode.bValid || CurrentNode.IsEmpty())
+			int32 A = Edge.Start;
+			int32 B = Edge.End;
+
+			while (true)
 			{
-				CurrentNode.bValid = false;
-				continue;
+				A = FindRoot(A);
+				B = FindRoot(B);
+				if (A == B) { break; }
+				if (A < B) { Swap(A, B); }
+				if (FPlatformAtomics::InterlockedCompareExchange(&ParentData[A], B, A) == A) { break; }
 			}
+		)
+
+		// Flatten & size components exactly
 
-			Stack.Reset();
-			Stack.Add(i);
-			VisitedNodes[i] = true;
-			VisitedNodesNum++;
+		TArray<int32> NodeCounts;
+		TArray<int32> EdgeCounts;
+		NodeCounts.Init(0, NumNodes);
+		EdgeCounts.Init(0, NumNodes);
+
+		PCGEX_PARALLEL_FOR(
+			NumNodes,
+			Parent[i] = FindRoot(i);
+			FPlatformAtomics::InterlockedIncrement(&NodeCounts[Parent[i]]);
+		)
+
+		PCGEX_PARALLEL_FOR(
+			NumEdges,
+			if (EdgeIsLinked[i]) { FPlatformAtomics::InterlockedIncrement(&EdgeCounts[Parent[Edges[i].Start]]); }
+		)
+
+		// Components without any edge are isolated nodes and are dropped, as before.
+		// Components are ordered by root index, i.e. by their lowest node index.
+
+		TArray<int32> ComponentIndices;
+		ComponentIndices.Init(-1, NumNodes);
+
+		TArray<TSharedPtr<FSubGraph>> Components;
+		for (int32 i = 0; i < NumNodes; i++)
+		{
+			if (Parent[i] != i || EdgeCounts[i] == 0) { continue; }
+
+			ComponentIndices[i] = Components.Num();
 
 			TSharedPtr<FSubGraph> SubGraph = MakeShared<FSubGraph>();
 			SubGraph->WeakParentGraph = SharedThis(this);
-			SubGraph->Nodes.Reserve(NumNodes - VisitedNodesNum);
-			SubGraph->Edges.Reserve(NumEdges - VisitedEdgesNum);
+			SubGraph->Nodes.SetNumUninitialized(NodeCounts[i]);
+			SubGraph->Edges.SetNumUninitialized(EdgeCounts[i]);
+			Components.Add(SubGraph);
+		}
 
-			while (!Stack.IsEmpty())
-			{
-				const int32 NodeIndex = Stack.Pop(EAllowShrinking::No);
-				SubGraph->Nodes.Add(NodeIndex);
-				FNode& Node = Nodes[NodeIndex];
-				Node.NumExportedEdges = 0;
-
-				for (const FLink& Lk : Node.Links)
-				{
-					const int32 E = Lk.Edge;
-					if (VisitedEdges[E]) { continue; }
-
-					VisitedEdges[E] = true;
-					VisitedEdgesNum++;
-
-					FEdge& Edge = Edges[E];
-					if (!Edge.bValid) { continue; }
-
-					const int32 OtherIndex = Edge.Other(NodeIndex);
-					if (!Nodes[OtherIndex].bValid) { continue; }
-
-					SubGraph->Add(Edge);
-
-					if (!VisitedNodes[OtherIndex])
-					{
-						VisitedNodes[OtherIndex] = true;
-						VisitedNodesNum++;
-						Stack.Add(OtherIndex);
-					}
-				}
-			}
+		const int32 NumComponents = Components.Num();
+
+		// Fill in parallel, then restore a deterministic order within each component
+
+		TArray<int32> NodeCursors;
+		TArray<int32> EdgeCursors;
+		NodeCursors.Init(0, NumComponents);
+		EdgeCursors.Init(0, NumComponents);
+
+		PCGEX_PARALLEL_FOR(
+			NumNodes,
+			const int32 ComponentIndex = ComponentIndices[Parent[i]];
+			if (ComponentIndex == -1) { return; }
+			Components[ComponentIndex]->Nodes[FPlatformAtomics::InterlockedIncrement(&NodeCursors[ComponentIndex]) - 1] = i;
+		)
+
+		PCGEX_PARALLEL_FOR(
+			NumEdges,
+			if (!EdgeIsLinked[i]) { return; }
+			const FEdge& Edge = Edges[i];
+			const int32 ComponentIndex = ComponentIndices[Parent[Edge.Start]];
+			Components[ComponentIndex]->Edges[FPlatformAtomics::InterlockedIncrement(&EdgeCursors[ComponentIndex]) - 1] = PCGEx::FIndexKey(Edge.Index, Edge.H64U());
+		)
 
-			if (!Limits.IsValid(SubGraph->Nodes.Num(), SubGraph->Edges.Num()))
+		TArray<int8> ComponentIsValid;
+		ComponentIsValid.SetNumUninitialized(NumComponents);
+
+		PCGEX_PARALLEL_FOR_THRESHOLD(
+			NumComponents, 16,
+
+			const TSharedPtr<FSubGraph>& SubGraph = Components[i];
+			SubGraph->Nodes.Sort();
+			SubGraph->Edges.Sort([](const PCGEx::FIndexKey& A, const PCGEx::FIndexKey& B) { return A.Index < B.Index; });
+
+			ComponentIsValid[i] = Limits.IsValid(SubGraph->Nodes.Num(), SubGraph->Edges.Num());
+
+			if (!ComponentIsValid[i])
 			{
 				for (const int32 j : SubGraph->Nodes) { Nodes[j].bValid = false; }
-				for (const PCGEx::FIndexKey j : SubGraph->Edges) { Edges[j.Index].bValid = false; }
+				for (const PCGEx::FIndexKey& j : SubGraph->Edges) { Edges[j.Index].bValid = false; }
+				return;
 			}
-			else if (!SubGraph->Edges.IsEmpty())
+
+			for (const PCGEx::FIndexKey& j : SubGraph->Edges)
 			{
-				OutValidNodes.Append(SubGraph->Nodes);
-				SubGraph->Shrink();
-				SubGraphs.Add(SubGraph.ToSharedRef());
+				const int32 IOIndex = Edges[j.Index].IOIndex;
+				if (IOIndex >= 0) { SubGraph->EdgesInIOIndices.Add(IOIndex); }
 			}
+		)
+
+		for (int32 i = 0; i < NumComponents; i++)
+		{
+			if (!ComponentIsValid[i]) { continue; }
+			OutValidNodes.Append(Components[i]->Nodes);
+			SubGraphs.Add(Components[i].ToSharedRef());
 		}
 
 		// Recompute NumExportedEdges deterministically based on actual edge connections.
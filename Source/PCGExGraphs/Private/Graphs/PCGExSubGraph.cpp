@@ -51,6 +51,7 @@ namespace PCGExGraphTask
 			ClusterEdgesData->SetBoundCluster(NewCluster);
 
 			SubGraph->BuildCluster(NewCluster.ToSharedRef());
+			if (PCGEX_CORE_SETTINGS.bPersistClusterTopology) { ClusterEdgesData->PersistTopology(*NewCluster); }
 
 			// Build pre-configured caches
 			if (const TSharedPtr<PCGExGraphs::FGraphBuilder> Builder = SubGraph->GetBuilder())
@@ -5,6 +5,7 @@
 #include "Sorting/PCGExSortingHelpers.h"
 
 #include "PCGExH.h"
+#include "Core/PCGExMTCommon.h"
 
 #include "Async/ParallelFor.h"
 #include "Details/PCGExIntersectionDetails.h"
@@ -18,13 +19,54 @@
 #include "Graphs/PCGExGraph.h"
 #include "Graphs/PCGExGraphMetadata.h"
 #include "Math/PCGExMath.h"
+#include "Graphs/Union/PCGExFuseSeeds.h"
 
 namespace PCGExGraphs
 {
-	FUnionNode::FUnionNode(const PCGExData::FConstPoint& InPoint, const FVector& InCenter, const int32 InIndex)
-		: Point(InPoint), Center(InCenter), Index(InIndex), CenterAccum(InCenter)
+	void FUnionNodes::Reserve(const int32 InNum)
 	{
-		Bounds = FBoxSphereBounds(InPoint.Data->GetLocalBounds(InPoint.Index).TransformBy(InPoint.Data->GetTransform(InPoint.Index)));
+		Seeds.Reserve(InNum);
+		CenterAccums.Reserve(InNum);
+		FuseCounts.Reserve(InNum);
+	}
+
+	void FUnionNodes::Empty()
+	{
+		Seeds.Empty();
+		CenterAccums.Empty();
+		FuseCounts.Empty();
+	}
+
+	FBoxSphereBounds FUnionNodes::GetBounds(const int32 Index) const
+	{
+		const PCGExData::FConstPoint& Seed = Seeds[Index];
+		return FBoxSphereBounds(Seed.Data->GetLocalBounds(Seed.Index).TransformBy(Seed.Data->GetTransform(Seed.Index)));
+	}
+
+	void FUnionNodes::Reorder(const TArray<int32>& NewToOld)
+	{
+		const int32 N = NewToOld.Num();
+		check(N == Num());
+
+		TArray<PCGExData::FConstPoint> SortedSeeds;
+		TArray<FVector> SortedCenterAccums;
+		TArray<int32> SortedFuseCounts;
+
+		SortedSeeds.Reserve(N);
+		SortedCenterAccums.SetNumUninitialized(N);
+		SortedFuseCounts.SetNumUninitialized(N);
+
+		for (int32 i = 0; i < N; i++)
+		{
+			const int32 OldIndex = NewToOld[i];
+			SortedSeeds.Add(Seeds[OldIndex]);
+			SortedCenterAccums[i] = CenterAccums[OldIndex];
+			SortedFuseCounts[i] = FuseCounts[OldIndex];
+		}
+
+		Seeds = MoveTemp(SortedSeeds);
+		CenterAccums = MoveTemp(SortedCenterAccums);
+		FuseCounts = MoveTemp(SortedFuseCounts);
 	}
 
 	FUnionGraph::FUnionGraph(const FPCGExFuseDetails& InFuseDetails, const FBox& InBounds, const TSharedPtr<PCGExData::FPointIOCollection>& InSourceCollection)
@@ -36,10 +78,7 @@ namespace PCGExGraphs
 		NodesUnion = MakeShared<PCGExData::FUnionMetadata>();
 		EdgesUnion = MakeShared<PCGExData::FUnionMetadata>();
 
-		if (FuseDetails.GetEffectiveMethod() == EPCGExFuseMethod::Octree)
-		{
-			Octree = MakeUnique<FUnionNodeOctree>(Bounds.GetCenter(), Bounds.GetExtent().Length() + 10);
-		}
+		bDeferredInsertion = FuseDetails.GetEffectiveMethod() == EPCGExFuseMethod::Octree;
 	}
 
 	bool FUnionGraph::Init(FPCGExContext* InContext)
@@ -56,12 +95,14 @@ namespace PCGExGraphs
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FUnionGraph::Reserve);
 
-		if (!Octree) { NodeBinsShards.Reserve(NodeReserve); }
+		if (!bDeferredInsertion) { NodeBinsShards.Reserve(NodeReserve); }
 
 		Nodes.Reserve(NodeReserve);
 		NodesUnion->Entries.Reserve(NodeReserve);
 
 		const int32 EffectiveEdgeReserve = EdgeReserve < 0 ? NodeReserve : EdgeReserve;
+		if (bDeferredInsertion) { PendingEdges.Reserve(EffectiveEdgeReserve); }
+
 		EdgesMapShards.Reserve(EffectiveEdgeReserve);
 		Edges.Reserve(EffectiveEdgeReserve);
 		EdgesUnion->Entries.Reserve(EffectiveEdgeReserve);
@@ -69,73 +110,58 @@ namespace PCGExGraphs
 
 	int32 FUnionGraph::InsertPoint(const PCGExData::FConstPoint& Point)
 	{
+		if (bDeferredInsertion)
+		{
+			FWriteScopeLock WriteLock(UnionLock);
+			PendingPoints.Add(Point);
+			return -1;
+		}
+
 		const FVector Origin = Point.GetLocation();
+		const uint64 GridKey = FuseDetails.GetGridKey(Origin, Point.Index);
 
-		if (!Octree)
+		// Node arrays & bins only grow under the write lock, so holding the read lock is enough to find & append to an existing node.
+		// Union entries have their own lock; accumulation into the same node is serialized by a striped lock.
 		{
-			const uint64 GridKey = FuseDetails.GetGridKey(Origin, Point.Index);
-			{
-				if (const int32* NodePtr = NodeBinsShards.Find(GridKey))
-				{
-					const int32 NodeIndex = *NodePtr;
-					NodesUnion->Append(NodeIndex, Point);
-					Nodes[NodeIndex]->Accumulate(Origin);
-					return NodeIndex;
-				}
-			}
+			FReadScopeLock ReadLock(UnionLock);
 
+			if (const int32* NodePtr = AsConst(NodeBinsShards).Find(GridKey))
 			{
-				FWriteScopeLock WriteLock(UnionLock);
-
-				// Make sure there hasn't been an insert while locking
-				if (const int32* NodePtr = NodeBinsShards.Find(GridKey))
-				{
-					const int32 NodeIndex = *NodePtr;
-					NodesUnion->Append(NodeIndex, Point);
-					Nodes[NodeIndex]->Accumulate(Origin);
-					return NodeIndex;
-				}
+				const int32 NodeIndex = *NodePtr;
+				NodesUnion->Append(NodeIndex, Point);
 
-				NodesUnion->NewEntry_Unsafe(Point);
-				return NodeBinsShards.Add(GridKey, Nodes.Add(MakeShared<FUnionNode>(Point, Origin, Nodes.Num())));
+				FWriteScopeLock AccumulateLock(AccumulateLocks[NodeIndex & (NumAccumulateLocks - 1)]);
+				Nodes.Accumulate(NodeIndex, Origin);
+				return NodeIndex;
 			}
 		}
 
-		{
-			FWriteScopeLock WriteScopeLock(UnionLock);
-			PCGExMath::FClosestPosition ClosestNode(Origin);
-
-			Octree->FindElementsWithBoundsTest(FuseDetails.GetOctreeBox(Origin, Point.Index), [&](const FUnionNode* ExistingNode)
-			{
-				const bool bIsWithin = FuseDetails.bComponentWiseTolerance ? FuseDetails.IsWithinToleranceComponentWise(Point, ExistingNode->Point) : FuseDetails.IsWithinTolerance(Point, ExistingNode->Point);
-
-				if (bIsWithin)
-				{
-					ClosestNode.Update(ExistingNode->Center, ExistingNode->Index);
-					return false;
-				}
-				return true;
-			});
+		FWriteScopeLock WriteLock(UnionLock);
 
-			if (ClosestNode.bValid)
-			{
-				NodesUnion->Append(ClosestNode.Index, Point);
-				Nodes[ClosestNode.Index]->Accumulate(Origin);
-				return ClosestNode.Index;
-			}
-
-			// Still holding the lock -- safe to insert
-			const TSharedPtr<FUnionNode> Node = MakeShared<FUnionNode>(Point, Origin, Nodes.Num());
-			Octree->AddElement(Node.Get());
-			NodesUnion->NewEntry_Unsafe(Point);
-			return Nodes.Add(Node);
+		// Make sure there hasn't been an insert while locking
+		if (const int32* NodePtr = NodeBinsShards.Find(GridKey))
+		{
+			const int32 NodeIndex = *NodePtr;
+			NodesUnion->Append_Unsafe(NodeIndex, Point);
+			Nodes.Accumulate(NodeIndex, Origin);
+			return NodeIndex;
 		}
+
+		NodesUnion->NewEntry_Unsafe(Point);
+		return NodeBinsShards.Add(GridKey, Nodes.Add(Point, Origin));
 	}
 
 	void FUnionGraph::InsertEdge(const PCGExData::FConstPoint& From, const PCGExData::FConstPoint& To, const PCGExData::FConstPoint& Edge)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(IUnionData::InsertEdge);
 
+		if (bDeferredInsertion)
+		{
+			FWriteScopeLock WriteLock(UnionLock);
+			PendingEdges.Emplace(From, To, Edge);
+			return;
+		}
+
 		const int32 Start = InsertPoint(From);
 		const int32 End = InsertPoint(To);
 
@@ -172,14 +198,168 @@ namespace PCGExGraphs
 		}
 	}
 
+	void FUnionGraph::ResolvePending()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FUnionGraph::ResolvePending);
+
+		if (!bDeferredInsertion || (PendingPoints.IsEmpty() && PendingEdges.IsEmpty())) { return; }
+
+		// 1. Deterministic insertion order, regardless of which thread recorded what
+
+		PendingPoints.Sort([](const PCGExData::FConstPoint& A, const PCGExData::FConstPoint& B) { return A.IO < B.IO || (A.IO == B.IO && A.Index < B.Index); });
+		PendingEdges.Sort(
+			[](const FPendingEdge& A, const FPendingEdge& B)
+			{
+				if (A.Edge.IO != B.Edge.IO) { return A.Edge.IO < B.Edge.IO; }
+				if (A.Edge.Index != B.Edge.Index) { return A.Edge.Index < B.Edge.Index; }
+				if (A.From.IO != B.From.IO) { return A.From.IO < B.From.IO; }
+				if (A.From.Index != B.From.Index) { return A.From.Index < B.From.Index; }
+				if (A.To.IO != B.To.IO) { return A.To.IO < B.To.IO; }
+				return A.To.Index < B.To.Index;
+			});
+
+		// 2. Flatten into insertion slots (standalone points, then edge endpoints), and find unique points
+		// Radix sort is stable, so each group of identical points is sorted by slot and starts with its first occurrence
+
+		const int32 NumPendingPoints = PendingPoints.Num();
+		const int32 NumSlots = NumPendingPoints + PendingEdges.Num() * 2;
+
+		auto GetSlotPoint = [&](const int32 Slot) -> const PCGExData::FConstPoint&
+		{
+			if (Slot < NumPendingPoints) { return PendingPoints[Slot]; }
+			const FPendingEdge& PendingEdge = PendingEdges[(Slot - NumPendingPoints) >> 1];
+			return ((Slot - NumPendingPoints) & 1) ? PendingEdge.To : PendingEdge.From;
+		};
+
+		TArray<PCGEx::FIndexKey> SlotKeys;
+		SlotKeys.SetNumUninitialized(NumSlots);
+		PCGEX_PARALLEL_FOR(
+			NumSlots,
+			const PCGExData::FConstPoint& Point = GetSlotPoint(i);
+			SlotKeys[i] = PCGEx::FIndexKey(i, PCGEx::H64(Point.IO, Point.Index));
+		)
+
+		PCGExSortingHelpers::RadixSort(SlotKeys);
+
+		TArray<int32> SlotFirst;
+		SlotFirst.SetNumUninitialized(NumSlots);
+		for (int32 i = 0, GroupStart = 0; i < NumSlots; i++)
+		{
+			if (SlotKeys[i].Key != SlotKeys[GroupStart].Key) { GroupStart = i; }
+			SlotFirst[SlotKeys[i].Index] = SlotKeys[GroupStart].Index;
+		}
+
+		SlotKeys.Empty();
+
+		// Unique points, ranked by first occurrence -- that's the order serial insertion would have seen them in
+		TArray<int32> SlotRank;
+		SlotRank.SetNumUninitialized(NumSlots);
+
+		TArray<PCGExData::FConstPoint> Points;
+		Points.Reserve(NumSlots);
+
+		for (int32 i = 0; i < NumSlots; i++)
+		{
+			if (SlotFirst[i] == i) { SlotRank[i] = Points.Add(GetSlotPoint(i)); }
+			else { SlotRank[i] = SlotRank[SlotFirst[i]]; }
+		}
+
+		const int32 NumPoints = Points.Num();
+
+		// 3. Gather positions, tolerances and seed bounds
+
+		TArray<FVector> Origins;
+		TArray<FVector> Tolerances;
+		TArray<FVector> BoundsCenters;
+		TArray<FVector> BoundsExtents;
+
+		Origins.SetNumUninitialized(NumPoints);
+		Tolerances.SetNumUninitialized(NumPoints);
+		BoundsCenters.SetNumUninitialized(NumPoints);
+		BoundsExtents.SetNumUninitialized(NumPoints);
+
+		PCGEX_PARALLEL_FOR(
+			NumPoints,
+			const PCGExData::FConstPoint& Point = Points[i];
+			const FBox PointBounds = Point.Data->GetLocalBounds(Point.Index).TransformBy(Point.Data->GetTransform(Point.Index));
+			Origins[i] = Point.GetLocation();
+			Tolerances[i] = FuseDetails.GetLocalTolerance(Point.Index);
+			BoundsCenters[i] = PointBounds.GetCenter();
+			BoundsExtents[i] = PointBounds.GetExtent();
+		)
+
+		// 4. Seeds & closest seed of every other point, see PCGExGraphs::Fuse::ResolveSeeds
+
+		const bool bComponentWise = FuseDetails.bComponentWiseTolerance;
+		auto IsWithinTolerance = [&](const int32 Seed, const int32 Rank)
+		{
+			return bComponentWise ? FuseDetails.IsWithinToleranceComponentWise(Points[Rank], Points[Seed]) : FuseDetails.IsWithinTolerance(Points[Rank], Points[Seed]);
+		};
+
+		TArray<int32> SeedIndex;
+		TArray<int32> PointSeed;
+		const int32 NumNewNodes = Fuse::ResolveSeeds(Fuse::FSeedInputs{Origins, Tolerances, BoundsCenters, BoundsExtents}, IsWithinTolerance, SeedIndex, PointSeed);
+
+		const int32 NodeOffset = Nodes.Num();
+
+		TArray<int32> SeedNode;
+		TArray<int32> PointNode;
+		SeedNode.SetNumUninitialized(NumPoints);
+		PointNode.SetNumUninitialized(NumPoints);
+
+		for (int32 i = 0; i < NumPoints; i++)
+		{
+			SeedNode[i] = SeedIndex[i] == -1 ? -1 : NodeOffset + SeedIndex[i];
+			PointNode[i] = NodeOffset + SeedIndex[PointSeed[i]];
+		}
+
+		// 5. Build nodes & unions. Every extra occurrence of a point is accumulated, as serial insertion would.
+
+		Nodes.Reserve(NodeOffset + NumNewNodes);
+		NodesUnion->Entries.Reserve(NodeOffset + NumNewNodes);
+
+		for (int32 i = 0; i < NumPoints; i++)
+		{
+			if (SeedNode[i] == -1) { continue; }
+			NodesUnion->NewEntry_Unsafe(Points[i]);
+			Nodes.Add(Points[i], Origins[i]);
+		}
+
+		for (int32 i = 0; i < NumSlots; i++)
+		{
+			const int32 Rank = SlotRank[i];
+			if (SlotFirst[i] == i && SeedNode[Rank] != -1) { continue; }
+
+			const int32 NodeIndex = PointNode[Rank];
+			NodesUnion->Append_Unsafe(NodeIndex, Points[Rank]);
+			Nodes.Accumulate(NodeIndex, Origins[Rank]);
+		}
+
+		// 6. Edges, in insertion order
+
+		for (int32 i = 0; i < PendingEdges.Num(); i++)
+		{
+			const int32 Slot = NumPendingPoints + i * 2;
+			const int32 Start = PointNode[SlotRank[Slot]];
+			const int32 End = PointNode[SlotRank[Slot + 1]];
+
+			if (Start == End) { continue; }
+			InsertEdge_Unsafe(Start, End, PendingEdges[i].Edge);
+		}
+
+		PendingPoints.Empty();
+		PendingEdges.Empty();
+	}
+
 	void FUnionGraph::WriteNodeMetadata(const TSharedPtr<FGraph>& InGraph) const
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FUnionGraph::WriteNodeMetadata)
 
-		for (const TSharedPtr<FUnionNode>& Node : Nodes)
+		const int32 NumNodes = Nodes.Num();
+		for (int32 i = 0; i < NumNodes; i++)
 		{
-			const TSharedPtr<PCGExData::IUnionData>& UnionData = NodesUnion->Entries[Node->Index];
-			FGraphNodeMetadata& NodeMeta = InGraph->GetOrCreateNodeMetadata_Unsafe(Node->Index);
+			const TSharedPtr<PCGExData::IUnionData>& UnionData = NodesUnion->Entries[i];
+			FGraphNodeMetadata& NodeMeta = InGraph->GetOrCreateNodeMetadata_Unsafe(i);
 			NodeMeta.UnionSize = UnionData->Num();
 		}
 	}
@@ -202,7 +382,6 @@ namespace PCGExGraphs
 		NumCollapsedEdges = Edges.Num();
 		EdgesMapShards.Empty();
 		NodeBinsShards.Empty();
-		Octree.Reset();
 
 		// Spatial sort nodes by Morton hash for deterministic ordering
 		const int32 N = Nodes.Num();
@@ -217,29 +396,25 @@ namespace PCGExGraphs
 		MortonHash.SetNumUninitialized(N);
 		for (int32 i = 0; i < N; i++)
 		{
-			MortonHash[i] = PCGEx::FIndexKey(i, PCGEx::MH64(Nodes[i]->GetCenter()));
+			MortonHash[i] = PCGEx::FIndexKey(i, PCGEx::MH64(Nodes.GetCenter(i)));
 		}
 
 		// 2. Sort
 		PCGExSortingHelpers::RadixSort(MortonHash);
 
-		// 3. Build old->new remap
+		// 3. Build old->new & new->old remaps
 		TArray<int32> OldToNew;
+		TArray<int32> NewToOld;
 		OldToNew.SetNumUninitialized(N);
+		NewToOld.SetNumUninitialized(N);
 		for (int32 i = 0; i < N; i++)
 		{
 			OldToNew[MortonHash[i].Index] = i;
+			NewToOld[i] = MortonHash[i].Index;
 		}
 
 		// 4. Reorder Nodes
-		TArray<TSharedPtr<FUnionNode>> SortedNodes;
-		SortedNodes.SetNum(N);
-		for (int32 i = 0; i < N; i++)
-		{
-			SortedNodes[i] = Nodes[MortonHash[i].Index];
-			SortedNodes[i]->Index = i;
-		}
-		Nodes = MoveTemp(SortedNodes);
+		Nodes.Reorder(NewToOld);
 
 		// 5. Remap edges
 		for (FEdge& Edge : Edges)
@@ -253,7 +428,7 @@ namespace PCGExGraphs
 		SortedEntries.SetNum(N);
 		for (int32 i = 0; i < N; i++)
 		{
-			SortedEntries[i] = NodesUnion->Entries[MortonHash[i].Index];
+			SortedEntries[i] = NodesUnion->Entries[NewToOld[i]];
 		}
 		NodesUnion->Entries = MoveTemp(SortedEntries);
 
@@ -262,73 +437,82 @@ namespace PCGExGraphs
 
 #pragma region FBatchInserter
 
-	int32 FUnionGraph::FBatchInserter::InsertPoint(const PCGExData::FConstPoint& Point)
+	FUnionGraph::FBatchInserter::FBatchInserter(FUnionGraph& InGraph)
+		: Graph(InGraph), bDeferred(InGraph.bDeferredInsertion)
 	{
-		const FVector Origin = Point.GetLocation();
+		if (bDeferred) { return; }
+		Graph.UnionLock.WriteLock();
+		Graph.EdgesLock.WriteLock();
+	}
 
-		if (!Graph.Octree)
+	FUnionGraph::FBatchInserter::~FBatchInserter()
+	{
+		if (!bDeferred)
 		{
-			const uint64 GridKey = Graph.FuseDetails.GetGridKey(Origin, Point.Index);
-
-			if (const int32* NodePtr = Graph.NodeBinsShards.Find(GridKey))
-			{
-				const int32 NodeIndex = *NodePtr;
-				Graph.NodesUnion->Append_Unsafe(NodeIndex, Point);
-				Graph.Nodes[NodeIndex]->Accumulate(Origin);
-				return NodeIndex;
-			}
-
-			Graph.NodesUnion->NewEntry_Unsafe(Point);
-			return Graph.NodeBinsShards.Add(GridKey, Graph.Nodes.Add(MakeShared<FUnionNode>(Point, Origin, Graph.Nodes.Num())));
+			Graph.EdgesLock.WriteUnlock();
+			Graph.UnionLock.WriteUnlock();
+			return;
 		}
 
-		PCGExMath::FClosestPosition ClosestNode(Origin);
+		if (PendingPoints.IsEmpty() && PendingEdges.IsEmpty()) { return; }
 
-		Graph.Octree->FindElementsWithBoundsTest(Graph.FuseDetails.GetOctreeBox(Origin, Point.Index), [&](const FUnionNode* ExistingNode)
+		FWriteScopeLock WriteLock(Graph.UnionLock);
+		Graph.PendingPoints.Append(PendingPoints);
+		Graph.PendingEdges.Append(PendingEdges);
+	}
+
+	int32 FUnionGraph::FBatchInserter::InsertPoint(const PCGExData::FConstPoint& Point)
+	{
+		if (bDeferred)
 		{
-			const bool bIsWithin = Graph.FuseDetails.bComponentWiseTolerance ? Graph.FuseDetails.IsWithinToleranceComponentWise(Point, ExistingNode->Point) : Graph.FuseDetails.IsWithinTolerance(Point, ExistingNode->Point);
+			PendingPoints.Add(Point);
+			return -1;
+		}
 
-			if (bIsWithin)
-			{
-				ClosestNode.Update(ExistingNode->Center, ExistingNode->Index);
-				return false;
-			}
-			return true;
-		});
+		const FVector Origin = Point.GetLocation();
+		const uint64 GridKey = Graph.FuseDetails.GetGridKey(Origin, Point.Index);
 
-		if (ClosestNode.bValid)
+		if (const int32* NodePtr = Graph.NodeBinsShards.Find(GridKey))
 		{
-			Graph.NodesUnion->Append_Unsafe(ClosestNode.Index, Point);
-			Graph.Nodes[ClosestNode.Index]->Accumulate(Origin);
-			return ClosestNode.Index;
+			const int32 NodeIndex = *NodePtr;
+			Graph.NodesUnion->Append_Unsafe(NodeIndex, Point);
+			Graph.Nodes.Accumulate(NodeIndex, Origin);
+			return NodeIndex;
 		}
 
-		const TSharedPtr<FUnionNode> Node = MakeShared<FUnionNode>(Point, Origin, Graph.Nodes.Num());
-		Graph.Octree->AddElement(Node.Get());
 		Graph.NodesUnion->NewEntry_Unsafe(Point);
-		return Graph.Nodes.Add(Node);
+		return Graph.NodeBinsShards.Add(GridKey, Graph.Nodes.Add(Point, Origin));
 	}
 
 	void FUnionGraph::FBatchInserter::InsertEdge(const PCGExData::FConstPoint& From, const PCGExData::FConstPoint& To, const PCGExData::FConstPoint& Edge)
 	{
+		if (bDeferred)
+		{
+			PendingEdges.Emplace(From, To, Edge);
+			return;
+		}
+
 		const int32 Start = InsertPoint(From);
 		const int32 End = InsertPoint(To);
 
 		if (Start == End) { return; }
+		Graph.InsertEdge_Unsafe(Start, End, Edge);
+	}
 
-		TSharedPtr<PCGExData::IUnionData> EdgeUnion;
+	void FUnionGraph::InsertEdge_Unsafe(const int32 Start, const int32 End, const PCGExData::FConstPoint& Edge)
+	{
 		const uint64 H = PCGEx::H64U(Start, End);
 
-		if (const int32* ExistingEdge = Graph.EdgesMapShards.Find(H))
+		if (const int32* ExistingEdge = EdgesMapShards.Find(H))
 		{
-			EdgeUnion = Graph.EdgesUnion->Entries[*ExistingEdge];
+			const TSharedPtr<PCGExData::IUnionData>& EdgeUnion = EdgesUnion->Entries[*ExistingEdge];
 			if (Edge.IO == -1) { EdgeUnion->Add_Unsafe(EdgeUnion->Num(), -1); }
 			else { EdgeUnion->Add_Unsafe(Edge); }
 			return;
 		}
 
-		EdgeUnion = Graph.EdgesUnion->NewEntry_Unsafe(Edge);
-		Graph.EdgesMapShards.Add(H, Graph.Edges.Emplace(Graph.Edges.Num(), Start, End));
+		EdgesUnion->NewEntry_Unsafe(Edge);
+		EdgesMapShards.Add(H, Edges.Emplace(Edges.Num(), Start, End));
 	}
 
 #pragma endregion
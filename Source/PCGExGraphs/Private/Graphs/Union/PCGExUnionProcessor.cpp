@@ -48,6 +48,8 @@ namespace PCGExGraphs
 	{
 		BuilderDetails = InBuilderDetails;
 
+		UnionGraph->ResolvePending();
+
 		const int32 NumUnionNodes = UnionGraph->Nodes.Num();
 		if (NumUnionNodes == 0)
 		{
@@ -94,15 +96,7 @@ namespace PCGExGraphs
 
 			PCGEX_SCOPE_LOOP(Index)
 			{
-				TSharedPtr<FUnionNode> UnionNode = This->UnionGraph->Nodes[Index];
-
-				//const PCGMetadataEntryKey Key = OutPoints[i].MetadataEntry;
-				//OutPoints[Index] = UnionNode->Point; // Copy "original" point properties, in case  there's only one
-
-				//FPCGPoint& Point = OutPoints[Index];
-				//Point.MetadataEntry = Key; // Restore key
-
-				OutTransforms[Index].SetLocation(UnionNode->GetCenter());
+				OutTransforms[Index].SetLocation(This->UnionGraph->Nodes.GetCenter(Index));
 				Blender->MergeSingle(Index, WeightedPoints, Trackers);
 			}
 		};
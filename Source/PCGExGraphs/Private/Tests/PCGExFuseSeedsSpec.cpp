@@ -0,0 +1,107 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Graphs/Union/PCGExFuseSeeds.h"
+
+BEGIN_DEFINE_SPEC(FPCGExFuseSeedsSpec, "PCGEx.Graphs.Union.FuseSeeds", EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+	TArray<FVector> Origins;
+	TArray<FVector> Tolerances;
+	TArray<FVector> BoundsCenters;
+	TArray<FVector> BoundsExtents;
+
+	void MakePoints(const int32 NumPoints, const double Spread, const double Tolerance, const double Extent, const int32 NumOutliers, const int32 Seed)
+	{
+		FRandomStream Random(Seed);
+		const FBox Box(FVector(-Spread), FVector(Spread));
+
+		Origins.SetNum(NumPoints);
+		Tolerances.SetNum(NumPoints);
+		BoundsCenters.SetNum(NumPoints);
+		BoundsExtents.SetNum(NumPoints);
+
+		for (int32 i = 0; i < NumPoints; i++)
+		{
+			// Some exact duplicates, so ties on distance get exercised
+			Origins[i] = (i > 0 && Random.FRand() < 0.1) ? Origins[Random.RandHelper(i)] : Random.RandPointInBox(Box);
+			Tolerances[i] = FVector(Tolerance * Random.FRandRange(0.5, 1));
+			BoundsCenters[i] = Origins[i];
+			BoundsExtents[i] = FVector(Extent * Random.FRandRange(0.5, 1));
+		}
+
+		for (int32 i = 0; i < NumOutliers; i++) { BoundsExtents[Random.RandHelper(NumPoints)] = FVector(Spread * Random.FRandRange(0.25, 1)); }
+	}
+
+	// The grid resolution must give the exact same seeds & assignments as testing every point against every earlier seed
+	void TestAgainstReference(const FString& What)
+	{
+		const PCGExGraphs::Fuse::FSeedInputs In{Origins, Tolerances, BoundsCenters, BoundsExtents};
+		auto IsWithinTolerance = [&](const int32 Seed, const int32 Rank) { return FVector::DistSquared(Origins[Rank], Origins[Seed]) <= FMath::Square(Tolerances[Rank].X); };
+
+		TArray<int32> SeedIndex;
+		TArray<int32> PointSeed;
+		const int32 NumSeeds = PCGExGraphs::Fuse::ResolveSeeds(In, IsWithinTolerance, SeedIndex, PointSeed);
+
+		TArray<int32> RefSeedIndex;
+		TArray<int32> RefPointSeed;
+		const int32 RefNumSeeds = PCGExGraphs::Fuse::ResolveSeeds_Reference(In, IsWithinTolerance, RefSeedIndex, RefPointSeed);
+
+		TestEqual(What + TEXT(" : seed count"), NumSeeds, RefNumSeeds);
+
+		int32 NumMismatches = 0;
+		for (int32 i = 0; i < In.Num(); i++)
+		{
+			if ((SeedIndex[i] != RefSeedIndex[i] || PointSeed[i] != RefPointSeed[i]) && NumMismatches++ < 5)
+			{
+				AddError(FString::Printf(TEXT("%s : point %d resolved to seed %d (index %d), reference is %d (index %d)."), *What, i, PointSeed[i], SeedIndex[i], RefPointSeed[i], RefSeedIndex[i]));
+			}
+		}
+
+		TestEqual(What + TEXT(" : points differing from the reference"), NumMismatches, 0);
+	}
+
+END_DEFINE_SPEC(FPCGExFuseSeedsSpec)
+
+void FPCGExFuseSeedsSpec::Define()
+{
+	Describe("ResolveSeeds", [this]()
+	{
+		It("matches the reference on sparse points", [this]()
+		{
+			MakePoints(2000, 5000, 50, 5, 0, 1);
+			TestAgainstReference(TEXT("Sparse"));
+		});
+
+		It("matches the reference on dense points", [this]()
+		{
+			MakePoints(2000, 500, 50, 20, 0, 2);
+			TestAgainstReference(TEXT("Dense"));
+		});
+
+		It("matches the reference with large-extent outliers", [this]()
+		{
+			MakePoints(2000, 2000, 30, 10, 20, 3);
+			TestAgainstReference(TEXT("Outliers"));
+		});
+
+		It("matches the reference with zero tolerance & extents", [this]()
+		{
+			MakePoints(1000, 100, 0, 0, 0, 4);
+			TestAgainstReference(TEXT("Degenerate"));
+		});
+
+		It("handles empty inputs", [this]()
+		{
+			MakePoints(0, 100, 10, 10, 0, 5);
+
+			TArray<int32> SeedIndex;
+			TArray<int32> PointSeed;
+			TestEqual(TEXT("Seed count"), PCGExGraphs::Fuse::ResolveSeeds(PCGExGraphs::Fuse::FSeedInputs{Origins, Tolerances, BoundsCenters, BoundsExtents}, [](int32, int32) { return true; }, SeedIndex, PointSeed), 0);
+		});
+	});
+}
+
+#endif
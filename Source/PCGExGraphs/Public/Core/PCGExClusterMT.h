@@ -6,6 +6,7 @@
 #include "PCGExCommon.h"
 #include "Clusters/PCGExEdgeDirectionDetails.h"
 #include "Core/PCGExContext.h"
+#include "Core/PCGExMTCommon.h"
 #include "Graphs/PCGExGraphDetails.h"
 #include "Math/PCGExProjectionDetails.h"
 #include "PCGExHeuristicsHandler.h"
@@ -248,6 +249,9 @@ namespace PCGExClusterMT
 		TArray<TSharedRef<IProcessor>> Processors;
 		int32 GetNumProcessors() const { return Processors.Num(); }
 
+		TArray<int32> BundledProcessors;
+		TArray<PCGExMT::FScope> ProcessorBundles;
+
 		bool bIsBatchValid = true;
 		FPCGExContext* ExecutionContext = nullptr;
 		UPCGSettings* ExecutionSettings = nullptr;
@@ -65,6 +65,9 @@ namespace PCGExGraphs
 		void InsertEdges(const TSet<uint64>& InEdges, int32 InIOIndex);
 
 		void InsertEdges(const TArray<uint64>& InEdges, int32 InIOIndex);
+
+		/** Insert edges known to be sorted & unique (i.e from PCGExSortingHelpers::SortUnique). Skips per-edge hash checks when the graph has no edges yet. */
+		void InsertSortedUniqueEdges(const TArray<uint64>& InEdges, int32 InIOIndex);
 		int32 InsertEdges(const TArray<FEdge>& InEdges);
 
 		/** Bulk-adopt pre-deduplicated edges without hash checking. Edges are guaranteed unique from FUnionGraph. */
@@ -0,0 +1,223 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/PCGExMTCommon.h"
+
+#include <algorithm>
+
+namespace PCGExGraphs::Fuse
+{
+	/** Per-point inputs of precise fuse resolution, indexed by insertion rank. */
+	struct FSeedInputs
+	{
+		TConstArrayView<FVector> Origins;
+		TConstArrayView<FVector> Tolerances;    // Per-axis query tolerance of each point
+		TConstArrayView<FVector> BoundsCenters; // World bounds of each point, as a seed
+		TConstArrayView<FVector> BoundsExtents;
+
+		int32 Num() const { return Origins.Num(); }
+	};
+
+	FORCEINLINE FInt64Vector3 GetCell(const FVector& Position, const double CellSize)
+	{
+		return FInt64Vector3(
+			FMath::FloorToInt64(Position.X / CellSize),
+			FMath::FloorToInt64(Position.Y / CellSize),
+			FMath::FloorToInt64(Position.Z / CellSize));
+	}
+
+	FORCEINLINE uint64 GetCellKey(const FInt64Vector3& Cell) { return GetTypeHash(Cell); }
+
+	/**
+	 * A seed accepts a point if the point query box overlaps the seed bounds (as an octree query would), and the pair is within tolerance.
+	 * @param IsWithinTolerance (int32 Seed, int32 Rank) -> bool
+	 */
+	template <typename ToleranceFunc>
+	FORCEINLINE bool Accepts(const FSeedInputs& In, const int32 Seed, const int32 Rank, ToleranceFunc&& IsWithinTolerance)
+	{
+		const FVector Delta = (In.Origins[Rank] - In.BoundsCenters[Seed]).GetAbs();
+		const FVector& Tolerance = In.Tolerances[Rank];
+		const FVector& SeedExtent = In.BoundsExtents[Seed];
+		if (Delta.X > Tolerance.X + SeedExtent.X || Delta.Y > Tolerance.Y + SeedExtent.Y || Delta.Z > Tolerance.Z + SeedExtent.Z) { return false; }
+		return IsWithinTolerance(Seed, Rank);
+	}
+
+	/** Closest accepting seed of the point at Rank, lowest rank first on ties; -1 if none. ForEachSeed is (Rank, (Seed) -> bool). */
+	template <typename ForEachSeedFunc>
+	int32 FindClosestSeed(const FSeedInputs& In, const int32 Rank, ForEachSeedFunc&& ForEachSeed)
+	{
+		int32 Best = -1;
+		double BestDist = MAX_dbl;
+
+		ForEachSeed(
+			Rank, [&](const int32 Seed)
+			{
+				const double Dist = FVector::DistSquared(In.Origins[Rank], In.Origins[Seed]);
+				if (Dist < BestDist || (Dist == BestDist && Seed < Best))
+				{
+					BestDist = Dist;
+					Best = Seed;
+				}
+				return true;
+			});
+
+		return Best;
+	}
+
+	/**
+	 * Precise fuse resolution, in rank order : a point starts a new node if no earlier seed accepts it,
+	 * every other point joins the closest accepting seed. Matches serial insertion against an octree of seeds.
+	 * Seeds are binned into a grid sized from tolerance & the typical (median) point extent; points with outlying extents
+	 * go to a separate bucket instead, so a single large-bounds point can't collapse the grid into one cell.
+	 * @param IsWithinTolerance (int32 Seed, int32 Rank) -> bool; must be safe to call concurrently
+	 * @param OutSeedIndex Per point, its index among seeds if it starts a node, -1 otherwise
+	 * @param OutPointSeed Per point, the rank of the seed it joins (itself for seeds)
+	 * @return Number of seeds
+	 */
+	template <typename ToleranceFunc>
+	int32 ResolveSeeds(const FSeedInputs& In, ToleranceFunc&& IsWithinTolerance, TArray<int32>& OutSeedIndex, TArray<int32>& OutPointSeed)
+	{
+		const int32 NumPoints = In.Num();
+
+		OutSeedIndex.Init(-1, NumPoints);
+		OutPointSeed.SetNumUninitialized(NumPoints);
+
+		if (!NumPoints) { return 0; }
+
+		double MaxTolerance = 0;
+		for (int32 i = 0; i < NumPoints; i++) { MaxTolerance = FMath::Max(MaxTolerance, In.Tolerances[i].GetMax()); }
+
+		double TypicalExtent = 0;
+		{
+			TArray<double> Extents;
+			Extents.SetNumUninitialized(NumPoints);
+			for (int32 i = 0; i < NumPoints; i++) { Extents[i] = In.BoundsExtents[i].GetMax(); }
+
+			const int32 Median = NumPoints / 2;
+			std::nth_element(Extents.GetData(), Extents.GetData() + Median, Extents.GetData() + NumPoints);
+			TypicalExtent = Extents[Median];
+		}
+
+		const double ExtentLimit = FMath::Max(TypicalExtent * 2, MaxTolerance);
+		const double CellSize = FMath::Max(MaxTolerance + ExtentLimit, UE_KINDA_SMALL_NUMBER);
+
+		TMap<uint64, int32> CellHeads; // Most recent seed of each cell
+		TArray<int32> NextInCell;      // Previous seed in the same cell
+		TArray<int32> LargeSeeds;      // Outlying extents, in rank order
+
+		NextInCell.Init(-1, NumPoints);
+
+		// Visits earlier seeds accepting the point at Rank; stops when Func returns false
+		auto ForEachAcceptingSeed = [&](const int32 Rank, auto&& Func)
+		{
+			const FVector& Origin = In.Origins[Rank];
+			const FVector Reach = In.Tolerances[Rank] + FVector(ExtentLimit);
+			const FInt64Vector3 CellMin = GetCell(Origin - Reach, CellSize);
+			const FInt64Vector3 CellMax = GetCell(Origin + Reach, CellSize);
+
+			TArray<uint64, TInlineAllocator<27>> VisitedKeys;
+
+			for (int64 X = CellMin.X; X <= CellMax.X; X++)
+			{
+				for (int64 Y = CellMin.Y; Y <= CellMax.Y; Y++)
+				{
+					for (int64 Z = CellMin.Z; Z <= CellMax.Z; Z++)
+					{
+						const uint64 Key = GetCellKey(FInt64Vector3(X, Y, Z));
+						if (VisitedKeys.Contains(Key)) { continue; }
+						VisitedKeys.Add(Key);
+
+						const int32* HeadPtr = CellHeads.Find(Key);
+						if (!HeadPtr) { continue; }
+
+						for (int32 Seed = *HeadPtr; Seed != -1; Seed = NextInCell[Seed])
+						{
+							if (Seed < Rank && Accepts(In, Seed, Rank, IsWithinTolerance) && !Func(Seed)) { return; }
+						}
+					}
+				}
+			}
+
+			for (const int32 Seed : LargeSeeds)
+			{
+				if (Seed >= Rank) { return; }
+				if (Accepts(In, Seed, Rank, IsWithinTolerance) && !Func(Seed)) { return; }
+			}
+		};
+
+		// Seeds. Inherently sequential, but each point is only tested against nearby seeds.
+
+		int32 NumSeeds = 0;
+		for (int32 i = 0; i < NumPoints; i++)
+		{
+			bool bCovered = false;
+			ForEachAcceptingSeed(
+				i, [&](const int32)
+				{
+					bCovered = true;
+					return false;
+				});
+
+			if (bCovered) { continue; }
+
+			OutSeedIndex[i] = NumSeeds++;
+
+			if (In.BoundsExtents[i].GetMax() > ExtentLimit)
+			{
+				LargeSeeds.Add(i);
+				continue;
+			}
+
+			int32& Head = CellHeads.FindOrAdd(GetCellKey(GetCell(In.BoundsCenters[i], CellSize)), -1);
+			NextInCell[i] = Head;
+			Head = i;
+		}
+
+		// Every other point joins the closest accepting seed
+
+		PCGEX_PARALLEL_FOR(
+			NumPoints,
+			OutPointSeed[i] = OutSeedIndex[i] != -1 ? i : FindClosestSeed(In, i, ForEachAcceptingSeed);
+		)
+
+		return NumSeeds;
+	}
+
+	/** Brute-force reference of ResolveSeeds, testing every point against every earlier seed. O(N²), meant for tests. */
+	template <typename ToleranceFunc>
+	int32 ResolveSeeds_Reference(const FSeedInputs& In, ToleranceFunc&& IsWithinTolerance, TArray<int32>& OutSeedIndex, TArray<int32>& OutPointSeed)
+	{
+		const int32 NumPoints = In.Num();
+
+		OutSeedIndex.Init(-1, NumPoints);
+		OutPointSeed.SetNumUninitialized(NumPoints);
+
+		auto ForEachAcceptingSeed = [&](const int32 Rank, auto&& Func)
+		{
+			for (int32 Seed = 0; Seed < Rank; Seed++)
+			{
+				if (OutSeedIndex[Seed] != -1 && Accepts(In, Seed, Rank, IsWithinTolerance) && !Func(Seed)) { return; }
+			}
+		};
+
+		int32 NumSeeds = 0;
+		for (int32 i = 0; i < NumPoints; i++)
+		{
+			const int32 Seed = FindClosestSeed(In, i, ForEachAcceptingSeed);
+			if (Seed == -1)
+			{
+				OutSeedIndex[i] = NumSeeds++;
+				OutPointSeed[i] = i;
+			}
+			else
+			{
+				OutPointSeed[i] = Seed;
+			}
+		}
+
+		return NumSeeds;
+	}
+}
@@ -52,41 +52,71 @@ namespace PCGExGraphs
 
 #pragma region Compound Graph
 
-	class PCGEXGRAPHS_API FUnionNode : public TSharedFromThis<FUnionNode>
+	/**
+	 * Union nodes, stored as parallel arrays indexed by node index.
+	 * Each node keeps the point that seeded it and a running sum of fused positions; bounds are computed on demand.
+	 */
+	class PCGEXGRAPHS_API FUnionNodes
 	{
 	public:
-		const PCGExData::FConstPoint Point;
-		FVector Center;
-		FBoxSphereBounds Bounds;
-		int32 Index;
+		TArray<PCGExData::FConstPoint> Seeds;
+		TArray<FVector> CenterAccums;
+		TArray<int32> FuseCounts;
 
-		FVector CenterAccum;
-		int32 FuseCount = 1;
+		FUnionNodes() = default;
 
-		FUnionNode(const PCGExData::FConstPoint& InPoint, const FVector& InCenter, const int32 InIndex);
-		~FUnionNode() = default;
+		FORCEINLINE int32 Num() const { return Seeds.Num(); }
+		FORCEINLINE bool IsEmpty() const { return Seeds.IsEmpty(); }
 
-		FORCEINLINE FVector GetCenter() const { return CenterAccum / static_cast<double>(FuseCount); }
-		FORCEINLINE void Accumulate(const FVector& Position)
+		void Reserve(const int32 InNum);
+		void Empty();
+
+		FORCEINLINE int32 Add(const PCGExData::FConstPoint& InSeed, const FVector& InCenter)
 		{
-			CenterAccum += Position;
-			FuseCount++;
+			CenterAccums.Add(InCenter);
+			FuseCounts.Add(1);
+			return Seeds.Add(InSeed);
+		}
+
+		FORCEINLINE void Accumulate(const int32 Index, const FVector& Position)
+		{
+			CenterAccums[Index] += Position;
+			FuseCounts[Index]++;
 		}
-	};
 
-	PCGEX_OCTREE_SEMANTICS(FUnionNode, { return Element->Bounds;}, { return A->Index == B->Index; })
+		FORCEINLINE FVector GetCenter(const int32 Index) const { return CenterAccums[Index] / static_cast<double>(FuseCounts[Index]); }
+
+		/** World bounds of the seed point */
+		FBoxSphereBounds GetBounds(const int32 Index) const;
+
+		/** Reorder nodes so that node i becomes node NewToOld[i] */
+		void Reorder(const TArray<int32>& NewToOld);
+	};
 
 	class PCGEXGRAPHS_API FUnionGraph : public TSharedFromThis<FUnionGraph>
 	{
 		int32 NumCollapsedEdges = 0;
 
 	public:
+		/** Edge recorded for deferred (precise) fusing, resolved by ResolvePending */
+		struct FPendingEdge
+		{
+			PCGExData::FConstPoint From;
+			PCGExData::FConstPoint To;
+			PCGExData::FConstPoint Edge;
+
+			FPendingEdge(const PCGExData::FConstPoint& InFrom, const PCGExData::FConstPoint& InTo, const PCGExData::FConstPoint& InEdge)
+				: From(InFrom), To(InTo), Edge(InEdge)
+			{
+			}
+		};
+
 		PCGExMT::TH64MapShards<int32> NodeBinsShards;
 
 		TWeakPtr<PCGExData::FPointIOCollection> SourceCollection = nullptr;
 		TSharedPtr<PCGExData::FUnionMetadata> NodesUnion;
 		TSharedPtr<PCGExData::FUnionMetadata> EdgesUnion;
-		TArray<TSharedPtr<FUnionNode>> Nodes;
+		FUnionNodes Nodes;
 
 		PCGExMT::TH64MapShards<int32> EdgesMapShards;
 		TArray<FEdge> Edges;
@@ -97,11 +127,18 @@ namespace PCGExGraphs
 
 		bool bNodesSorted = false;
 
-		TUniquePtr<FUnionNodeOctree> Octree;
+		/** Precise (octree) fusing doesn't insert right away; points & edges are recorded and fused all at once by ResolvePending */
+		bool bDeferredInsertion = false;
+		TArray<PCGExData::FConstPoint> PendingPoints;
+		TArray<FPendingEdge> PendingEdges;
 
 		mutable FRWLock UnionLock;
 		mutable FRWLock EdgesLock;
 
+		/** Striped by node index; serializes concurrent accumulation into the same node while UnionLock is only read-locked */
+		static constexpr int32 NumAccumulateLocks = 32;
+		mutable TStaticArray<FRWLock, NumAccumulateLocks> AccumulateLocks;
+
 		explicit FUnionGraph(const FPCGExFuseDetails& InFuseDetails, const FBox& InBounds, const TSharedPtr<PCGExData::FPointIOCollection>& InSourceCollection = nullptr);
 
 		~FUnionGraph() = default;
@@ -112,8 +149,9 @@ namespace PCGExGraphs
 		void Reserve(const int32 NodeReserve, const int32 EdgeReserve);
 
 		FORCEINLINE int32 GetNumCollapsedEdges() const { return NumCollapsedEdges; }
-		FORCEINLINE bool RequiresSequentialInsertion() const { return Octree != nullptr; }
+		FORCEINLINE bool IsDeferred() const { return bDeferredInsertion; }
 
+		/** Returns the node index the point was fused into, or -1 if insertion is deferred */
 		int32 InsertPoint(const PCGExData::FConstPoint& Point);
 
 		void InsertEdge(const PCGExData::FConstPoint& From, const PCGExData::FConstPoint& To, const PCGExData::FConstPoint& Edge = PCGExData::NONE_ConstPoint);
@@ -121,27 +159,38 @@ namespace PCGExGraphs
 		void WriteNodeMetadata(const TSharedPtr<FGraph>& InGraph) const;
 		void WriteEdgeMetadata(const TSharedPtr<FGraph>& InGraph) const;
 
+		/**
+		 * Fuse all pending points & edges. Matches serial octree insertion semantics : in insertion order, a point becomes
+		 * a new node unless it is within tolerance of an earlier node seed, in which case it joins the closest one.
+		 * Pending items are first sorted by (IO, Index) so the result doesn't depend on which thread recorded them.
+		 * Candidate pairs are gathered in parallel from a tolerance-sized grid; only the seed selection is sequential.
+		 */
+		void ResolvePending();
+
 		void Collapse();
 
 		/** RAII batch inserter for sequential use. Holds both locks for the lifetime,
-		 *  avoiding per-element lock overhead when inserting from a single thread. */
+		 *  avoiding per-element lock overhead when inserting from a single thread.
+		 *  When insertion is deferred, no lock is held : items are recorded locally and flushed on destruction. */
 		class PCGEXGRAPHS_API FBatchInserter
 		{
 			FUnionGraph& Graph;
-			FWriteScopeLock UnionLk;
-			FWriteScopeLock EdgesLk;
+			const bool bDeferred;
+			TArray<PCGExData::FConstPoint> PendingPoints;
+			TArray<FPendingEdge> PendingEdges;
 
 		public:
-			explicit FBatchInserter(FUnionGraph& InGraph)
-				: Graph(InGraph), UnionLk(InGraph.UnionLock), EdgesLk(InGraph.EdgesLock)
-			{
-			}
+			explicit FBatchInserter(FUnionGraph& InGraph);
+			~FBatchInserter();
 
 			int32 InsertPoint(const PCGExData::FConstPoint& Point);
 			void InsertEdge(const PCGExData::FConstPoint& From,
 			                const PCGExData::FConstPoint& To,
 			                const PCGExData::FConstPoint& Edge = PCGExData::NONE_ConstPoint);
 		};
+
+	protected:
+		void InsertEdge_Unsafe(const int32 Start, const int32 End, const PCGExData::FConstPoint& Edge);
 	};
 
 #pragma endregion
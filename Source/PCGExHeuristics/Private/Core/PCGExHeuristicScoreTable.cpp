@@ -0,0 +1,64 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Core/PCGExHeuristicScoreTable.h"
+
+#include "PCGExHeuristicsHandler.h"
+#include "Clusters/PCGExCluster.h"
+#include "Core/PCGExMTCommon.h"
+
+#define LOCTEXT_NAMESPACE "PCGExHeuristicScoreTable"
+
+namespace PCGExHeuristics
+{
+	TSharedPtr<FHeuristicScoreTable> FHeuristicScoreTable::Build(const PCGExClusters::FCluster* InCluster, const FHandler& InHandler)
+	{
+		check(InHandler.HasStaticEdgeScores())
+
+		const TArray<PCGExClusters::FNode>& NodesRef = *InCluster->Nodes;
+		const TArray<PCGExGraphs::FEdge>& EdgesRef = *InCluster->Edges;
+		const int32 NumNodes = NodesRef.Num();
+
+		const TSharedPtr<FHeuristicScoreTable> Table = MakeShared<FHeuristicScoreTable>();
+		Table->Adjacency = InCluster->GetAdjacency();
+
+		const PCGExClusters::FClusterAdjacency& Adjacency = *Table->Adjacency;
+
+		TArray<double>& Scores = Table->Scores;
+		Scores.SetNumUninitialized(Adjacency.NumLinks());
+
+		// Seed & goal are irrelevant to static edge scores, pass the edge endpoints
+		PCGEX_PARALLEL_FOR(
+			NumNodes,
+
+			const PCGExClusters::FNode& From = NodesRef[i];
+			const TConstArrayView<PCGExGraphs::FLink> Links = Adjacency.GetLinks(i);
+			double* NodeScores = Scores.GetData() + Adjacency.GetOffset(i);
+
+			for (int32 l = 0; l < Links.Num(); l++)
+			{
+				const PCGExGraphs::FLink Lk = Links[l];
+				const PCGExClusters::FNode& To = NodesRef[Lk.Node];
+				NodeScores[l] = InHandler.GetEdgeScore(From, To, EdgesRef[Lk.Edge], From, To);
+			}
+		)
+
+		return Table;
+	}
+
+#pragma region FHeuristicScoreTableCacheFactory
+
+	FText FHeuristicScoreTableCacheFactory::GetDisplayName() const
+	{
+		return LOCTEXT("DisplayName", "Heuristic Scores");
+	}
+
+	FText FHeuristicScoreTableCacheFactory::GetTooltip() const
+	{
+		return LOCTEXT("Tooltip", "Precompiled per-edge heuristic scores, used by searches when all heuristics have static edge scores.");
+	}
+
+#pragma endregion
+}
+
+#undef LOCTEXT_NAMESPACE
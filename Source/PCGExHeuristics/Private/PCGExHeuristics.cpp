@@ -3,6 +3,9 @@
 
 #include "PCGExHeuristics.h"
 
+#include "Clusters/PCGExClusterCache.h"
+#include "Core/PCGExHeuristicScoreTable.h"
+
 #if WITH_EDITOR
 #include "Styling/AppStyle.h"
 
@@ -18,10 +21,18 @@
 void FPCGExHeuristicsModule::StartupModule()
 {
 	IPCGExLegacyModuleInterface::StartupModule();
+
+	// Register cluster cache factories
+	PCGExClusters::FClusterCacheRegistry::Get().Register(
+		MakeShared<PCGExHeuristics::FHeuristicScoreTableCacheFactory>());
 }
 
 void FPCGExHeuristicsModule::ShutdownModule()
 {
+	// Unregister cluster cache factories
+	PCGExClusters::FClusterCacheRegistry::Get().Unregister(
+		PCGExHeuristics::FHeuristicScoreTableCacheFactory::CacheKey);
+
 	IPCGExLegacyModuleInterface::ShutdownModule();
 }
 
@@ -4,6 +4,7 @@
 #include "PCGExHeuristicsHandler.h"
 
 #include "Clusters/PCGExCluster.h"
+#include "UObject/ObjectKey.h"
 #include "Heuristics/PCGExHeuristicFeedback.h"
 #include "Core/PCGExHeuristicOperation.h"
 
@@ -64,8 +65,12 @@ namespace PCGExHeuristics
 
 	bool FHandler::BuildFrom(FPCGExContext* InContext, const TArray<TObjectPtr<const UPCGExHeuristicsFactoryData>>& InFactories)
 	{
+		FactoriesHash = 0;
+
 		for (const UPCGExHeuristicsFactoryData* OperationFactory : InFactories)
 		{
+			FactoriesHash = HashCombineFast(FactoriesHash, GetTypeHash(FObjectKey(OperationFactory)));
+
 			TSharedPtr<FPCGExHeuristicOperation> Operation = nullptr;
 			bool bIsFeedback = false;
 			if (const UPCGExHeuristicsFactoryFeedback* FeedbackFactory = Cast<UPCGExHeuristicsFactoryFeedback>(OperationFactory))
@@ -149,6 +154,30 @@ namespace PCGExHeuristics
 				break;
 			}
 		}
+
+		ScoreTable.Reset();
+		if (!HasStaticEdgeScores()) { return; }
+
+		// Compile static edge scores once, and share them with any other handler built from the same factories
+		uint32 TableHash = HashCombineFast(FactoriesHash, HashCombineFast(GetTypeHash(static_cast<uint8>(ScoreMode)), GetTypeHash(ReferenceWeight)));
+		if (!TableHash) { TableHash = 1; }
+
+		TSharedPtr<FHeuristicScoreTable> Table = Cluster->GetCachedData<FHeuristicScoreTable>(FHeuristicScoreTableCacheFactory::CacheKey, TableHash);
+		if (!Table || Table->NumNodes() != Cluster->Nodes->Num())
+		{
+			Table = FHeuristicScoreTable::Build(Cluster.Get(), *this);
+			Table->ContextHash = TableHash;
+			Cluster->SetCachedData(FHeuristicScoreTableCacheFactory::CacheKey, Table);
+		}
+
+		ScoreTable = Table;
+	}
+
+	bool FHandler::HasStaticEdgeScores() const
+	{
+		if (Operations.IsEmpty() || HasAnyFeedback()) { return false; }
+		for (const TSharedPtr<FPCGExHeuristicOperation>& Op : Operations) { if (!Op->HasStaticEdgeScore()) { return false; } }
+		return true;
 	}
 
 	void FHandler::FeedbackPointScore(const PCGExClusters::FNode& Node)
@@ -243,23 +272,34 @@ namespace PCGExHeuristics
 		const TSharedPtr<PCGExData::FFacade>& InEdgeDataCache,
 		const TArray<TObjectPtr<const UPCGExHeuristicsFactoryData>>& InFactories)
 	{
+		TSharedPtr<FHandler> NewHandler;
+
 		switch (ScoreMode)
 		{
-		case EPCGExHeuristicScoreMode::WeightedAverage:
-			return MakeShared<FHandlerWeightedAverage>(InContext, InVtxDataCache, InEdgeDataCache, InFactories);
 		case EPCGExHeuristicScoreMode::GeometricMean:
-			return MakeShared<FHandlerGeometricMean>(InContext, InVtxDataCache, InEdgeDataCache, InFactories);
+			NewHandler = MakeShared<FHandlerGeometricMean>(InContext, InVtxDataCache, InEdgeDataCache, InFactories);
+			break;
 		case EPCGExHeuristicScoreMode::WeightedSum:
-			return MakeShared<FHandlerWeightedSum>(InContext, InVtxDataCache, InEdgeDataCache, InFactories);
+			NewHandler = MakeShared<FHandlerWeightedSum>(InContext, InVtxDataCache, InEdgeDataCache, InFactories);
+			break;
 		case EPCGExHeuristicScoreMode::HarmonicMean:
-			return MakeShared<FHandlerHarmonicMean>(InContext, InVtxDataCache, InEdgeDataCache, InFactories);
+			NewHandler = MakeShared<FHandlerHarmonicMean>(InContext, InVtxDataCache, InEdgeDataCache, InFactories);
+			break;
 		case EPCGExHeuristicScoreMode::Min:
-			return MakeShared<FHandlerMin>(InContext, InVtxDataCache, InEdgeDataCache, InFactories);
+			NewHandler = MakeShared<FHandlerMin>(InContext, InVtxDataCache, InEdgeDataCache, InFactories);
+			break;
 		case EPCGExHeuristicScoreMode::Max:
-			return MakeShared<FHandlerMax>(InContext, InVtxDataCache, InEdgeDataCache, InFactories);
+			NewHandler = MakeShared<FHandlerMax>(InContext, InVtxDataCache, InEdgeDataCache, InFactories);
+			break;
 		default:
-			return MakeShared<FHandlerWeightedAverage>(InContext, InVtxDataCache, InEdgeDataCache, InFactories);
+		case EPCGExHeuristicScoreMode::WeightedAverage:
+			NewHandler = MakeShared<FHandlerWeightedAverage>(InContext, InVtxDataCache, InEdgeDataCache, InFactories);
+			ScoreMode = EPCGExHeuristicScoreMode::WeightedAverage;
+			break;
 		}
+
+		NewHandler->ScoreMode = ScoreMode;
+		return NewHandler;
 	}
 
 #pragma endregion
@@ -61,6 +61,9 @@ public:
 	/** Returns the category of this heuristic for optimization purposes */
 	virtual EPCGExHeuristicCategory GetCategory() const { return EPCGExHeuristicCategory::GoalDependent; }
 
+	/** Whether edge scores only depend on the traversed edge (not on seed, goal or travel history), and can be precomputed per cluster */
+	virtual bool HasStaticEdgeScore() const { return GetCategory() == EPCGExHeuristicCategory::FullyStatic; }
+
 	virtual void PrepareForCluster(const TSharedPtr<const PCGExClusters::FCluster>& InCluster);
 
 	virtual double GetGlobalScore(const PCGExClusters::FNode& From, const PCGExClusters::FNode& Seed, const PCGExClusters::FNode& Goal) const;
@@ -0,0 +1,54 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Clusters/PCGExClusterCache.h"
+#include "Clusters/PCGExClusterAdjacency.h"
+
+namespace PCGExClusters
+{
+	class FCluster;
+}
+
+namespace PCGExHeuristics
+{
+	class FHandler;
+
+	/**
+	 * Precompiled edge scores of a heuristics handler whose edge scores are static.
+	 * Scores are stored per flat link of the cluster adjacency : the score of the i-th link of node N is
+	 * Scores[Adjacency->Offsets[N] + i], and goes from N to the link node. Searches read it instead of evaluating operations.
+	 */
+	class PCGEXHEURISTICS_API FHeuristicScoreTable : public PCGExClusters::ICachedClusterData
+	{
+	public:
+		TSharedPtr<const PCGExClusters::FClusterAdjacency> Adjacency;
+		TArray<double> Scores;
+
+		FORCEINLINE int32 NumNodes() const { return Adjacency->NumNodes(); }
+		FORCEINLINE int32 NumLinks() const { return Scores.Num(); }
+		FORCEINLINE const double* GetNodeScores(const int32 NodeIndex) const { return Scores.GetData() + Adjacency->GetOffset(NodeIndex); }
+
+		/** Evaluate every link of the cluster in parallel. Handler must have static edge scores. */
+		static TSharedPtr<FHeuristicScoreTable> Build(const PCGExClusters::FCluster* InCluster, const FHandler& InHandler);
+	};
+
+	/**
+	 * Factory for precompiled heuristic scores.
+	 * Opportunistic : tables depend on the heuristics configuration, and are built by handlers on first use.
+	 */
+	class PCGEXHEURISTICS_API FHeuristicScoreTableCacheFactory : public PCGExClusters::IClusterCacheFactory
+	{
+	public:
+		static inline const FName CacheKey = FName("HeuristicScores");
+
+		virtual FName GetCacheKey() const override { return CacheKey; }
+		virtual FText GetDisplayName() const override;
+		virtual FText GetTooltip() const override;
+		virtual EClusterCacheType GetCacheType() const override { return EClusterCacheType::Opportunistic; }
+
+		virtual TSharedPtr<PCGExClusters::ICachedClusterData> Build(const PCGExClusters::FClusterCacheBuildContext& Context) const override { return nullptr; }
+	};
+}
@@ -29,6 +29,7 @@ class FPCGExHeuristicDistance : public FPCGExHeuristicOperation
 {
 public:
 	virtual EPCGExHeuristicCategory GetCategory() const override { return EPCGExHeuristicCategory::GoalDependent; }
+	virtual bool HasStaticEdgeScore() const override { return true; }
 
 	virtual void PrepareForCluster(const TSharedPtr<const PCGExClusters::FCluster>& InCluster) override;
 
@@ -46,6 +46,7 @@ class FPCGExHeuristicSteepness : public FPCGExHeuristicOperation
 
 public:
 	virtual EPCGExHeuristicCategory GetCategory() const override { return bAccumulate ? EPCGExHeuristicCategory::TravelDependent : EPCGExHeuristicCategory::GoalDependent; }
+	virtual bool HasStaticEdgeScore() const override { return !bAccumulate; }
 
 	virtual void PrepareForCluster(const TSharedPtr<const PCGExClusters::FCluster>& InCluster) override;
 
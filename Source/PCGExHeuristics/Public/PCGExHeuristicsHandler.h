@@ -5,6 +5,7 @@
 
 #include "CoreMinimal.h"
 #include "Core/PCGExHeuristicsFactoryProvider.h"
+#include "Core/PCGExHeuristicScoreTable.h"
 #include "PCGExHeuristicsCommon.h"
 #include "Clusters/PCGExNode.h"
 
@@ -103,16 +104,29 @@ namespace PCGExHeuristics
 		double ReferenceWeight = 1;
 		double TotalStaticWeight = 0;
 		bool bUseDynamicWeight = false;
+		EPCGExHeuristicScoreMode ScoreMode = EPCGExHeuristicScoreMode::WeightedAverage;
 
 		/** Categorized operations for fast-path optimizations */
 		FCategorizedOperations CategorizedOps;
 
+		/** Precompiled edge scores for the current cluster, only set if edge scores are static */
+		TSharedPtr<const FHeuristicScoreTable> ScoreTable;
+
 		bool IsValidHandler() const { return bIsValidHandler; }
 		bool HasTravelDependentOperations() const { return CategorizedOps.bHasTravelDependent; }
 		bool HasGlobalFeedback() const { return !Feedbacks.IsEmpty(); };
 		bool HasLocalFeedback() const { return !LocalFeedbackFactories.IsEmpty(); };
 		bool HasAnyFeedback() const { return HasGlobalFeedback() || HasLocalFeedback(); };
 
+		/** Whether edge scores only depend on the traversed edge, and can be precomputed once per cluster. Any kind of feedback disqualifies. */
+		bool HasStaticEdgeScores() const;
+
+		/**
+		 * Precompiled edge scores of a node links, in link order.
+		 * When not null, the i-th entry is what GetEdgeScore would return for the i-th link of that node, whatever the seed & goal.
+		 */
+		FORCEINLINE const double* GetStaticEdgeScores(const int32 NodeIndex) const { return ScoreTable ? ScoreTable->GetNodeScores(NodeIndex) : nullptr; }
+
 		FHandler(FPCGExContext* InContext, const TSharedPtr<PCGExData::FFacade>& InVtxDataCache, const TSharedPtr<PCGExData::FFacade>& InEdgeDataCache, const TArray<TObjectPtr<const UPCGExHeuristicsFactoryData>>& InFactories);
 		virtual ~FHandler();
 
@@ -155,6 +169,9 @@ namespace PCGExHeuristics
 		PCGExClusters::FNode* RoamingSeedNode = nullptr;
 		PCGExClusters::FNode* RoamingGoalNode = nullptr;
 
+		/** Identity of the factories this handler was built from, so cached score tables are only shared between identical configurations */
+		uint32 FactoriesHash = 0;
+
 		/** Pool of reusable local feedback handlers */
 		TArray<TSharedPtr<FLocalFeedbackHandler>> LocalFeedbackHandlerPool;
 		FCriticalSection PoolLock;
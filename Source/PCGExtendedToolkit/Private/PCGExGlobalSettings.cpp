@@ -44,6 +44,10 @@ void UPCGExGlobalSettings::UpdateSettingsCaches() const
 	PCGEX_PUSH_SETTING(Core, bUseDelaunator)
 	PCGEX_PUSH_SETTING(Core, bAssertOnEmptyThread)
 	PCGEX_PUSH_SETTING(Core, ExecutionPolicy)
+	PCGEX_PUSH_SETTING(Core, bAdaptiveChunkSize)
+	PCGEX_PUSH_SETTING(Core, AdaptiveTargetScopeDuration)
+	PCGEX_PUSH_SETTING(Core, TrivialProcessorsBundleSize)
+	PCGEX_PUSH_SETTING(Core, ColumnCacheBudget)
 
 	PCGEX_PUSH_SETTING(Core, bUseNativeColorsIfPossible)
 	PCGEX_PUSH_SETTING(Core, bToneDownOptionalPins)
@@ -51,6 +55,7 @@ void UPCGExGlobalSettings::UpdateSettingsCaches() const
 	PCGEX_PUSH_SETTING(Core, bCacheClusters)
 	PCGEX_PUSH_SETTING(Core, bDefaultScopedIndexLookupBuild)
 	PCGEX_PUSH_SETTING(Core, bDefaultBuildAndCacheClusters)
+	PCGEX_PUSH_SETTING(Core, bPersistClusterTopology)
 
 	PCGEX_PUSH_SETTING(Core, SmallPointsSize)
 	PCGEX_PUSH_SETTING(Core, SmallClusterSize)
@@ -49,6 +49,22 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Performance|Defaults")
 	EPCGExExecutionPolicy ExecutionPolicy = EPCGExExecutionPolicy::Default;
 
+	/** Size parallel loop scopes from measured per-iteration costs instead of fixed chunk sizes. Costs are tracked per node type & loop for the session. Only loops using the default chunk sizes are affected, explicit per-node or per-item chunk sizes are kept as-is. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Defaults")
+	bool bAdaptiveChunkSize = false;
+
+	/** Target duration of a single parallel loop scope, in milliseconds, when adaptive chunk sizing is enabled. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Defaults", meta=(EditCondition="bAdaptiveChunkSize", ClampMin=0.01))
+	double AdaptiveTargetScopeDuration = 0.5;
+
+	/** Maximum number of trivial (small) processors executed back-to-back in a single task by point & cluster batches. 1 gives each processor its own task. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Defaults", meta=(ClampMin=1))
+	int32 TrivialProcessorsBundleSize = 32;
+
+	/** Memory budget (in MB) of the session-wide cache of decoded attribute columns, shared read-only between nodes reading the same attribute from the same data. 0 disables the cache. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Defaults", meta=(ClampMin=0))
+	int32 ColumnCacheBudget = 0;
+
 	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster")
 	bool bUseDelaunator = true;
 
@@ -70,6 +86,10 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster", meta=(EditCondition="bCacheClusters"))
 	bool bDefaultBuildAndCacheClusters = true;
 
+	/** Store a compact binary copy of cluster topology on output edges. It survives serialization & re-execution, and lets downstream nodes skip rebuilding clusters at the cost of some memory. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster")
+	bool bPersistClusterTopology = false;
+
 	UPROPERTY(EditAnywhere, config, Category = "Performance|Points", meta=(ClampMin=1))
 	int32 SmallPointsSize = 1024;
 	bool IsSmallPointSize(const int32 InNum) const { return InNum <= SmallPointsSize; }